@@ -0,0 +1,138 @@
+/*
+ * Copyright (c) 2026, Sensirion AG
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * * Redistributions of source code must retain the above copyright notice, this
+ *   list of conditions and the following disclaimer.
+ *
+ * * Redistributions in binary form must reproduce the above copyright notice,
+ *   this list of conditions and the following disclaimer in the documentation
+ *   and/or other materials provided with the distribution.
+ *
+ * * Neither the name of Sensirion AG nor the names of its
+ *   contributors may be used to endorse or promote products derived from
+ *   this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * \file
+ *
+ * \brief Software alert with the limits of the SHT3x alert mode
+ */
+
+#include "sht_alert.h"
+
+static void sht_alert_compile(sht_alert_t* alert) {
+    sht_threshold_compile_alert(&alert->thd,
+                                (sht_threshold_sensor_t)alert->sensor,
+                                &alert->temperature, &alert->humidity);
+}
+
+void sht_alert_init(sht_alert_t* alert, sht_threshold_sensor_t sensor) {
+    alert->temperature.high_set = 60000;
+    alert->temperature.high_clear = 58000;
+    alert->temperature.low_clear = -9000;
+    alert->temperature.low_set = -10000;
+    alert->humidity.high_set = 80000;
+    alert->humidity.high_clear = 79000;
+    alert->humidity.low_clear = 22000;
+    alert->humidity.low_set = 20000;
+    alert->callback = NULL;
+    alert->user_data = NULL;
+    alert->sensor = (uint8_t)sensor;
+    alert->events = 0;
+    alert->thd.state = 0;
+    sht_alert_compile(alert);
+}
+
+static int32_t* sht_alert_limit(sht_threshold_alert_limits_t* limits,
+                                sht_alert_thd_t thd) {
+    switch (thd) {
+        case SHT_ALERT_HIALRT_SET:
+            return &limits->high_set;
+        case SHT_ALERT_HIALRT_CLR:
+            return &limits->high_clear;
+        case SHT_ALERT_LOALRT_CLR:
+            return &limits->low_clear;
+        case SHT_ALERT_LOALRT_SET:
+            return &limits->low_set;
+        default:
+            return NULL;
+    }
+}
+
+int16_t sht_alert_set_thd(sht_alert_t* alert, sht_alert_thd_t thd,
+                          int32_t humidity, int32_t temperature) {
+    int32_t* rh_limit = sht_alert_limit(&alert->humidity, thd);
+    int32_t* t_limit = sht_alert_limit(&alert->temperature, thd);
+
+    if (!rh_limit || !t_limit)
+        return STATUS_ERR_INVALID_PARAMS;
+
+    *rh_limit = humidity;
+    *t_limit = temperature;
+    sht_alert_compile(alert);
+    return 0;
+}
+
+int16_t sht_alert_get_thd(const sht_alert_t* alert, sht_alert_thd_t thd,
+                          int32_t* humidity, int32_t* temperature) {
+    sht_threshold_alert_limits_t rh_limits = alert->humidity;
+    sht_threshold_alert_limits_t t_limits = alert->temperature;
+    int32_t* rh_limit = sht_alert_limit(&rh_limits, thd);
+    int32_t* t_limit = sht_alert_limit(&t_limits, thd);
+
+    if (!rh_limit || !t_limit)
+        return STATUS_ERR_INVALID_PARAMS;
+
+    *humidity = *rh_limit;
+    *temperature = *t_limit;
+    return 0;
+}
+
+void sht_alert_set_callback(sht_alert_t* alert, sht_alert_callback_t callback,
+                            void* user_data) {
+    alert->callback = callback;
+    alert->user_data = user_data;
+}
+
+uint8_t sht_alert_update(sht_alert_t* alert, uint16_t temperature_ticks,
+                         uint16_t humidity_ticks) {
+    uint8_t previous = alert->thd.state;
+    uint8_t state =
+        sht_threshold_classify(&alert->thd, temperature_ticks, humidity_ticks);
+    uint8_t changed = state ^ previous;
+
+    if (changed) {
+        alert->events |= changed;
+        if (alert->callback)
+            alert->callback(alert->user_data, state, changed);
+    }
+    return state;
+}
+
+uint8_t sht_alert_get_state(const sht_alert_t* alert) {
+    return alert->thd.state;
+}
+
+uint8_t sht_alert_take_events(sht_alert_t* alert) {
+    uint8_t events = alert->events;
+
+    alert->events = 0;
+    return events;
+}
@@ -0,0 +1,167 @@
+/*
+ * Copyright (c) 2026, Sensirion AG
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * * Redistributions of source code must retain the above copyright notice, this
+ *   list of conditions and the following disclaimer.
+ *
+ * * Redistributions in binary form must reproduce the above copyright notice,
+ *   this list of conditions and the following disclaimer in the documentation
+ *   and/or other materials provided with the distribution.
+ *
+ * * Neither the name of Sensirion AG nor the names of its
+ *   contributors may be used to endorse or promote products derived from
+ *   this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef SHT_ALERT_H
+#define SHT_ALERT_H
+
+#include "sensirion_arch_config.h"
+#include "sht_threshold.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#ifndef STATUS_ERR_INVALID_PARAMS
+#define STATUS_ERR_INVALID_PARAMS (-4)
+#endif
+
+/**
+ * Alert limits, in the order of sht3x_alert_thd_t
+ */
+typedef enum {
+    SHT_ALERT_HIALRT_SET,
+    SHT_ALERT_HIALRT_CLR,
+    SHT_ALERT_LOALRT_CLR,
+    SHT_ALERT_LOALRT_SET,
+} sht_alert_thd_t;
+
+/**
+ * Called on every change of the alert state
+ *
+ * @param user_data the pointer passed to sht_alert_set_callback()
+ * @param state     the SHT_THRESHOLD_* flags of the exceeded limits
+ * @param changed   the flags that changed with this measurement
+ */
+typedef void (*sht_alert_callback_t)(void* user_data, uint8_t state,
+                                     uint8_t changed);
+
+/**
+ * Software alert of a sensor without alert mode, following the four-limit
+ * hysteresis model of the SHT3x: a channel is in alert once its value rises
+ * above the HIALRT_SET limit until it drops below HIALRT_CLR, and once it
+ * drops below LOALRT_SET until it rises above LOALRT_CLR.
+ *
+ * Attach it to a device context with sht4x_dev_set_alert() or
+ * shtc1_dev_set_alert() to evaluate it on every measurement read.
+ */
+typedef struct sht_alert {
+    sht_threshold_alert_limits_t temperature;
+    sht_threshold_alert_limits_t humidity;
+    sht_threshold_t thd;
+    sht_alert_callback_t callback;
+    void* user_data;
+    uint8_t sensor;
+    /* flags that changed since the last sht_alert_take_events() */
+    uint8_t events;
+} sht_alert_t;
+
+/**
+ * Initialize an alert with the power-on limits of the SHT3x: high alert at
+ * 60 degC / 80 %RH cleared at 58 degC / 79 %RH, low alert at -10 degC /
+ * 20 %RH cleared at -9 degC / 22 %RH.
+ *
+ * @param alert     the alert to initialize
+ * @param sensor    the sensor family whose ticks are evaluated
+ */
+void sht_alert_init(sht_alert_t* alert, sht_threshold_sensor_t sensor);
+
+/**
+ * Set an alert limit, see sht3x_set_alert_thd(). The alert state is kept.
+ *
+ * @param alert         the alert
+ * @param thd           the limit to set
+ * @param humidity      humidity limit in milli percent
+ * @param temperature   temperature limit in milli degree Celsius
+ * @return              0 on success, STATUS_ERR_INVALID_PARAMS for an
+ *                      unknown limit
+ */
+int16_t sht_alert_set_thd(sht_alert_t* alert, sht_alert_thd_t thd,
+                          int32_t humidity, int32_t temperature);
+
+/**
+ * Get an alert limit, see sht3x_get_alert_thd()
+ *
+ * @param alert         the alert
+ * @param thd           the limit to get
+ * @param humidity      address for the humidity limit in milli percent
+ * @param temperature   address for the temperature limit in milli degree
+ *                      Celsius
+ * @return              0 on success, STATUS_ERR_INVALID_PARAMS for an
+ *                      unknown limit
+ */
+int16_t sht_alert_get_thd(const sht_alert_t* alert, sht_alert_thd_t thd,
+                          int32_t* humidity, int32_t* temperature);
+
+/**
+ * Set the function called on alert state changes, NULL to only collect the
+ * changes for sht_alert_take_events(). The callback runs in the context of
+ * the measurement read.
+ *
+ * @param alert     the alert
+ * @param callback  the function to call
+ * @param user_data passed to the callback
+ */
+void sht_alert_set_callback(sht_alert_t* alert, sht_alert_callback_t callback,
+                            void* user_data);
+
+/**
+ * Evaluate a measurement, called by the drivers after each successful read
+ *
+ * @param alert             the alert
+ * @param temperature_ticks the temperature ticks of the sensor
+ * @param humidity_ticks    the humidity ticks of the sensor
+ * @return                  the SHT_THRESHOLD_* flags of the exceeded limits
+ */
+uint8_t sht_alert_update(sht_alert_t* alert, uint16_t temperature_ticks,
+                         uint16_t humidity_ticks);
+
+/**
+ * Get the current alert state
+ *
+ * @param alert the alert
+ * @return      the SHT_THRESHOLD_* flags of the exceeded limits, 0 without
+ *              alert
+ */
+uint8_t sht_alert_get_state(const sht_alert_t* alert);
+
+/**
+ * Get and clear the flags that changed since the last call
+ *
+ * @param alert the alert
+ * @return      the SHT_THRESHOLD_* flags that were set or cleared
+ */
+uint8_t sht_alert_take_events(sht_alert_t* alert);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* SHT_ALERT_H */
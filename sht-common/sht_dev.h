@@ -0,0 +1,82 @@
+/*
+ * Copyright (c) 2026, Sensirion AG
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * * Redistributions of source code must retain the above copyright notice, this
+ *   list of conditions and the following disclaimer.
+ *
+ * * Redistributions in binary form must reproduce the above copyright notice,
+ *   this list of conditions and the following disclaimer in the documentation
+ *   and/or other materials provided with the distribution.
+ *
+ * * Neither the name of Sensirion AG nor the names of its
+ *   contributors may be used to endorse or promote products derived from
+ *   this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef SHT_DEV_H
+#define SHT_DEV_H
+
+#include "sensirion_arch_config.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * Bus index of a device context that uses the currently selected bus, i.e.
+ * sensirion_i2c_select_bus() is not called before accessing it
+ */
+#define SHT_BUS_DEFAULT 0xFF
+
+/**
+ * Statistics kept in each device context
+ */
+typedef struct sht_dev_stats {
+    /* successful measurement reads */
+    uint32_t measurements;
+    /* failed commands and reads */
+    uint32_t errors;
+} sht_dev_stats_t;
+
+/**
+ * Select the bus of a device context. To drive several buses from different
+ * threads, the I2C implementation has to keep the selected bus per thread,
+ * as sim_i2c does.
+ *
+ * @param bus   the bus index, SHT_BUS_DEFAULT to keep the current bus
+ * @return      0 on success, an error code otherwise
+ */
+int16_t sht_dev_select_bus(uint8_t bus);
+
+/**
+ * Count the result of an operation in the device statistics
+ *
+ * @param stats         the statistics to update
+ * @param ret           the result of the operation
+ * @param measurement   1 if the operation read a measurement
+ * @return              ret
+ */
+int16_t sht_dev_count(sht_dev_stats_t* stats, int16_t ret,
+                      uint8_t measurement);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* SHT_DEV_H */
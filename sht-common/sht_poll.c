@@ -0,0 +1,78 @@
+/*
+ * Copyright (c) 2026, Sensirion AG
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * * Redistributions of source code must retain the above copyright notice, this
+ *   list of conditions and the following disclaimer.
+ *
+ * * Redistributions in binary form must reproduce the above copyright notice,
+ *   this list of conditions and the following disclaimer in the documentation
+ *   and/or other materials provided with the distribution.
+ *
+ * * Neither the name of Sensirion AG nor the names of its
+ *   contributors may be used to endorse or promote products derived from
+ *   this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * \file
+ *
+ * \brief NACK polling read shared by the SHT drivers
+ */
+
+#include "sht_poll.h"
+#include "sensirion_common.h"
+#include "sensirion_i2c.h"
+
+/* each word is followed by its CRC byte */
+#define SHT_POLL_WORD_LEN (SENSIRION_WORD_SIZE + 1)
+#define SHT_POLL_MAX_WORDS 16
+
+int16_t sht_poll_read_words(uint8_t address, uint16_t* data_words,
+                            uint16_t num_words, sht_poll_t* poll) {
+    uint8_t buf[SHT_POLL_MAX_WORDS * SHT_POLL_WORD_LEN];
+    const uint16_t size = (uint16_t)(num_words * SHT_POLL_WORD_LEN);
+    uint32_t waited_usec = 0;
+    uint16_t i;
+    int16_t ret;
+
+    if (num_words > SHT_POLL_MAX_WORDS)
+        return -1;
+
+    /* only the read is retried, a CRC error is not a reason to poll again */
+    ret = sensirion_i2c_read(address, buf, size);
+    while (ret != NO_ERROR && waited_usec < poll->timeout_usec) {
+        sensirion_sleep_usec(poll->interval_usec);
+        waited_usec += poll->interval_usec;
+        ret = sensirion_i2c_read(address, buf, size);
+    }
+    poll->last_wait_usec = waited_usec;
+    if (ret != NO_ERROR)
+        return ret;
+
+    for (i = 0; i < num_words; ++i) {
+        const uint8_t* word = &buf[i * SHT_POLL_WORD_LEN];
+
+        ret = sensirion_common_check_crc(word, SENSIRION_WORD_SIZE,
+                                         word[SENSIRION_WORD_SIZE]);
+        if (ret != NO_ERROR)
+            return ret;
+        data_words[i] = (uint16_t)((uint16_t)word[0] << 8 | word[1]);
+    }
+    return NO_ERROR;
+}
@@ -0,0 +1,80 @@
+/*
+ * Copyright (c) 2026, Sensirion AG
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * * Redistributions of source code must retain the above copyright notice, this
+ *   list of conditions and the following disclaimer.
+ *
+ * * Redistributions in binary form must reproduce the above copyright notice,
+ *   this list of conditions and the following disclaimer in the documentation
+ *   and/or other materials provided with the distribution.
+ *
+ * * Neither the name of Sensirion AG nor the names of its
+ *   contributors may be used to endorse or promote products derived from
+ *   this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef SHT_POLL_H
+#define SHT_POLL_H
+
+#include "sensirion_arch_config.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * NACK polling configuration and result of a sensor. The sensors don't
+ * acknowledge their read header while a measurement is in progress, so instead
+ * of waiting the maximum measurement duration the read can be retried until
+ * the data is ready.
+ */
+typedef struct sht_poll {
+    /* time between read attempts, 0 disables polling */
+    uint16_t interval_usec;
+    /* give up once this much time has been waited without an ACK */
+    uint32_t timeout_usec;
+    /* time waited until the last polled read was acknowledged */
+    uint32_t last_wait_usec;
+} sht_poll_t;
+
+/**
+ * Read and CRC check data words, retrying the read every
+ * poll->interval_usec while the sensor doesn't acknowledge it.
+ * poll->last_wait_usec is set to the time slept before the read succeeded,
+ * an upper bound of the remaining conversion time at the resolution of the
+ * polling interval.
+ *
+ * The elapsed time is the sum of the sleeps, no time source is needed. Bus
+ * transfer time is not included.
+ *
+ * @param address       the I2C address of the sensor
+ * @param data_words    the buffer for the received words
+ * @param num_words     the number of words to read, at most 16
+ * @param poll          the polling configuration, polling must be enabled
+ * @return              0 if the read was successful, else the error of the
+ *                      last read attempt
+ */
+int16_t sht_poll_read_words(uint8_t address, uint16_t* data_words,
+                            uint16_t num_words, sht_poll_t* poll);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* SHT_POLL_H */
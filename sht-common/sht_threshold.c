@@ -0,0 +1,179 @@
+/*
+ * Copyright (c) 2026, Sensirion AG
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * * Redistributions of source code must retain the above copyright notice, this
+ *   list of conditions and the following disclaimer.
+ *
+ * * Redistributions in binary form must reproduce the above copyright notice,
+ *   this list of conditions and the following disclaimer in the documentation
+ *   and/or other materials provided with the distribution.
+ *
+ * * Neither the name of Sensirion AG nor the names of its
+ *   contributors may be used to endorse or promote products derived from
+ *   this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * \file
+ *
+ * \brief Threshold classification of raw sensor ticks
+ *
+ * All sensor families convert ticks with ((mul * tick) >> 13) + offset, which
+ * is strictly increasing in tick. A limit on the converted value is therefore
+ * equivalent to a limit on the tick, computed once when the threshold set is
+ * compiled.
+ */
+
+#include "sht_threshold.h"
+
+typedef struct {
+    uint32_t mul;
+    int32_t offset;
+} sht_threshold_formula_t;
+
+/* temperature and humidity formulas of each sht_threshold_sensor_t */
+static const sht_threshold_formula_t sht_threshold_formulas[][2] = {
+    {{21875, -45000}, {12500, 0}},     /* SHT3x */
+    {{21875, -45000}, {15625, -6000}}, /* SHT4x */
+    {{21875, -45000}, {12500, 0}},     /* SHTC1 */
+};
+
+uint32_t sht_threshold_tick_at_least(uint32_t mul, int32_t offset,
+                                     int64_t value) {
+    int64_t w = value - offset;
+
+    if (w <= 0)
+        return 0;
+    if (w > (int64_t)((mul * 0xFFFFU) >> 13))
+        return SHT_THRESHOLD_NEVER;
+    return (uint32_t)((w * 8192 + mul - 1) / mul);
+}
+
+uint16_t sht_threshold_value_to_tick(uint32_t mul, int32_t offset,
+                                     int32_t value) {
+    uint32_t tick = sht_threshold_tick_at_least(mul, offset, value);
+
+    return tick > 0xFFFFU ? 0xFFFFU : (uint16_t)tick;
+}
+
+static uint32_t tick_at_least(const sht_threshold_formula_t* formula,
+                              int64_t value) {
+    return sht_threshold_tick_at_least(formula->mul, formula->offset, value);
+}
+
+/* value < low_set, value > low_clear, value > high_set, value < high_clear */
+static void compile_channel(sht_threshold_ticks_t* ticks,
+                            const sht_threshold_formula_t* formula,
+                            int64_t low_set, int64_t low_clear,
+                            int64_t high_set, int64_t high_clear) {
+    ticks->low_set = tick_at_least(formula, low_set);
+    ticks->low_clear = tick_at_least(formula, low_clear + 1);
+    ticks->high_set = tick_at_least(formula, high_set + 1);
+    ticks->high_clear = tick_at_least(formula, high_clear);
+}
+
+static void compile_limits(sht_threshold_ticks_t* ticks,
+                           const sht_threshold_formula_t* formula,
+                           const sht_threshold_limits_t* limits) {
+    int64_t hysteresis = limits->hysteresis > 0 ? limits->hysteresis : 0;
+
+    compile_channel(ticks, formula, limits->low, limits->low + hysteresis,
+                    limits->high, limits->high - hysteresis);
+}
+
+static uint8_t classify_channel(const sht_threshold_ticks_t* ticks,
+                                uint8_t state, uint32_t tick, uint8_t low,
+                                uint8_t high) {
+    if (state & low) {
+        if (tick >= ticks->low_clear)
+            state &= (uint8_t)~low;
+    } else if (tick < ticks->low_set) {
+        state |= low;
+    }
+
+    if (state & high) {
+        if (tick < ticks->high_clear)
+            state &= (uint8_t)~high;
+    } else if (tick >= ticks->high_set) {
+        state |= high;
+    }
+    return state;
+}
+
+void sht_threshold_compile(sht_threshold_t* thd, sht_threshold_sensor_t sensor,
+                           const sht_threshold_limits_t* temperature,
+                           const sht_threshold_limits_t* humidity) {
+    const sht_threshold_formula_t* formulas = sht_threshold_formulas[sensor];
+
+    compile_limits(&thd->temperature, &formulas[0], temperature);
+    compile_limits(&thd->humidity, &formulas[1], humidity);
+    thd->state = 0;
+}
+
+void sht_threshold_compile_alert(
+    sht_threshold_t* thd, sht_threshold_sensor_t sensor,
+    const sht_threshold_alert_limits_t* temperature,
+    const sht_threshold_alert_limits_t* humidity) {
+    const sht_threshold_formula_t* formulas = sht_threshold_formulas[sensor];
+
+    compile_channel(&thd->temperature, &formulas[0], temperature->low_set,
+                    temperature->low_clear, temperature->high_set,
+                    temperature->high_clear);
+    compile_channel(&thd->humidity, &formulas[1], humidity->low_set,
+                    humidity->low_clear, humidity->high_set,
+                    humidity->high_clear);
+}
+
+uint8_t sht_threshold_classify(sht_threshold_t* thd, uint16_t temperature_ticks,
+                               uint16_t humidity_ticks) {
+    uint8_t state = thd->state;
+
+    /* the common case: nothing exceeded before and now */
+    if (!state && temperature_ticks >= thd->temperature.low_set &&
+        temperature_ticks < thd->temperature.high_set &&
+        humidity_ticks >= thd->humidity.low_set &&
+        humidity_ticks < thd->humidity.high_set)
+        return 0;
+
+    state = classify_channel(&thd->temperature, state, temperature_ticks,
+                             SHT_THRESHOLD_T_LOW, SHT_THRESHOLD_T_HIGH);
+    state = classify_channel(&thd->humidity, state, humidity_ticks,
+                             SHT_THRESHOLD_RH_LOW, SHT_THRESHOLD_RH_HIGH);
+    thd->state = state;
+    return state;
+}
+
+uint32_t sht_threshold_classify_batch(sht_threshold_t* thd,
+                                      const uint16_t* ticks, uint8_t* states,
+                                      uint32_t count) {
+    uint32_t transitions = 0;
+    uint32_t i;
+
+    for (i = 0; i < count; ++i) {
+        uint8_t previous = thd->state;
+        uint8_t state =
+            sht_threshold_classify(thd, ticks[2 * i], ticks[2 * i + 1]);
+
+        if (state != previous)
+            transitions++;
+        if (states)
+            states[i] = state;
+    }
+    return transitions;
+}
@@ -0,0 +1,210 @@
+/*
+ * Copyright (c) 2026, Sensirion AG
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * * Redistributions of source code must retain the above copyright notice, this
+ *   list of conditions and the following disclaimer.
+ *
+ * * Redistributions in binary form must reproduce the above copyright notice,
+ *   this list of conditions and the following disclaimer in the documentation
+ *   and/or other materials provided with the distribution.
+ *
+ * * Neither the name of Sensirion AG nor the names of its
+ *   contributors may be used to endorse or promote products derived from
+ *   this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef SHT_THRESHOLD_H
+#define SHT_THRESHOLD_H
+
+#include "sensirion_arch_config.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* Classification result, a combination of the flags of the limits exceeded */
+#define SHT_THRESHOLD_T_LOW 0x01
+#define SHT_THRESHOLD_T_HIGH 0x02
+#define SHT_THRESHOLD_RH_LOW 0x04
+#define SHT_THRESHOLD_RH_HIGH 0x08
+
+/* Tick returned by sht_threshold_tick_at_least() if no tick is large enough */
+#define SHT_THRESHOLD_NEVER 0x10000U
+
+/* Limits that are never exceeded, to disable one side of a channel */
+#define SHT_THRESHOLD_OFF_LOW INT32_MIN
+#define SHT_THRESHOLD_OFF_HIGH INT32_MAX
+
+/**
+ * Conversion formulas of the sensor families
+ */
+typedef enum {
+    SHT_THRESHOLD_SHT3X,
+    SHT_THRESHOLD_SHT4X,
+    SHT_THRESHOLD_SHTC1,
+} sht_threshold_sensor_t;
+
+/**
+ * Limits of one channel in milli degree Celsius or milli percent relative
+ * humidity. The channel is low once the value drops below `low` and stays low
+ * until it rises above `low + hysteresis`, high once the value rises above
+ * `high` until it drops below `high - hysteresis`.
+ */
+typedef struct sht_threshold_limits {
+    int32_t low;
+    int32_t high;
+    int32_t hysteresis;
+} sht_threshold_limits_t;
+
+/**
+ * Set and clear limits of one channel in the four-limit model of the SHT3x
+ * alert mode, in milli degree Celsius or milli percent relative humidity. The
+ * channel is high once the value rises above `high_set` until it drops below
+ * `high_clear`, low once it drops below `low_set` until it rises above
+ * `low_clear`.
+ */
+typedef struct sht_threshold_alert_limits {
+    int32_t high_set;
+    int32_t high_clear;
+    int32_t low_clear;
+    int32_t low_set;
+} sht_threshold_alert_limits_t;
+
+/**
+ * Limits of one channel compiled to sensor ticks. The values are exclusive
+ * upper bounds, 0x10000 stands for a limit that no tick reaches.
+ */
+typedef struct sht_threshold_ticks {
+    /* low while tick < low_set, until tick >= low_clear */
+    uint32_t low_set;
+    uint32_t low_clear;
+    /* high while tick >= high_set, until tick < high_clear */
+    uint32_t high_set;
+    uint32_t high_clear;
+} sht_threshold_ticks_t;
+
+/**
+ * Compiled threshold set and classification state of one sensor
+ */
+typedef struct sht_threshold {
+    sht_threshold_ticks_t temperature;
+    sht_threshold_ticks_t humidity;
+    uint8_t state;
+} sht_threshold_t;
+
+/**
+ * Compile a threshold set to the ticks of a sensor family and reset the
+ * classification state. The conversion to ticks is exact: a tick is
+ * classified as out of range exactly when its converted value is. A negative
+ * hysteresis is treated as 0.
+ *
+ * @param thd           the threshold set to initialize
+ * @param sensor        the sensor family providing the ticks
+ * @param temperature   the temperature limits in milli degree Celsius
+ * @param humidity      the humidity limits in milli percent
+ */
+void sht_threshold_compile(sht_threshold_t* thd, sht_threshold_sensor_t sensor,
+                           const sht_threshold_limits_t* temperature,
+                           const sht_threshold_limits_t* humidity);
+
+/**
+ * Compile a threshold set from set and clear limits, see
+ * sht_threshold_compile(). Unlike sht_threshold_compile() the classification
+ * state is kept, so limits can be changed while a limit is exceeded.
+ *
+ * @param thd           the threshold set to update
+ * @param sensor        the sensor family providing the ticks
+ * @param temperature   the temperature limits in milli degree Celsius
+ * @param humidity      the humidity limits in milli percent
+ */
+void sht_threshold_compile_alert(
+    sht_threshold_t* thd, sht_threshold_sensor_t sensor,
+    const sht_threshold_alert_limits_t* temperature,
+    const sht_threshold_alert_limits_t* humidity);
+
+/**
+ * Exact inverse of the tick conversion ((mul * tick) >> 13) + offset shared
+ * by all sensor families: the smallest tick that converts to at least value.
+ *
+ * @param mul       the multiplier of the conversion
+ * @param offset    the offset of the conversion
+ * @param value     the converted value, e.g. in milli degree Celsius
+ * @return          the tick, SHT_THRESHOLD_NEVER if even 0xFFFF converts to
+ *                  less than value
+ */
+uint32_t sht_threshold_tick_at_least(uint32_t mul, int32_t offset,
+                                     int64_t value);
+
+/**
+ * sht_threshold_tick_at_least() saturated to 0xFFFF, the implementation of
+ * the *_temperature_to_tick() and *_humidity_to_tick() driver functions
+ */
+uint16_t sht_threshold_value_to_tick(uint32_t mul, int32_t offset,
+                                     int32_t value);
+
+/**
+ * Classify a measurement in raw ticks, e.g. from sht4x_read_raw(), with
+ * integer compares only. Samples that are in range while no limit is exceeded
+ * take a single range check per channel.
+ *
+ * @param thd               the compiled threshold set
+ * @param temperature_ticks the temperature ticks of the sensor
+ * @param humidity_ticks    the humidity ticks of the sensor
+ * @return                  the SHT_THRESHOLD_* flags of the exceeded limits
+ */
+uint8_t sht_threshold_classify(sht_threshold_t* thd, uint16_t temperature_ticks,
+                               uint16_t humidity_ticks);
+
+/**
+ * Classify a series of measurements with sht_threshold_classify()
+ *
+ * @param thd       the compiled threshold set
+ * @param ticks     count pairs of temperature and humidity ticks
+ * @param states    count classification results, may be NULL
+ * @param count     the number of samples
+ * @return          the number of samples whose classification differs from
+ *                  the one of the previous sample
+ */
+uint32_t sht_threshold_classify_batch(sht_threshold_t* thd,
+                                      const uint16_t* ticks, uint8_t* states,
+                                      uint32_t count);
+
+#ifdef __cplusplus
+}
+
+namespace sht {
+
+/**
+ * sht_threshold_value_to_tick() usable in constant expressions, the
+ * implementation of temperature_to_tick() and humidity_to_tick() of the
+ * header-only C++ interfaces
+ */
+constexpr uint16_t threshold_value_to_tick(uint32_t mul, int32_t offset,
+                                           int32_t value) {
+    return (int64_t)value - offset <= 0 ? 0
+           : (int64_t)value - offset > (int64_t)((mul * 0xFFFFU) >> 13)
+               ? 0xFFFF
+               : (uint16_t)((((int64_t)value - offset) * 8192 + mul - 1) /
+                            mul);
+}
+
+}  // namespace sht
+#endif
+
+#endif /* SHT_THRESHOLD_H */
@@ -0,0 +1,66 @@
+/*
+ * Copyright (c) 2026, Sensirion AG
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * * Redistributions of source code must retain the above copyright notice, this
+ *   list of conditions and the following disclaimer.
+ *
+ * * Redistributions in binary form must reproduce the above copyright notice,
+ *   this list of conditions and the following disclaimer in the documentation
+ *   and/or other materials provided with the distribution.
+ *
+ * * Neither the name of Sensirion AG nor the names of its
+ *   contributors may be used to endorse or promote products derived from
+ *   this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef SHT_TIME_H
+#define SHT_TIME_H
+
+#include "sensirion_arch_config.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * Evaluates to 1 once the timestamp `now` has reached `deadline`. Works across
+ * the wrap-around of sht_time_now_usec() as long as both timestamps are less
+ * than 2^31 microseconds apart.
+ */
+#define SHT_TIME_REACHED(now, deadline) ((int32_t)((now) - (deadline)) >= 0)
+
+/**
+ * Return a monotonic timestamp in microseconds. The counter wraps around
+ * after 2^32 microseconds (about 71 minutes), use SHT_TIME_REACHED() or
+ * unsigned differences to compare timestamps.
+ *
+ * The function has to be provided by the platform alongside
+ * sensirion_sleep_usec(). sim_i2c provides a virtual time implementation that
+ * is shared with the simulated sensors and sht_time_posix.c one for hosts with
+ * real hardware.
+ *
+ * @return the current time in microseconds
+ */
+uint32_t sht_time_now_usec(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* SHT_TIME_H */
@@ -0,0 +1,563 @@
+/*
+ * Copyright (c) 2026, Sensirion AG
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * * Redistributions of source code must retain the above copyright notice, this
+ *   list of conditions and the following disclaimer.
+ *
+ * * Redistributions in binary form must reproduce the above copyright notice,
+ *   this list of conditions and the following disclaimer in the documentation
+ *   and/or other materials provided with the distribution.
+ *
+ * * Neither the name of Sensirion AG nor the names of its
+ *   contributors may be used to endorse or promote products derived from
+ *   this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * \file
+ *
+ * \brief Header-only C++20 coroutine interface to sensor measurements
+ *
+ * The measure/read split of the drivers lets a coroutine suspend during the
+ * conversion instead of blocking in sensirion_sleep_usec(), so that a single
+ * thread interleaves the measurements of many sensors:
+ *
+ *     sht::coro::Task<void> log(sht::coro::Scheduler& sched,
+ *                               sht4x_dev_t* dev) {
+ *         sht::coro::Sht4x sht4x(sched, dev);
+ *         for (;;) {
+ *             auto s = co_await sht4x.measure();
+ *             if (s.status == STATUS_OK)
+ *                 printf("%d %d\n", s.temperature, s.humidity);
+ *             co_await sched.sleep(1000000);
+ *         }
+ *     }
+ *
+ *     sht::coro::Scheduler sched;
+ *     sched.spawn(log(sched, &dev));
+ *     sched.run();
+ *
+ * Coroutines only suspend between I2C transactions, so the drivers still see
+ * a single caller. Sleeps are kept in a timer wheel and the scheduler sleeps
+ * once for the earliest deadline. With virtual time, the scheduler jumps
+ * from deadline to deadline without sleeping, e.g. to test coroutines
+ * without a bus. NACK polling is done by the driver and blocks.
+ *
+ * Needs C++20 (-std=c++20), coroutine frames are allocated with new.
+ */
+
+#ifndef SHT_CORO_HPP
+#define SHT_CORO_HPP
+
+#include <coroutine>
+#include <exception>
+#include <type_traits>
+
+#include "sensirion_arch_config.h"
+#include "sensirion_common.h"
+#include "sensirion_i2c.h"
+#include "sht_fleet.h"
+#include "sht_time.h"
+
+namespace sht {
+namespace coro {
+
+/**
+ * Result of a measurement. Temperature is in [degree Celsius] and relative
+ * humidity in [percent relative humidity], both multiplied by 1000.
+ */
+struct Measurement {
+    int16_t status;
+    int32_t temperature;
+    int32_t humidity;
+};
+
+/**
+ * A coroutine waiting in the timer wheel or for its turn to run
+ */
+struct TimerNode {
+    std::coroutine_handle<> handle;
+    uint64_t deadline_usec; /* see Scheduler::elapsed() */
+    TimerNode* next;
+};
+
+class Scheduler;
+
+namespace detail {
+
+struct PromiseBase {
+    std::coroutine_handle<> continuation;
+    Scheduler* scheduler = nullptr; /* set for spawned coroutines */
+    TimerNode start;
+
+    std::suspend_always initial_suspend() noexcept {
+        return {};
+    }
+    void unhandled_exception() noexcept {
+        std::terminate();
+    }
+};
+
+} /* namespace detail */
+
+/**
+ * Scheduler with a timer wheel of WheelSlots slots of TickUsec each. Sleeps
+ * longer than one revolution stay in their slot for further rounds. Deadlines
+ * are kept in 64 bit time since the scheduler was created, so that the wrap
+ * of sht_time_now_usec() every 2^32 microseconds doesn't affect the wheel.
+ */
+class Scheduler {
+  public:
+    static constexpr uint32_t TickUsec = 1000;
+    static constexpr uint32_t WheelSlots = 64;
+
+    /**
+     * @param virtual_time  jump to the next deadline instead of sleeping
+     * @param start_usec    the start of the virtual time
+     */
+    explicit Scheduler(bool virtual_time = false, uint32_t start_usec = 0)
+        : virtual_time_(virtual_time), now_usec_(start_usec) {
+        for (uint32_t i = 0; i < WheelSlots; ++i)
+            wheel_[i] = nullptr;
+        last_now_usec_ = now();
+    }
+
+    Scheduler(const Scheduler&) = delete;
+    Scheduler& operator=(const Scheduler&) = delete;
+
+    /**
+     * Current time in microseconds, sht_time_now_usec() or the virtual time
+     */
+    uint32_t now() const {
+        return virtual_time_ ? now_usec_ : sht_time_now_usec();
+    }
+
+    /**
+     * Microseconds since the scheduler was created. now() is sampled at
+     * least once per sleep, which is shorter than its wrap.
+     */
+    uint64_t elapsed() {
+        uint32_t now_usec = now();
+
+        elapsed_usec_ += (uint32_t)(now_usec - last_now_usec_);
+        last_now_usec_ = now_usec;
+        return elapsed_usec_;
+    }
+
+    /**
+     * Awaitable that suspends the coroutine for at least usec microseconds,
+     * 0 to let the other ready coroutines run first
+     */
+    struct SleepAwaiter {
+        Scheduler& scheduler;
+        uint32_t usec;
+        TimerNode node;
+
+        bool await_ready() const noexcept {
+            return false;
+        }
+        void await_suspend(std::coroutine_handle<> handle) noexcept {
+            node.handle = handle;
+            scheduler.add_timer(&node, scheduler.elapsed() + usec);
+        }
+        void await_resume() const noexcept {
+        }
+    };
+
+    SleepAwaiter sleep(uint32_t usec) {
+        return SleepAwaiter{*this, usec, {}};
+    }
+
+    /**
+     * Start a coroutine, the scheduler owns and destroys it when it is done
+     */
+    template <typename TaskT> void spawn(TaskT&& task) {
+        auto handle = task.release();
+        auto& promise = handle.promise();
+        promise.scheduler = this;
+        promise.start.handle = handle;
+        ++live_;
+        push_ready(&promise.start);
+    }
+
+    /**
+     * Run until all spawned coroutines are done
+     */
+    void run() {
+        while (live_) {
+            run_ready();
+            if (!live_ || !timers_)
+                break;
+            expire_next();
+        }
+    }
+
+    /**
+     * Number of spawned coroutines that are not done
+     */
+    uint32_t live() const {
+        return live_;
+    }
+
+    /* called by a spawned coroutine when it is done */
+    void retire() {
+        --live_;
+    }
+
+  private:
+    static constexpr uint32_t SlotMsk = WheelSlots - 1;
+    static_assert((WheelSlots & SlotMsk) == 0, "WheelSlots: power of two");
+
+    void push_ready(TimerNode* node) {
+        node->next = nullptr;
+        if (ready_tail_)
+            ready_tail_->next = node;
+        else
+            ready_head_ = node;
+        ready_tail_ = node;
+    }
+
+    void add_timer(TimerNode* node, uint64_t deadline_usec) {
+        uint64_t tick = deadline_usec / TickUsec;
+
+        node->deadline_usec = deadline_usec;
+        /* the slot of the current tick may already have been expired */
+        if (tick <= current_tick_) {
+            if (deadline_usec <= elapsed()) {
+                push_ready(node);
+                return;
+            }
+            tick = current_tick_;
+        }
+        node->next = wheel_[tick & SlotMsk];
+        wheel_[tick & SlotMsk] = node;
+        ++timers_;
+    }
+
+    /* advance the wheel to the next tick with a timer, wait for the latest
+     * deadline of that tick and make its coroutines ready by deadline */
+    void expire_next() {
+        TimerNode* expired = nullptr;
+
+        while (!expired) {
+            TimerNode** link = &wheel_[current_tick_ & SlotMsk];
+            while (*link) {
+                TimerNode* node = *link;
+                if (node->deadline_usec / TickUsec > current_tick_) {
+                    link = &node->next; /* a later round */
+                    continue;
+                }
+                *link = node->next;
+                --timers_;
+                /* sorted insert, stable for equal deadlines */
+                TimerNode** pos = &expired;
+                while (*pos && (*pos)->deadline_usec <= node->deadline_usec)
+                    pos = &(*pos)->next;
+                node->next = *pos;
+                *pos = node;
+            }
+            if (!expired)
+                ++current_tick_;
+        }
+
+        TimerNode* latest = expired;
+        while (latest->next)
+            latest = latest->next;
+        wait_until(latest->deadline_usec);
+        while (expired) {
+            TimerNode* node = expired;
+            expired = node->next;
+            push_ready(node);
+        }
+    }
+
+    void wait_until(uint64_t deadline_usec) {
+        uint64_t elapsed_usec = elapsed();
+        uint32_t remaining;
+
+        if (deadline_usec <= elapsed_usec)
+            return;
+        /* deadlines are at most one sleep of 2^32 - 1 microseconds ahead */
+        remaining = (uint32_t)(deadline_usec - elapsed_usec);
+        if (virtual_time_)
+            now_usec_ += remaining;
+        else
+            sensirion_sleep_usec(remaining);
+    }
+
+    void run_ready() {
+        while (ready_head_) {
+            TimerNode* node = ready_head_;
+            ready_head_ = node->next;
+            if (!ready_head_)
+                ready_tail_ = nullptr;
+            node->handle.resume();
+        }
+    }
+
+    bool virtual_time_;
+    uint32_t now_usec_;
+    uint32_t last_now_usec_;
+    uint64_t elapsed_usec_ = 0;
+    uint64_t current_tick_ = 0;
+    TimerNode* wheel_[WheelSlots];
+    TimerNode* ready_head_ = nullptr;
+    TimerNode* ready_tail_ = nullptr;
+    uint32_t timers_ = 0;
+    uint32_t live_ = 0;
+};
+
+/**
+ * Coroutine returning a T. It starts when it is awaited or spawned; an
+ * awaiting coroutine is resumed when it is done.
+ */
+template <typename T> class Task;
+
+namespace detail {
+
+template <typename T> struct FinalAwaiter {
+    bool await_ready() const noexcept {
+        return false;
+    }
+    template <typename Promise>
+    std::coroutine_handle<>
+    await_suspend(std::coroutine_handle<Promise> handle) noexcept {
+        auto& promise = handle.promise();
+        if (promise.continuation)
+            return promise.continuation;
+        if (promise.scheduler) {
+            promise.scheduler->retire();
+            handle.destroy();
+        }
+        return std::noop_coroutine();
+    }
+    void await_resume() const noexcept {
+    }
+};
+
+template <typename T> struct Promise : PromiseBase {
+    T value{};
+
+    Task<T> get_return_object();
+    FinalAwaiter<T> final_suspend() noexcept {
+        return {};
+    }
+    void return_value(T v) {
+        value = v;
+    }
+};
+
+template <> struct Promise<void> : PromiseBase {
+    Task<void> get_return_object();
+    FinalAwaiter<void> final_suspend() noexcept {
+        return {};
+    }
+    void return_void() {
+    }
+};
+
+} /* namespace detail */
+
+template <typename T> class Task {
+  public:
+    using promise_type = detail::Promise<T>;
+    using handle_type = std::coroutine_handle<promise_type>;
+
+    explicit Task(handle_type handle) : handle_(handle) {
+    }
+    Task(Task&& other) noexcept : handle_(other.handle_) {
+        other.handle_ = nullptr;
+    }
+    Task(const Task&) = delete;
+    Task& operator=(const Task&) = delete;
+    ~Task() {
+        if (handle_)
+            handle_.destroy();
+    }
+
+    bool await_ready() const noexcept {
+        return false;
+    }
+    std::coroutine_handle<>
+    await_suspend(std::coroutine_handle<> awaiting) noexcept {
+        handle_.promise().continuation = awaiting;
+        return handle_;
+    }
+    T await_resume() {
+        if constexpr (!std::is_void<T>::value)
+            return handle_.promise().value;
+    }
+
+    /* hand the coroutine over, see Scheduler::spawn() */
+    handle_type release() {
+        handle_type handle = handle_;
+        handle_ = nullptr;
+        return handle;
+    }
+
+  private:
+    handle_type handle_;
+};
+
+namespace detail {
+
+template <typename T> Task<T> Promise<T>::get_return_object() {
+    return Task<T>(std::coroutine_handle<Promise<T>>::from_promise(*this));
+}
+
+inline Task<void> Promise<void>::get_return_object() {
+    return Task<void>(
+        std::coroutine_handle<Promise<void>>::from_promise(*this));
+}
+
+/* the measure/read split of each driver */
+template <typename Dev> struct DevTraits;
+
+/* in periodic and ART mode the sensor measures by itself, the latest sample
+ * is fetched after the measurement duration */
+template <> struct DevTraits<sht3x_dev_t> {
+    static int16_t measure(sht3x_dev_t* dev) {
+        if (SHT3X_IS_PERIODIC_ACTIVE(dev->acq_state))
+            return STATUS_OK;
+        return sht3x_dev_measure(dev);
+    }
+    static int16_t read(sht3x_dev_t* dev, int32_t* t, int32_t* rh) {
+        if (SHT3X_IS_PERIODIC_ACTIVE(dev->acq_state))
+            return sht3x_dev_fetch_periodic(dev, t, rh);
+        return sht3x_dev_read(dev, t, rh);
+    }
+    static uint32_t duration_usec(const sht3x_dev_t* dev) {
+        return sht3x_dev_get_measurement_duration_usec(dev);
+    }
+};
+
+template <> struct DevTraits<sht4x_dev_t> {
+    static int16_t measure(sht4x_dev_t* dev) {
+        return sht4x_dev_measure(dev);
+    }
+    static int16_t read(sht4x_dev_t* dev, int32_t* t, int32_t* rh) {
+        return sht4x_dev_read(dev, t, rh);
+    }
+    static uint32_t duration_usec(const sht4x_dev_t* dev) {
+        return sht4x_dev_get_measurement_duration_usec(dev);
+    }
+};
+
+template <> struct DevTraits<shtc1_dev_t> {
+    static int16_t measure(shtc1_dev_t* dev) {
+        return shtc1_dev_measure(dev);
+    }
+    static int16_t read(shtc1_dev_t* dev, int32_t* t, int32_t* rh) {
+        return shtc1_dev_read(dev, t, rh);
+    }
+    static uint32_t duration_usec(const shtc1_dev_t* dev) {
+        return shtc1_dev_get_measurement_duration_usec(dev);
+    }
+};
+
+} /* namespace detail */
+
+/**
+ * Awaitable single shot measurements of a device context, see sht3x_dev_t,
+ * sht4x_dev_t and shtc1_dev_t. An SHT3x in periodic or ART mode fetches the
+ * latest sample, which fails if it was already fetched.
+ */
+template <typename Dev> class Sensor {
+  public:
+    Sensor(Scheduler& scheduler, Dev* dev) : scheduler_(scheduler), dev_(dev) {
+    }
+
+    /**
+     * Trigger a measurement, suspend for the conversion and read it
+     */
+    Task<Measurement> measure() {
+        Measurement m = {0, 0, 0};
+
+        m.status = detail::DevTraits<Dev>::measure(dev_);
+        if (m.status == STATUS_OK) {
+            co_await scheduler_.sleep(
+                detail::DevTraits<Dev>::duration_usec(dev_));
+            m.status = detail::DevTraits<Dev>::read(dev_, &m.temperature,
+                                                    &m.humidity);
+        }
+        co_return m;
+    }
+
+  private:
+    Scheduler& scheduler_;
+    Dev* dev_;
+};
+
+typedef Sensor<sht3x_dev_t> Sht3x;
+typedef Sensor<sht4x_dev_t> Sht4x;
+typedef Sensor<shtc1_dev_t> Shtc1;
+
+/**
+ * Awaitable measurements of a fleet sensor behind a multiplexer. The route
+ * is set up before each transaction, the routing state and the multiplexer
+ * addresses are shared by all sensors of the bus and have to outlive them.
+ * The multiplexers are reset whenever the routing state is unknown, e.g.
+ * after a failed write. An SHT3x in periodic mode fetches the latest sample.
+ */
+class FleetSensor {
+  public:
+    FleetSensor(Scheduler& scheduler, sht_fleet_sensor_t* sensor,
+                sht_mux_state_t* mux, const uint8_t* mux_addrs,
+                uint16_t num_muxes)
+        : scheduler_(scheduler), sensor_(sensor), mux_(mux),
+          mux_addrs_(mux_addrs), num_muxes_(num_muxes) {
+    }
+
+    Task<Measurement> measure() {
+        /* before the trigger, which may start ART mode */
+        uint32_t wait_usec = sht_fleet_sensor_wait_usec(sensor_);
+        Measurement m = {0, 0, 0};
+
+        m.status = route();
+        if (m.status == STATUS_OK)
+            m.status = sht_fleet_sensor_measure(sensor_);
+        if (m.status != STATUS_OK)
+            co_return m;
+
+        co_await scheduler_.sleep(wait_usec);
+        m.status = route();
+        if (m.status == STATUS_OK)
+            m.status = sht_fleet_sensor_read(sensor_, &m.temperature,
+                                             &m.humidity);
+        co_return m;
+    }
+
+  private:
+    int16_t route() {
+        if (!mux_->valid)
+            sht_mux_reset_all(mux_, mux_addrs_, num_muxes_);
+        return sht_mux_route(mux_, sensor_->mux_addr, sensor_->mux_channel);
+    }
+
+    Scheduler& scheduler_;
+    sht_fleet_sensor_t* sensor_;
+    sht_mux_state_t* mux_;
+    const uint8_t* mux_addrs_;
+    uint16_t num_muxes_;
+};
+
+} /* namespace coro */
+} /* namespace sht */
+
+#endif /* SHT_CORO_HPP */
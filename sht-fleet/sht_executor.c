@@ -0,0 +1,299 @@
+/*
+ * Copyright (c) 2026, Sensirion AG
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * * Redistributions of source code must retain the above copyright notice, this
+ *   list of conditions and the following disclaimer.
+ *
+ * * Redistributions in binary form must reproduce the above copyright notice,
+ *   this list of conditions and the following disclaimer in the documentation
+ *   and/or other materials provided with the distribution.
+ *
+ * * Neither the name of Sensirion AG nor the names of its
+ *   contributors may be used to endorse or promote products derived from
+ *   this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * \file
+ *
+ * \brief Bus executor for multi-threaded applications
+ *
+ * The queue is a bounded ring with a sequence number per slot: a producer
+ * claims a slot with a compare-and-swap on the enqueue position and
+ * publishes it by advancing the slot's sequence number, the worker frees it
+ * the same way. Producers never wait on each other for longer than a copy.
+ */
+
+#include <errno.h>
+
+#include "sht_executor.h"
+#include "sensirion_common.h"
+#include "sensirion_i2c.h"
+
+#define SHT_EXEC_QUEUE_MSK (SHT_EXEC_QUEUE_SIZE - 1U)
+
+#if (SHT_EXEC_QUEUE_SIZE & (SHT_EXEC_QUEUE_SIZE - 1)) != 0
+#error "SHT_EXEC_QUEUE_SIZE must be a power of two"
+#endif
+
+static void sht_exec_complete(sht_executor_t* exec,
+                              const sht_exec_request_t* request,
+                              const sht_fleet_result_t* result) {
+    ++exec->requests;
+    if (request->callback)
+        request->callback(request->user_data, result);
+    if (request->completion) {
+        request->completion->result = *result;
+        sem_post(&request->completion->done);
+    }
+}
+
+/* take all published requests, in submission order */
+static uint16_t sht_exec_take(sht_executor_t* exec,
+                              sht_exec_request_t* batch) {
+    uint16_t count = 0;
+
+    while (count < SHT_EXEC_QUEUE_SIZE) {
+        sht_exec_slot_t* slot =
+            &exec->slots[exec->dequeue_pos & SHT_EXEC_QUEUE_MSK];
+
+        if (__atomic_load_n(&slot->sequence, __ATOMIC_ACQUIRE) !=
+            exec->dequeue_pos + 1)
+            break;
+        batch[count++] = slot->request;
+        __atomic_store_n(&slot->sequence,
+                         exec->dequeue_pos + SHT_EXEC_QUEUE_SIZE,
+                         __ATOMIC_RELEASE);
+        exec->dequeue_pos++;
+    }
+    return count;
+}
+
+/* route to a sensor, resetting the multiplexers after a failed write first */
+static int16_t sht_exec_route(sht_executor_t* exec,
+                              const sht_fleet_sensor_t* sensor) {
+    if (!exec->mux.valid)
+        sht_mux_reset_all(&exec->mux, exec->mux_addrs, exec->num_muxes);
+    return sht_mux_route(&exec->mux, sensor->mux_addr, sensor->mux_channel);
+}
+
+/* measure each sensor once for all requests, trigger all and wait once */
+static void sht_exec_measure_all(sht_executor_t* exec,
+                                 const sht_exec_request_t* requests,
+                                 uint16_t count) {
+    sht_fleet_sensor_t* sensors[SHT_EXEC_QUEUE_SIZE];
+    sht_fleet_result_t results[SHT_EXEC_QUEUE_SIZE] = {{0, 0, 0}};
+    uint16_t num_sensors = 0;
+    uint32_t wait_usec = 0;
+    uint16_t i, j;
+
+    for (i = 0; i < count; ++i) {
+        for (j = 0; j < num_sensors && sensors[j] != requests[i].sensor; ++j) {
+        }
+        if (j == num_sensors)
+            sensors[num_sensors++] = requests[i].sensor;
+    }
+    exec->measurements += num_sensors;
+    exec->coalesced += (uint32_t)(count - num_sensors);
+
+    for (j = 0; j < num_sensors; ++j) {
+        /* before the trigger, which may start ART mode */
+        uint32_t sensor_wait_usec = sht_fleet_sensor_wait_usec(sensors[j]);
+
+        results[j].status = sht_exec_route(exec, sensors[j]);
+        if (results[j].status == STATUS_OK)
+            results[j].status = sht_fleet_sensor_measure(sensors[j]);
+        if (results[j].status == STATUS_OK && sensor_wait_usec > wait_usec)
+            wait_usec = sensor_wait_usec;
+    }
+
+    /* sensors that stretch the clock don't need to be waited for */
+    if (wait_usec)
+        sensirion_sleep_usec(wait_usec);
+
+    for (j = 0; j < num_sensors; ++j) {
+        if (results[j].status == STATUS_OK)
+            results[j].status = sht_exec_route(exec, sensors[j]);
+        if (results[j].status == STATUS_OK)
+            results[j].status = sht_fleet_sensor_read(
+                sensors[j], &results[j].temperature, &results[j].humidity);
+    }
+
+    for (i = 0; i < count; ++i) {
+        for (j = 0; sensors[j] != requests[i].sensor; ++j) {
+        }
+        sht_exec_complete(exec, &requests[i], &results[j]);
+    }
+}
+
+static void sht_exec_run_command(sht_executor_t* exec,
+                                 const sht_exec_request_t* request) {
+    sht_fleet_sensor_t* sensor = request->sensor;
+    sht_fleet_result_t result = {0, 0, 0};
+
+    result.status = sht_exec_route(exec, sensor);
+    if (result.status == STATUS_OK)
+        result.status = request->command(sensor, request->arg);
+    sht_exec_complete(exec, request, &result);
+}
+
+static void* sht_exec_worker(void* arg) {
+    sht_executor_t* exec = (sht_executor_t*)arg;
+    sht_exec_request_t batch[SHT_EXEC_QUEUE_SIZE];
+    uint16_t count, first, i;
+
+    sht_mux_reset_all(&exec->mux, exec->mux_addrs, exec->num_muxes);
+    for (;;) {
+        while (sem_wait(&exec->wakeup) != 0 && errno == EINTR) {
+        }
+        count = sht_exec_take(exec, batch);
+        if (!count) {
+            if (!__atomic_load_n(&exec->running, __ATOMIC_ACQUIRE))
+                break;
+            continue;
+        }
+
+        /* measurements between commands are run together */
+        first = 0;
+        for (i = 0; i < count; ++i) {
+            if (!batch[i].command)
+                continue;
+            if (i > first)
+                sht_exec_measure_all(exec, &batch[first], i - first);
+            sht_exec_run_command(exec, &batch[i]);
+            first = i + 1;
+        }
+        if (count > first)
+            sht_exec_measure_all(exec, &batch[first], count - first);
+    }
+    sht_mux_release(&exec->mux);
+    return NULL;
+}
+
+int16_t sht_exec_init(sht_executor_t* exec, uint8_t bus,
+                      const uint8_t* mux_addrs, uint16_t num_muxes) {
+    uint32_t i;
+
+    if (num_muxes > SHT_EXEC_MAX_MUXES)
+        return STATUS_ERR_INVALID_PARAMS;
+
+    for (i = 0; i < SHT_EXEC_QUEUE_SIZE; ++i)
+        exec->slots[i].sequence = i;
+    exec->enqueue_pos = 0;
+    exec->dequeue_pos = 0;
+    exec->running = 0;
+    sht_mux_init(&exec->mux, bus);
+    for (i = 0; i < num_muxes; ++i)
+        exec->mux_addrs[i] = mux_addrs[i];
+    exec->num_muxes = num_muxes;
+    exec->requests = 0;
+    exec->measurements = 0;
+    exec->coalesced = 0;
+    if (sem_init(&exec->wakeup, 0, 0) != 0)
+        return STATUS_ERR_BAD_DATA;
+    return STATUS_OK;
+}
+
+int16_t sht_exec_start(sht_executor_t* exec) {
+    __atomic_store_n(&exec->running, 1, __ATOMIC_RELEASE);
+    if (pthread_create(&exec->thread, NULL, sht_exec_worker, exec) != 0) {
+        exec->running = 0;
+        return STATUS_ERR_BAD_DATA;
+    }
+    return STATUS_OK;
+}
+
+void sht_exec_stop(sht_executor_t* exec) {
+    __atomic_store_n(&exec->running, 0, __ATOMIC_RELEASE);
+    sem_post(&exec->wakeup);
+    pthread_join(exec->thread, NULL);
+    sem_destroy(&exec->wakeup);
+}
+
+int16_t sht_exec_submit(sht_executor_t* exec,
+                        const sht_exec_request_t* request) {
+    uint32_t pos = __atomic_load_n(&exec->enqueue_pos, __ATOMIC_RELAXED);
+    sht_exec_slot_t* slot;
+
+    if (sht_fleet_sensor_bus(request->sensor) != exec->mux.bus)
+        return STATUS_ERR_INVALID_PARAMS;
+
+    for (;;) {
+        int32_t diff;
+
+        slot = &exec->slots[pos & SHT_EXEC_QUEUE_MSK];
+        diff = (int32_t)(__atomic_load_n(&slot->sequence, __ATOMIC_ACQUIRE) -
+                         pos);
+        if (diff == 0) {
+            /* the slot is free, claim it unless another producer was first */
+            if (__atomic_compare_exchange_n(&exec->enqueue_pos, &pos, pos + 1,
+                                            0, __ATOMIC_RELAXED,
+                                            __ATOMIC_RELAXED))
+                break;
+        } else if (diff < 0) {
+            /* the worker has not freed the slot of the previous round */
+            return STATUS_NOT_READY;
+        } else {
+            pos = __atomic_load_n(&exec->enqueue_pos, __ATOMIC_RELAXED);
+        }
+    }
+
+    slot->request = *request;
+    __atomic_store_n(&slot->sequence, pos + 1, __ATOMIC_RELEASE);
+    sem_post(&exec->wakeup);
+    return STATUS_OK;
+}
+
+void sht_exec_completion_init(sht_exec_completion_t* completion) {
+    completion->result.status = STATUS_OK;
+    completion->result.temperature = 0;
+    completion->result.humidity = 0;
+    sem_init(&completion->done, 0, 0);
+}
+
+int16_t sht_exec_completion_wait(sht_exec_completion_t* completion) {
+    while (sem_wait(&completion->done) != 0 && errno == EINTR) {
+    }
+    sem_destroy(&completion->done);
+    return completion->result.status;
+}
+
+int16_t sht_exec_measure(sht_executor_t* exec, sht_fleet_sensor_t* sensor,
+                         sht_fleet_result_t* result) {
+    sht_exec_completion_t completion;
+    sht_exec_request_t request;
+    int16_t ret;
+
+    request.sensor = sensor;
+    request.command = NULL;
+    request.arg = NULL;
+    request.completion = &completion;
+    request.callback = NULL;
+    request.user_data = NULL;
+
+    sht_exec_completion_init(&completion);
+    ret = sht_exec_submit(exec, &request);
+    if (ret) {
+        sem_destroy(&completion.done);
+        return ret;
+    }
+    ret = sht_exec_completion_wait(&completion);
+    *result = completion.result;
+    return ret;
+}
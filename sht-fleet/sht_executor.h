@@ -0,0 +1,216 @@
+/*
+ * Copyright (c) 2026, Sensirion AG
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * * Redistributions of source code must retain the above copyright notice, this
+ *   list of conditions and the following disclaimer.
+ *
+ * * Redistributions in binary form must reproduce the above copyright notice,
+ *   this list of conditions and the following disclaimer in the documentation
+ *   and/or other materials provided with the distribution.
+ *
+ * * Neither the name of Sensirion AG nor the names of its
+ *   contributors may be used to endorse or promote products derived from
+ *   this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * \file
+ *
+ * \brief Bus executor for multi-threaded applications
+ *
+ * The drivers and sensirion_i2c.h expect a single caller. The executor gives
+ * one I2C bus a worker thread that performs all of its transactions; any
+ * number of client threads submit requests through a lock-free bounded
+ * queue and get the results as completion records or callbacks.
+ *
+ * The worker takes all queued requests at once. Measurements between two
+ * commands are run like a sweep (trigger all, wait once, read all) and
+ * several measurement requests for the same sensor are served by a single
+ * measurement. Commands run in submission order.
+ *
+ * Requires POSIX threads and semaphores.
+ */
+
+#ifndef SHT_EXECUTOR_H
+#define SHT_EXECUTOR_H
+
+#include <pthread.h>
+#include <semaphore.h>
+
+#include "sensirion_arch_config.h"
+#include "sht_fleet.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * Queue capacity, a power of two
+ */
+#ifndef SHT_EXEC_QUEUE_SIZE
+#define SHT_EXEC_QUEUE_SIZE 64
+#endif
+
+/**
+ * Maximal number of multiplexers on the bus of an executor
+ */
+#ifndef SHT_EXEC_MAX_MUXES
+#define SHT_EXEC_MAX_MUXES 8
+#endif
+
+/**
+ * A command run on the worker thread with the route to the sensor set up,
+ * e.g. a wrapper around sht3x_dev_start_periodic()
+ */
+typedef int16_t (*sht_exec_command_t)(sht_fleet_sensor_t* sensor, void* arg);
+
+/**
+ * Called on the worker thread when a request is done. For commands, only the
+ * status of the result is set.
+ */
+typedef void (*sht_exec_callback_t)(void* user_data,
+                                    const sht_fleet_result_t* result);
+
+/**
+ * Completion record a client thread can wait on
+ */
+typedef struct sht_exec_completion {
+    sht_fleet_result_t result;
+    sem_t done;
+} sht_exec_completion_t;
+
+/**
+ * A request: measure the sensor if command is NULL, else run the command.
+ * The result is reported to the completion record and the callback, both
+ * are optional.
+ */
+typedef struct sht_exec_request {
+    sht_fleet_sensor_t* sensor;
+    sht_exec_command_t command;
+    void* arg;
+    sht_exec_completion_t* completion;
+    sht_exec_callback_t callback;
+    void* user_data;
+} sht_exec_request_t;
+
+/**
+ * Queue slot. The sequence number tells producers and the worker whose turn
+ * it is, so that no lock is needed.
+ */
+typedef struct sht_exec_slot {
+    uint32_t sequence;
+    sht_exec_request_t request;
+} sht_exec_slot_t;
+
+/**
+ * Executor of one bus. Initialize it with sht_exec_init() and treat the
+ * members as read-only.
+ */
+typedef struct sht_executor {
+    sht_exec_slot_t slots[SHT_EXEC_QUEUE_SIZE];
+    /* next slot to fill, shared by all producers */
+    uint32_t enqueue_pos;
+    /* next slot to take, worker only */
+    uint32_t dequeue_pos;
+    sem_t wakeup;
+    pthread_t thread;
+    uint8_t running;
+    sht_mux_state_t mux;
+    uint8_t mux_addrs[SHT_EXEC_MAX_MUXES];
+    uint16_t num_muxes;
+    /* requests done, sensor measurements made and measurement requests
+     * that were served by the measurement of another request */
+    uint32_t requests;
+    uint32_t measurements;
+    uint32_t coalesced;
+} sht_executor_t;
+
+/**
+ * Initialize an executor. Requests can be submitted before it is started.
+ *
+ * @param exec      the executor
+ * @param bus       the bus index, SHT_BUS_DEFAULT to use the current bus
+ * @param mux_addrs the multiplexer addresses on the bus, their channels are
+ *                  disabled when the worker starts
+ * @param num_muxes the number of multiplexer addresses
+ * @return          0 on success, STATUS_ERR_INVALID_PARAMS if there are too
+ *                  many multiplexers, else an error code
+ */
+int16_t sht_exec_init(sht_executor_t* exec, uint8_t bus,
+                      const uint8_t* mux_addrs, uint16_t num_muxes);
+
+/**
+ * Start the worker thread
+ *
+ * @param exec  the executor
+ * @return      0 on success, an error code otherwise
+ */
+int16_t sht_exec_start(sht_executor_t* exec);
+
+/**
+ * Stop the worker thread after it has done all submitted requests and
+ * release the executor
+ *
+ * @param exec  the executor
+ */
+void sht_exec_stop(sht_executor_t* exec);
+
+/**
+ * Submit a request, safe to call from any thread. The request is copied,
+ * the sensor, the completion record and the command argument have to stay
+ * valid until the request is done. All sensors have to be on the bus of the
+ * executor.
+ *
+ * @param exec      the executor
+ * @param request   the request
+ * @return          0 on success, STATUS_NOT_READY if the queue is full
+ */
+int16_t sht_exec_submit(sht_executor_t* exec,
+                        const sht_exec_request_t* request);
+
+/**
+ * Initialize a completion record before submitting a request with it
+ */
+void sht_exec_completion_init(sht_exec_completion_t* completion);
+
+/**
+ * Wait until the request of a completion record is done and release the
+ * record
+ *
+ * @param completion    the completion record
+ * @return              the status of the request
+ */
+int16_t sht_exec_completion_wait(sht_exec_completion_t* completion);
+
+/**
+ * Measure a sensor on the executor and wait for the result
+ *
+ * @param exec      the executor
+ * @param sensor    the sensor
+ * @param result    the result
+ * @return          the status of the measurement
+ */
+int16_t sht_exec_measure(sht_executor_t* exec, sht_fleet_sensor_t* sensor,
+                         sht_fleet_result_t* result);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* SHT_EXECUTOR_H */
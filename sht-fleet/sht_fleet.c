@@ -0,0 +1,298 @@
+/*
+ * Copyright (c) 2026, Sensirion AG
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * * Redistributions of source code must retain the above copyright notice, this
+ *   list of conditions and the following disclaimer.
+ *
+ * * Redistributions in binary form must reproduce the above copyright notice,
+ *   this list of conditions and the following disclaimer in the documentation
+ *   and/or other materials provided with the distribution.
+ *
+ * * Neither the name of Sensirion AG nor the names of its
+ *   contributors may be used to endorse or promote products derived from
+ *   this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * \file
+ *
+ * \brief Sensirion SHT sensor fleet implementation
+ */
+
+#include "sht_fleet.h"
+#include "sensirion_common.h"
+#include "sensirion_i2c.h"
+
+/* TCA9548A compatible multiplexers use the addresses 0x70 to 0x77 */
+#define SHT_FLEET_MAX_MUXES 8
+
+static uint8_t sht3x_periodic(const sht_fleet_sensor_t* sensor) {
+    return sensor->family == SHT_FAMILY_SHT3X &&
+           SHT3X_IS_PERIODIC_ACTIVE(sensor->dev.sht3x.acq_state);
+}
+
+void sht_fleet_sensor_init(sht_fleet_sensor_t* sensor, sht_family_t family,
+                           uint8_t addr, uint8_t bus, uint8_t mux_addr,
+                           uint8_t mux_channel) {
+    sensor->family = family;
+    sensor->mux_addr = mux_addr;
+    sensor->mux_channel = mux_channel;
+    switch (family) {
+        case SHT_FAMILY_SHT3X:
+            sht3x_dev_init(&sensor->dev.sht3x, (sht3x_i2c_addr_t)addr, bus);
+            break;
+        case SHT_FAMILY_SHT4X:
+            sht4x_dev_init(&sensor->dev.sht4x, addr, bus);
+            break;
+        default:
+            shtc1_dev_init(&sensor->dev.shtc1, bus);
+            break;
+    }
+}
+
+uint8_t sht_fleet_sensor_address(const sht_fleet_sensor_t* sensor) {
+    switch (sensor->family) {
+        case SHT_FAMILY_SHT3X:
+            return (uint8_t)sensor->dev.sht3x.addr;
+        case SHT_FAMILY_SHT4X:
+            return sensor->dev.sht4x.addr;
+        default:
+            return sensor->dev.shtc1.addr;
+    }
+}
+
+uint8_t sht_fleet_sensor_bus(const sht_fleet_sensor_t* sensor) {
+    switch (sensor->family) {
+        case SHT_FAMILY_SHT3X:
+            return sensor->dev.sht3x.bus;
+        case SHT_FAMILY_SHT4X:
+            return sensor->dev.sht4x.bus;
+        default:
+            return sensor->dev.shtc1.bus;
+    }
+}
+
+/* with clock stretching enabled, the single shot commands of the SHT3x and
+ * the SHTC1 hold the read until the result is ready; the SHT4x and the SHT3x
+ * in ART mode never stretch */
+static uint8_t sht_fleet_sensor_stretches(const sht_fleet_sensor_t* sensor) {
+#if USE_SENSIRION_CLOCK_STRETCHING
+    switch (sensor->family) {
+        case SHT_FAMILY_SHT3X:
+            return sensor->dev.sht3x.mode != SHT3X_MEAS_MODE_ART;
+        case SHT_FAMILY_SHT4X:
+            return 0;
+        default:
+            return 1;
+    }
+#else /* USE_SENSIRION_CLOCK_STRETCHING */
+    (void)sensor;
+    return 0;
+#endif /* USE_SENSIRION_CLOCK_STRETCHING */
+}
+
+uint32_t sht_fleet_sensor_wait_usec(const sht_fleet_sensor_t* sensor) {
+    if (sht_fleet_sensor_stretches(sensor))
+        return 0;
+
+    switch (sensor->family) {
+        case SHT_FAMILY_SHT3X:
+            if (sht3x_periodic(sensor) || sensor->dev.sht3x.poll.interval_usec)
+                return 0;
+            return sensor->dev.sht3x.measure_delay_usec;
+        case SHT_FAMILY_SHT4X:
+            if (sensor->dev.sht4x.poll.interval_usec)
+                return 0;
+            return sensor->dev.sht4x.measure_delay_usec;
+        default:
+            if (sensor->dev.shtc1.poll.interval_usec)
+                return 0;
+            return sensor->dev.shtc1.measure_delay_usec;
+    }
+}
+
+uint8_t sht_fleet_sensor_get_mode(const sht_fleet_sensor_t* sensor) {
+    switch (sensor->family) {
+        case SHT_FAMILY_SHT3X:
+            return sensor->dev.sht3x.mode;
+        case SHT_FAMILY_SHT4X:
+            return sensor->dev.sht4x.mode;
+        default:
+            return sensor->dev.shtc1.low_power;
+    }
+}
+
+void sht_fleet_sensor_set_mode(sht_fleet_sensor_t* sensor, uint8_t mode) {
+    switch (sensor->family) {
+        case SHT_FAMILY_SHT3X:
+            sht3x_dev_set_power_mode(&sensor->dev.sht3x,
+                                     (sht3x_measurement_mode_t)mode);
+            break;
+        case SHT_FAMILY_SHT4X:
+            sht4x_dev_set_power_mode(&sensor->dev.sht4x,
+                                     (sht4x_measurement_mode_t)mode);
+            break;
+        default:
+            shtc1_dev_enable_low_power_mode(&sensor->dev.shtc1, mode);
+            break;
+    }
+}
+
+int16_t sht_fleet_sensor_probe(sht_fleet_sensor_t* sensor) {
+    switch (sensor->family) {
+        case SHT_FAMILY_SHT3X:
+            return sht3x_dev_probe(&sensor->dev.sht3x);
+        case SHT_FAMILY_SHT4X:
+            return sht4x_dev_probe(&sensor->dev.sht4x);
+        default:
+            return shtc1_dev_probe(&sensor->dev.shtc1);
+    }
+}
+
+int16_t sht_fleet_sensor_measure(sht_fleet_sensor_t* sensor) {
+    switch (sensor->family) {
+        case SHT_FAMILY_SHT3X:
+            if (sht3x_periodic(sensor))
+                return STATUS_OK;
+            return sht3x_dev_measure(&sensor->dev.sht3x);
+        case SHT_FAMILY_SHT4X:
+            return sht4x_dev_measure(&sensor->dev.sht4x);
+        default:
+            return shtc1_dev_measure(&sensor->dev.shtc1);
+    }
+}
+
+int16_t sht_fleet_sensor_read(sht_fleet_sensor_t* sensor, int32_t* temperature,
+                              int32_t* humidity) {
+    switch (sensor->family) {
+        case SHT_FAMILY_SHT3X:
+            if (sht3x_periodic(sensor))
+                return sht3x_dev_fetch_periodic(&sensor->dev.sht3x,
+                                                temperature, humidity);
+            return sht3x_dev_read(&sensor->dev.sht3x, temperature, humidity);
+        case SHT_FAMILY_SHT4X:
+            return sht4x_dev_read(&sensor->dev.sht4x, temperature, humidity);
+        default:
+            return shtc1_dev_read(&sensor->dev.shtc1, temperature, humidity);
+    }
+}
+
+int16_t sht_fleet_sensor_read_serial(sht_fleet_sensor_t* sensor,
+                                     uint32_t* serial) {
+    switch (sensor->family) {
+        case SHT_FAMILY_SHT3X:
+            return sht3x_dev_read_serial(&sensor->dev.sht3x, serial);
+        case SHT_FAMILY_SHT4X:
+            return sht4x_dev_read_serial(&sensor->dev.sht4x, serial);
+        default:
+            return shtc1_dev_read_serial(&sensor->dev.shtc1, serial);
+    }
+}
+
+static void sht_fleet_reset_muxes(const sht_fleet_sensor_t* sensors,
+                                  uint16_t count, sht_mux_state_t* mux) {
+    uint8_t muxes[SHT_FLEET_MAX_MUXES] = {0};
+    uint16_t num_muxes = 0;
+    uint16_t i, j;
+
+    for (i = 0; i < count; ++i) {
+        if (sensors[i].mux_addr == SHT_MUX_NONE)
+            continue;
+        for (j = 0; j < num_muxes && muxes[j] != sensors[i].mux_addr; ++j) {
+        }
+        if (j == num_muxes && num_muxes < SHT_FLEET_MAX_MUXES)
+            muxes[num_muxes++] = sensors[i].mux_addr;
+    }
+    sht_mux_reset_all(mux, muxes, num_muxes);
+}
+
+int16_t sht_fleet_sweep(sht_fleet_sensor_t* sensors, uint16_t count,
+                        sht_mux_state_t* mux, sht_fleet_result_t* results) {
+    uint32_t wait_usec = 0;
+    int16_t failed = 0;
+    uint16_t i;
+
+    for (i = 0; i < count; ++i) {
+        if (sht_fleet_sensor_bus(&sensors[i]) != mux->bus)
+            return STATUS_ERR_INVALID_PARAMS;
+    }
+    if (!mux->valid)
+        sht_fleet_reset_muxes(sensors, count, mux);
+
+    /* trigger all */
+    for (i = 0; i < count; ++i) {
+        sht_fleet_result_t* result = &results[i];
+        /* before the trigger, which may start ART mode */
+        uint32_t sensor_wait_usec = sht_fleet_sensor_wait_usec(&sensors[i]);
+
+        result->status = sht_mux_route(mux, sensors[i].mux_addr,
+                                       sensors[i].mux_channel);
+        if (result->status == STATUS_OK)
+            result->status = sht_fleet_sensor_measure(&sensors[i]);
+        if (result->status == STATUS_OK && sensor_wait_usec > wait_usec)
+            wait_usec = sensor_wait_usec;
+    }
+
+    /* wait once, sensors that stretch the clock don't need to be waited for */
+    if (wait_usec)
+        sensirion_sleep_usec(wait_usec);
+
+    /* read all */
+    for (i = 0; i < count; ++i) {
+        sht_fleet_result_t* result = &results[i];
+
+        if (result->status == STATUS_OK)
+            result->status = sht_mux_route(mux, sensors[i].mux_addr,
+                                           sensors[i].mux_channel);
+        if (result->status == STATUS_OK)
+            result->status = sht_fleet_sensor_read(
+                &sensors[i], &result->temperature, &result->humidity);
+        if (result->status != STATUS_OK)
+            failed++;
+    }
+    return failed;
+}
+
+int16_t sht_fleet_set_alert_words(sht_fleet_sensor_t* sensors, uint16_t count,
+                                  sht_mux_state_t* mux, const uint16_t* words,
+                                  sht3x_verify_t verify, int16_t* results) {
+    int16_t failed = 0;
+    uint16_t i;
+
+    for (i = 0; i < count; ++i) {
+        if (sht_fleet_sensor_bus(&sensors[i]) != mux->bus)
+            return STATUS_ERR_INVALID_PARAMS;
+    }
+    if (!mux->valid)
+        sht_fleet_reset_muxes(sensors, count, mux);
+
+    for (i = 0; i < count; ++i) {
+        results[i] = STATUS_OK;
+        if (sensors[i].family != SHT_FAMILY_SHT3X)
+            continue;
+        results[i] =
+            sht_mux_route(mux, sensors[i].mux_addr, sensors[i].mux_channel);
+        if (results[i] == STATUS_OK)
+            results[i] = sht3x_dev_set_alert_words(&sensors[i].dev.sht3x,
+                                                   words, verify);
+        if (results[i] != STATUS_OK)
+            failed++;
+    }
+    return failed;
+}
@@ -0,0 +1,196 @@
+/*
+ * Copyright (c) 2026, Sensirion AG
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * * Redistributions of source code must retain the above copyright notice, this
+ *   list of conditions and the following disclaimer.
+ *
+ * * Redistributions in binary form must reproduce the above copyright notice,
+ *   this list of conditions and the following disclaimer in the documentation
+ *   and/or other materials provided with the distribution.
+ *
+ * * Neither the name of Sensirion AG nor the names of its
+ *   contributors may be used to endorse or promote products derived from
+ *   this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * \file
+ *
+ * \brief Sensirion SHT sensor fleet
+ *
+ * Drives a list of heterogeneous SHT3x, SHT4x and SHTC1 compatible sensors,
+ * each optionally behind an I2C multiplexer channel, through one interface.
+ * A sweep triggers all measurements back to back, waits once for the slowest
+ * conversion and then reads all results, so that it takes about one
+ * measurement duration plus bus time regardless of the number of sensors.
+ */
+
+#ifndef SHT_FLEET_H
+#define SHT_FLEET_H
+
+#include "sensirion_arch_config.h"
+#include "sht3x.h"
+#include "sht4x.h"
+#include "sht_mux.h"
+#include "shtc1.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * Sensor families handled by the fleet
+ */
+typedef enum _sht_family {
+    SHT_FAMILY_SHT3X,
+    SHT_FAMILY_SHT4X,
+    SHT_FAMILY_SHTC1 /* SHTC1, SHTW1, SHTW2 and SHTC3 */
+} sht_family_t;
+
+/**
+ * A sensor of the fleet: its family, multiplexer route and device context
+ */
+typedef struct sht_fleet_sensor {
+    sht_family_t family;
+    /* multiplexer address or SHT_MUX_NONE, and channel */
+    uint8_t mux_addr;
+    uint8_t mux_channel;
+    union {
+        sht3x_dev_t sht3x;
+        sht4x_dev_t sht4x;
+        shtc1_dev_t shtc1;
+    } dev;
+} sht_fleet_sensor_t;
+
+/**
+ * Result of one sensor in a sweep. Temperature is in [degree Celsius] and
+ * relative humidity in [percent relative humidity], both multiplied by 1000.
+ */
+typedef struct sht_fleet_result {
+    int16_t status;
+    int32_t temperature;
+    int32_t humidity;
+} sht_fleet_result_t;
+
+/**
+ * Initialize a sensor and its device context with the driver defaults. Use
+ * the family's *_dev_* functions on sensor->dev to change its settings.
+ *
+ * @param sensor        the sensor
+ * @param family        the sensor family
+ * @param addr          the sensor address (ignored for SHT_FAMILY_SHTC1)
+ * @param bus           the bus index, SHT_BUS_DEFAULT to use the current bus
+ * @param mux_addr      the multiplexer address or SHT_MUX_NONE
+ * @param mux_channel   the multiplexer channel
+ */
+void sht_fleet_sensor_init(sht_fleet_sensor_t* sensor, sht_family_t family,
+                           uint8_t addr, uint8_t bus, uint8_t mux_addr,
+                           uint8_t mux_channel);
+
+/**
+ * Return the I2C address of a sensor
+ */
+uint8_t sht_fleet_sensor_address(const sht_fleet_sensor_t* sensor);
+
+/**
+ * Return the bus index of a sensor
+ */
+uint8_t sht_fleet_sensor_bus(const sht_fleet_sensor_t* sensor);
+
+/**
+ * Return the time between triggering a measurement and reading its result,
+ * 0 for sensors that don't need to wait: SHT3x in periodic mode, sensors
+ * with NACK polling enabled and, with USE_SENSIRION_CLOCK_STRETCHING, sensors
+ * whose measurement command stretches the clock. Query it before
+ * sht_fleet_sensor_measure(), which starts ART mode on an SHT3x set to
+ * SHT3X_MEAS_MODE_ART.
+ */
+uint32_t sht_fleet_sensor_wait_usec(const sht_fleet_sensor_t* sensor);
+
+/**
+ * Return the measurement mode of a sensor: a sht3x_measurement_mode_t or
+ * sht4x_measurement_mode_t value, for SHTC1 1 in low power mode and 0
+ * otherwise.
+ */
+uint8_t sht_fleet_sensor_get_mode(const sht_fleet_sensor_t* sensor);
+
+/**
+ * Set the measurement mode of a sensor, see sht_fleet_sensor_get_mode()
+ */
+void sht_fleet_sensor_set_mode(sht_fleet_sensor_t* sensor, uint8_t mode);
+
+/**
+ * Family independent driver calls. The multiplexer route has to be set up,
+ * e.g. with sht_mux_route().
+ *
+ * sht_fleet_sensor_measure() does nothing for an SHT3x in periodic mode and
+ * sht_fleet_sensor_read() fetches the latest sample instead.
+ */
+int16_t sht_fleet_sensor_probe(sht_fleet_sensor_t* sensor);
+int16_t sht_fleet_sensor_measure(sht_fleet_sensor_t* sensor);
+int16_t sht_fleet_sensor_read(sht_fleet_sensor_t* sensor, int32_t* temperature,
+                              int32_t* humidity);
+int16_t sht_fleet_sensor_read_serial(sht_fleet_sensor_t* sensor,
+                                     uint32_t* serial);
+
+/**
+ * Measure all sensors of a bus: trigger every sensor, wait once for the
+ * slowest measurement and read every sensor that was triggered. Sensors are
+ * accessed in the given order, group them by multiplexer channel to avoid
+ * needless switching.
+ *
+ * If the multiplexer state is not known, all multiplexers used by the sensors
+ * are disabled first.
+ *
+ * @param sensors   the sensors, all on the bus of the multiplexer state
+ * @param count     the number of sensors
+ * @param mux       the routing state of the bus, kept across sweeps
+ * @param results   the results, one per sensor
+ * @return          0 if all sensors were measured, the number of sensors that
+ *                  failed otherwise, STATUS_ERR_INVALID_PARAMS if a sensor is
+ *                  on another bus
+ */
+int16_t sht_fleet_sweep(sht_fleet_sensor_t* sensors, uint16_t count,
+                        sht_mux_state_t* mux, sht_fleet_result_t* results);
+
+/**
+ * Program the same alert limits into all SHT3x of a bus with
+ * sht3x_dev_set_alert_words(). The limit words are computed once by the
+ * caller, e.g. with SHT3X_ALERT_LIMIT_WORD for constant thresholds. Sensors
+ * of other families are skipped and report STATUS_OK.
+ *
+ * @param sensors   the sensors, all on the bus of the multiplexer state
+ * @param count     the number of sensors
+ * @param mux       the routing state of the bus, kept across calls
+ * @param words     the limit words indexed by sht3x_alert_thd_t
+ * @param verify    the verification of the written limits
+ * @param results   the status of each sensor
+ * @return          0 if all limits were written, the number of sensors that
+ *                  failed otherwise, STATUS_ERR_INVALID_PARAMS if a sensor is
+ *                  on another bus
+ */
+int16_t sht_fleet_set_alert_words(sht_fleet_sensor_t* sensors, uint16_t count,
+                                  sht_mux_state_t* mux, const uint16_t* words,
+                                  sht3x_verify_t verify, int16_t* results);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* SHT_FLEET_H */
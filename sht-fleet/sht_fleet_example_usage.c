@@ -0,0 +1,82 @@
+/*
+ * Copyright (c) 2020, Sensirion AG
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * * Redistributions of source code must retain the above copyright notice, this
+ *   list of conditions and the following disclaimer.
+ *
+ * * Redistributions in binary form must reproduce the above copyright notice,
+ *   this list of conditions and the following disclaimer in the documentation
+ *   and/or other materials provided with the distribution.
+ *
+ * * Neither the name of Sensirion AG nor the names of its
+ *   contributors may be used to endorse or promote products derived from
+ *   this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+
+#include "sht_fleet.h"
+#include <stdio.h>  // printf
+
+/**
+ * TO USE CONSOLE OUTPUT (PRINTF) AND WAIT (SLEEP) PLEASE ADAPT THEM TO YOUR
+ * PLATFORM
+ */
+
+/* Adapt the sensor list to your board. Sensors sharing an address have to be
+ * on different multiplexer channels.
+ */
+#define NUM_SENSORS 3
+
+int main(void) {
+    sht_fleet_sensor_t sensors[NUM_SENSORS];
+    sht_fleet_result_t results[NUM_SENSORS];
+    sht_mux_state_t mux;
+    uint16_t i;
+
+    /* Initialize the i2c bus for the current platform */
+    sensirion_i2c_init();
+
+    sht_mux_init(&mux, SHT_BUS_DEFAULT);
+    sht_fleet_sensor_init(&sensors[0], SHT_FAMILY_SHT3X, SHT3X_I2C_ADDR_DFLT,
+                          SHT_BUS_DEFAULT, 0x70, 0);
+    sht_fleet_sensor_init(&sensors[1], SHT_FAMILY_SHT4X, 0x44,
+                          SHT_BUS_DEFAULT, 0x70, 1);
+    sht_fleet_sensor_init(&sensors[2], SHT_FAMILY_SHTC1, 0x70,
+                          SHT_BUS_DEFAULT, 0x70, 2);
+
+    while (1) {
+        /* Trigger all sensors, wait once and read all results (each output
+         * multiplied by 1000).
+         */
+        sht_fleet_sweep(sensors, NUM_SENSORS, &mux, results);
+        for (i = 0; i < NUM_SENSORS; ++i) {
+            if (results[i].status == STATUS_OK) {
+                printf("sensor %u: measured temperature: %0.2f degreeCelsius, "
+                       "measured humidity: %0.2f percentRH\n",
+                       i, results[i].temperature / 1000.0f,
+                       results[i].humidity / 1000.0f);
+            } else {
+                printf("sensor %u: error reading measurement\n", i);
+            }
+        }
+
+        sensirion_sleep_usec(1000000); /* sleep 1s */
+    }
+    return 0;
+}
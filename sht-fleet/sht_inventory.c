@@ -0,0 +1,175 @@
+/*
+ * Copyright (c) 2026, Sensirion AG
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * * Redistributions of source code must retain the above copyright notice, this
+ *   list of conditions and the following disclaimer.
+ *
+ * * Redistributions in binary form must reproduce the above copyright notice,
+ *   this list of conditions and the following disclaimer in the documentation
+ *   and/or other materials provided with the distribution.
+ *
+ * * Neither the name of Sensirion AG nor the names of its
+ *   contributors may be used to endorse or promote products derived from
+ *   this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * \file
+ *
+ * \brief Persistent sensor inventory for hosts with a file system
+ *
+ * File format, one sensor per line after the header:
+ *
+ *     # sht-inventory 2
+ *     <family> <address> <mux address> <mux channel> <serial> <mode> <state>
+ *     <periodic command>
+ *
+ * on one line, with the family as sht3x, sht4x or shtc1, addresses and serial
+ * in hex, the mode as returned by sht_fleet_sensor_get_mode(), the SHT3x
+ * acquisition state and the SHT3x periodic acquisition command in hex, which
+ * is needed to restart the acquisition after a reset (both 0 for the other
+ * families).
+ */
+
+#include <stdio.h>
+#include <string.h>
+
+#include "sht_inventory.h"
+
+#define SHT_INVENTORY_HEADER "# sht-inventory 2\n"
+#define SHT_INVENTORY_LINE_LEN 80
+
+static const char* const SHT_INVENTORY_FAMILIES[] = {"sht3x", "sht4x",
+                                                     "shtc1"};
+
+int16_t sht_inventory_save(const sht_topology_t* topology, const char* path) {
+    FILE* file = fopen(path, "w");
+    int failed;
+    uint16_t i;
+
+    if (!file)
+        return STATUS_ERR_BAD_DATA;
+
+    failed = fputs(SHT_INVENTORY_HEADER, file) < 0;
+    for (i = 0; i < topology->count && !failed; ++i) {
+        const sht_fleet_sensor_t* sensor = &topology->sensors[i];
+        uint8_t state = 0;
+        uint16_t cmd_periodic = 0;
+
+        if (sensor->family == SHT_FAMILY_SHT3X) {
+            state = sensor->dev.sht3x.acq_state;
+            cmd_periodic = sensor->dev.sht3x.cmd_periodic;
+        }
+        failed = fprintf(file, "%s 0x%02x 0x%02x %u 0x%08lx %u %u 0x%04x\n",
+                         SHT_INVENTORY_FAMILIES[sensor->family],
+                         sht_fleet_sensor_address(sensor), sensor->mux_addr,
+                         sensor->mux_channel,
+                         (unsigned long)topology->serials[i],
+                         sht_fleet_sensor_get_mode(sensor), state,
+                         cmd_periodic) < 0;
+    }
+    if (fclose(file) != 0)
+        failed = 1;
+    return failed ? STATUS_ERR_BAD_DATA : STATUS_OK;
+}
+
+int16_t sht_inventory_load(sht_topology_t* topology, const char* path) {
+    char line[SHT_INVENTORY_LINE_LEN];
+    FILE* file = fopen(path, "r");
+    int16_t ret = STATUS_OK;
+
+    if (!file)
+        return STATUS_ERR_BAD_DATA;
+
+    topology->count = 0;
+    if (!fgets(line, sizeof(line), file) ||
+        strcmp(line, SHT_INVENTORY_HEADER) != 0)
+        ret = STATUS_ERR_BAD_DATA;
+
+    while (ret == STATUS_OK && fgets(line, sizeof(line), file)) {
+        char family_name[8];
+        unsigned int addr, mux_addr, channel, mode, state, cmd_periodic;
+        unsigned long serial;
+        uint16_t family;
+        int16_t i;
+
+        if (sscanf(line, "%7s %x %x %u %lx %u %u %x", family_name, &addr,
+                   &mux_addr, &channel, &serial, &mode, &state,
+                   &cmd_periodic) != 8 ||
+            addr > 0x7F || mux_addr > 0x7F || channel > 7 ||
+            cmd_periodic > 0xFFFF) {
+            ret = STATUS_ERR_BAD_DATA;
+            break;
+        }
+        for (family = 0; family < 3; ++family) {
+            if (strcmp(family_name, SHT_INVENTORY_FAMILIES[family]) == 0)
+                break;
+        }
+        /* a periodic acquisition can't be restarted without its command */
+        if (family == 3 || (family == SHT_FAMILY_SHT3X &&
+                            SHT3X_IS_PERIODIC_ACTIVE(state) && !cmd_periodic)) {
+            ret = STATUS_ERR_BAD_DATA;
+            break;
+        }
+
+        i = sht_topology_add(topology, (sht_family_t)family, (uint8_t)addr,
+                             (uint8_t)mux_addr, (uint8_t)channel,
+                             (uint32_t)serial);
+        if (i < 0) {
+            ret = i;
+            break;
+        }
+        sht_fleet_sensor_set_mode(&topology->sensors[i], (uint8_t)mode);
+        if (family == SHT_FAMILY_SHT3X) {
+            topology->sensors[i].dev.sht3x.acq_state = (uint8_t)state;
+            topology->sensors[i].dev.sht3x.cmd_periodic =
+                (uint16_t)cmd_periodic;
+        }
+    }
+    fclose(file);
+
+    if (ret != STATUS_OK) {
+        topology->count = 0;
+        return ret;
+    }
+    return (int16_t)topology->count;
+}
+
+int16_t sht_inventory_restore(sht_topology_t* topology, const char* path,
+                              uint8_t* cached) {
+    int16_t ret;
+
+    if (cached)
+        *cached = 0;
+
+    ret = sht_inventory_load(topology, path);
+    if (ret >= 0) {
+        int16_t mismatches = sht_topology_verify(topology);
+        if (mismatches == 0) {
+            if (cached)
+                *cached = 1;
+            return ret;
+        }
+    }
+
+    ret = sht_topology_discover(topology);
+    if (ret >= 0)
+        (void)sht_inventory_save(topology, path);
+    return ret;
+}
@@ -0,0 +1,94 @@
+/*
+ * Copyright (c) 2026, Sensirion AG
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * * Redistributions of source code must retain the above copyright notice, this
+ *   list of conditions and the following disclaimer.
+ *
+ * * Redistributions in binary form must reproduce the above copyright notice,
+ *   this list of conditions and the following disclaimer in the documentation
+ *   and/or other materials provided with the distribution.
+ *
+ * * Neither the name of Sensirion AG nor the names of its
+ *   contributors may be used to endorse or promote products derived from
+ *   this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * \file
+ *
+ * \brief Persistent sensor inventory for hosts with a file system
+ *
+ * Stores the sensors of a topology (family, address, multiplexer channel,
+ * serial number and measurement mode) in a text file, one sensor per line.
+ * On restart the inventory is verified with one command per sensor instead of
+ * a full discovery, which also skips the multi-transaction serial number
+ * reads.
+ */
+
+#ifndef SHT_INVENTORY_H
+#define SHT_INVENTORY_H
+
+#include "sensirion_arch_config.h"
+#include "sht_topology.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * Write the sensors of a topology to an inventory file
+ *
+ * @param topology  the topology
+ * @param path      the inventory file
+ * @return          0 on success, STATUS_ERR_BAD_DATA if the file could not be
+ *                  written
+ */
+int16_t sht_inventory_save(const sht_topology_t* topology, const char* path);
+
+/**
+ * Replace the sensors of a topology with the ones of an inventory file. The
+ * multiplexer addresses of the topology are kept.
+ *
+ * @param topology  the topology, initialized with sht_topology_init()
+ * @param path      the inventory file
+ * @return          the number of sensors loaded, STATUS_ERR_BAD_DATA if the
+ *                  file could not be read or is malformed
+ */
+int16_t sht_inventory_load(sht_topology_t* topology, const char* path);
+
+/**
+ * Load the inventory file and verify it with sht_topology_verify(). If the
+ * file is missing or a sensor does not answer as recorded, run a full
+ * discovery and write the new inventory.
+ *
+ * @param topology  the topology, initialized with sht_topology_init()
+ * @param path      the inventory file
+ * @param cached    set to 1 if the inventory was used, 0 if the bus was
+ *                  discovered, may be NULL
+ * @return          the number of sensors, an error code if the bus could not
+ *                  be selected
+ */
+int16_t sht_inventory_restore(sht_topology_t* topology, const char* path,
+                              uint8_t* cached);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* SHT_INVENTORY_H */
@@ -0,0 +1,104 @@
+/*
+ * Copyright (c) 2026, Sensirion AG
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * * Redistributions of source code must retain the above copyright notice, this
+ *   list of conditions and the following disclaimer.
+ *
+ * * Redistributions in binary form must reproduce the above copyright notice,
+ *   this list of conditions and the following disclaimer in the documentation
+ *   and/or other materials provided with the distribution.
+ *
+ * * Neither the name of Sensirion AG nor the names of its
+ *   contributors may be used to endorse or promote products derived from
+ *   this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * \file
+ *
+ * \brief I2C multiplexer routing for sensor fleets
+ */
+
+#include "sht_mux.h"
+#include "sensirion_common.h"
+#include "sensirion_i2c.h"
+#include "sht_dev.h"
+
+static int16_t sht_mux_write(sht_mux_state_t* state, uint8_t mux_addr,
+                             uint8_t control) {
+    state->switches++;
+    return sensirion_i2c_write(mux_addr, &control, 1);
+}
+
+void sht_mux_init(sht_mux_state_t* state, uint8_t bus) {
+    state->bus = bus;
+    state->valid = 0;
+    state->mux_addr = SHT_MUX_NONE;
+    state->channel = 0;
+    state->switches = 0;
+}
+
+void sht_mux_reset_all(sht_mux_state_t* state, const uint8_t* mux_addrs,
+                       uint16_t count) {
+    uint16_t i;
+
+    if (sht_dev_select_bus(state->bus) != NO_ERROR)
+        return;
+    for (i = 0; i < count; ++i) {
+        if (mux_addrs[i] != SHT_MUX_NONE)
+            (void)sht_mux_write(state, mux_addrs[i], 0);
+    }
+    state->valid = 1;
+    state->mux_addr = SHT_MUX_NONE;
+}
+
+int16_t sht_mux_route(sht_mux_state_t* state, uint8_t mux_addr,
+                      uint8_t channel) {
+    int16_t ret = sht_dev_select_bus(state->bus);
+    if (ret)
+        return ret;
+
+    if (state->valid && state->mux_addr == mux_addr &&
+        (mux_addr == SHT_MUX_NONE || state->channel == channel))
+        return NO_ERROR;
+
+    /* without a known state only the target multiplexer is written */
+    if (state->valid && state->mux_addr != SHT_MUX_NONE &&
+        state->mux_addr != mux_addr) {
+        ret = sht_mux_write(state, state->mux_addr, 0);
+        if (ret) {
+            state->valid = 0;
+            return ret;
+        }
+    }
+    if (mux_addr != SHT_MUX_NONE) {
+        ret = sht_mux_write(state, mux_addr, (uint8_t)(1U << (channel & 7U)));
+        if (ret) {
+            state->valid = 0;
+            return ret;
+        }
+    }
+    state->mux_addr = mux_addr;
+    state->channel = channel;
+    return NO_ERROR;
+}
+
+int16_t sht_mux_release(sht_mux_state_t* state) {
+    return sht_mux_route(state, SHT_MUX_NONE, 0);
+}
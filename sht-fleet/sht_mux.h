@@ -0,0 +1,119 @@
+/*
+ * Copyright (c) 2026, Sensirion AG
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * * Redistributions of source code must retain the above copyright notice, this
+ *   list of conditions and the following disclaimer.
+ *
+ * * Redistributions in binary form must reproduce the above copyright notice,
+ *   this list of conditions and the following disclaimer in the documentation
+ *   and/or other materials provided with the distribution.
+ *
+ * * Neither the name of Sensirion AG nor the names of its
+ *   contributors may be used to endorse or promote products derived from
+ *   this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * \file
+ *
+ * \brief I2C multiplexer routing for sensor fleets
+ *
+ * Tracks which channel of which TCA9548A compatible multiplexer is enabled on
+ * a bus, so that consecutive accesses to sensors behind the same channel don't
+ * switch the multiplexer again. Only one channel of one multiplexer is enabled
+ * at a time, which allows sensors with the same address behind different
+ * channels or multiplexers.
+ */
+
+#ifndef SHT_MUX_H
+#define SHT_MUX_H
+
+#include "sensirion_arch_config.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * Multiplexer address of a sensor that is directly connected to the bus
+ */
+#define SHT_MUX_NONE 0x00
+
+/**
+ * Routing state of one bus
+ */
+typedef struct sht_mux_state {
+    /* bus index passed to sensirion_i2c_select_bus() or SHT_BUS_DEFAULT */
+    uint8_t bus;
+    /* 0 until the state of the multiplexers is known */
+    uint8_t valid;
+    /* the enabled multiplexer and channel, SHT_MUX_NONE if all are off */
+    uint8_t mux_addr;
+    uint8_t channel;
+    /* number of control writes to multiplexers */
+    uint32_t switches;
+} sht_mux_state_t;
+
+/**
+ * Initialize the routing state of a bus. The multiplexer configuration is
+ * unknown until sht_mux_reset_all() is called.
+ *
+ * @param state the routing state
+ * @param bus   the bus index, SHT_BUS_DEFAULT to use the current bus
+ */
+void sht_mux_init(sht_mux_state_t* state, uint8_t bus);
+
+/**
+ * Disable all channels of the given multiplexers and mark the routing state
+ * as known. Multiplexers that don't answer are ignored.
+ *
+ * @param state     the routing state
+ * @param mux_addrs the multiplexer addresses on the bus
+ * @param count     the number of multiplexer addresses
+ */
+void sht_mux_reset_all(sht_mux_state_t* state, const uint8_t* mux_addrs,
+                       uint16_t count);
+
+/**
+ * Route the bus to a multiplexer channel: select the bus, disable the
+ * previously enabled multiplexer if it is a different one and enable the
+ * channel. Nothing is written if the channel is already enabled.
+ *
+ * @param state     the routing state
+ * @param mux_addr  the multiplexer address or SHT_MUX_NONE for a sensor that
+ *                  is directly connected to the bus
+ * @param channel   the multiplexer channel, 0 to 7
+ * @return          0 on success, an error code otherwise
+ */
+int16_t sht_mux_route(sht_mux_state_t* state, uint8_t mux_addr,
+                      uint8_t channel);
+
+/**
+ * Disable the enabled multiplexer channel, if any
+ *
+ * @param state the routing state
+ * @return      0 on success, an error code otherwise
+ */
+int16_t sht_mux_release(sht_mux_state_t* state);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* SHT_MUX_H */
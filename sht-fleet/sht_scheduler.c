@@ -0,0 +1,207 @@
+/*
+ * Copyright (c) 2026, Sensirion AG
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * * Redistributions of source code must retain the above copyright notice, this
+ *   list of conditions and the following disclaimer.
+ *
+ * * Redistributions in binary form must reproduce the above copyright notice,
+ *   this list of conditions and the following disclaimer in the documentation
+ *   and/or other materials provided with the distribution.
+ *
+ * * Neither the name of Sensirion AG nor the names of its
+ *   contributors may be used to endorse or promote products derived from
+ *   this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * \file
+ *
+ * \brief Parallel sweeps over several I2C buses
+ *
+ * Post-processing is not queued: the results of a bus become available all
+ * at once when its sweep is done, and any worker claims the next one with an
+ * atomic increment of the bus' post_next index. Workers look at their own
+ * bus first and then at the others, so that the workers of fast buses help
+ * out with the results of slow ones. A worker without work sleeps until the
+ * next bus is swept and stops once all buses are swept and claimed.
+ */
+
+#include "sht_scheduler.h"
+#include "sensirion_common.h"
+#include "sensirion_i2c.h"
+#include "sht_time.h"
+
+/* post-process one result, return 0 if no result was left to claim */
+static uint8_t sht_sched_post_one(sht_scheduler_t* sched,
+                                  sht_sched_bus_t* self) {
+    uint8_t i;
+
+    for (i = 0; i < sched->num_buses; ++i) {
+        sht_sched_bus_t* bus =
+            &sched->buses[(self->index + i) % sched->num_buses];
+        uint32_t job;
+
+        if (!__atomic_load_n(&bus->swept, __ATOMIC_ACQUIRE) ||
+            __atomic_load_n(&bus->post_next, __ATOMIC_RELAXED) >= bus->count)
+            continue;
+        job = __atomic_fetch_add(&bus->post_next, 1, __ATOMIC_RELAXED);
+        if (job >= bus->count)
+            continue;
+
+        ++self->post_jobs;
+        if (bus != self)
+            ++self->stolen;
+        if (bus->results[job].status == STATUS_OK)
+            sched->post(sched->user_data, &bus->sensors[job],
+                        &bus->results[job]);
+        return 1;
+    }
+    return 0;
+}
+
+/* publish the results of a bus and wake up the idle workers */
+static void sht_sched_mark_swept(sht_scheduler_t* sched,
+                                 sht_sched_bus_t* bus) {
+    if (bus->failed < 0)
+        bus->post_next = bus->count;
+    pthread_mutex_lock(&sched->lock);
+    __atomic_store_n(&bus->swept, 1, __ATOMIC_RELEASE);
+    __atomic_add_fetch(&sched->num_swept, 1, __ATOMIC_RELEASE);
+    pthread_cond_broadcast(&sched->swept_cond);
+    pthread_mutex_unlock(&sched->lock);
+}
+
+static void* sht_sched_worker(void* arg) {
+    sht_sched_bus_t* bus = (sht_sched_bus_t*)arg;
+    sht_scheduler_t* sched = bus->sched;
+    uint32_t start;
+    uint8_t seen;
+
+    /* the bus selection is per thread, it also selects the bus clock */
+    sht_dev_select_bus(bus->mux.bus);
+    start = sht_time_now_usec();
+    bus->failed =
+        sht_fleet_sweep(bus->sensors, bus->count, &bus->mux, bus->results);
+    bus->sweep_usec = sht_time_now_usec() - start;
+    sht_sched_mark_swept(sched, bus);
+
+    for (;;) {
+        /* read before looking for work, so that no sweep is missed */
+        seen = __atomic_load_n(&sched->num_swept, __ATOMIC_ACQUIRE);
+        if (sht_sched_post_one(sched, bus))
+            continue;
+
+        pthread_mutex_lock(&sched->lock);
+        if (sched->num_swept == sched->num_buses) {
+            pthread_mutex_unlock(&sched->lock);
+            break;
+        }
+        while (sched->num_swept == seen)
+            pthread_cond_wait(&sched->swept_cond, &sched->lock);
+        pthread_mutex_unlock(&sched->lock);
+    }
+    return NULL;
+}
+
+int16_t sht_sched_init(sht_scheduler_t* sched, sht_sched_post_t post,
+                       void* user_data) {
+    sched->num_buses = 0;
+    sched->post = post;
+    sched->user_data = user_data;
+    sched->num_swept = 0;
+    sched->sweep_usec = 0;
+    if (pthread_mutex_init(&sched->lock, NULL) != 0)
+        return STATUS_ERR_BAD_DATA;
+    if (pthread_cond_init(&sched->swept_cond, NULL) != 0) {
+        pthread_mutex_destroy(&sched->lock);
+        return STATUS_ERR_BAD_DATA;
+    }
+    return STATUS_OK;
+}
+
+int16_t sht_sched_add_bus(sht_scheduler_t* sched, uint8_t bus,
+                          sht_fleet_sensor_t* sensors, uint16_t count,
+                          sht_fleet_result_t* results) {
+    sht_sched_bus_t* sched_bus;
+
+    if (sched->num_buses >= SHT_SCHED_MAX_BUSES || bus == SHT_BUS_DEFAULT)
+        return STATUS_ERR_INVALID_PARAMS;
+
+    sched_bus = &sched->buses[sched->num_buses];
+    sched_bus->sched = sched;
+    sched_bus->index = sched->num_buses;
+    sched_bus->sensors = sensors;
+    sched_bus->count = count;
+    sched_bus->results = results;
+    sht_mux_init(&sched_bus->mux, bus);
+    sched_bus->failed = 0;
+    sched_bus->sweep_usec = 0;
+    sched_bus->post_jobs = 0;
+    sched_bus->stolen = 0;
+    sched->num_buses++;
+    return STATUS_OK;
+}
+
+int16_t sht_sched_sweep(sht_scheduler_t* sched) {
+    int16_t failed = 0;
+    uint8_t started, i;
+
+    sched->num_swept = 0;
+    sched->sweep_usec = 0;
+    for (i = 0; i < sched->num_buses; ++i) {
+        sht_sched_bus_t* bus = &sched->buses[i];
+
+        bus->swept = 0;
+        /* without post-processing there is nothing to claim */
+        bus->post_next = sched->post ? 0 : bus->count;
+        bus->sweep_usec = 0;
+        bus->post_jobs = 0;
+        bus->stolen = 0;
+    }
+
+    for (started = 0; started < sched->num_buses; ++started) {
+        if (pthread_create(&sched->buses[started].thread, NULL,
+                           sht_sched_worker, &sched->buses[started]) != 0)
+            break;
+    }
+    /* buses without a worker count as swept so that the others can stop */
+    for (i = started; i < sched->num_buses; ++i) {
+        sched->buses[i].failed = STATUS_ERR_BAD_DATA;
+        sht_sched_mark_swept(sched, &sched->buses[i]);
+    }
+
+    for (i = 0; i < sched->num_buses; ++i) {
+        const sht_sched_bus_t* bus = &sched->buses[i];
+
+        if (i < started)
+            pthread_join(bus->thread, NULL);
+        if (bus->sweep_usec > sched->sweep_usec)
+            sched->sweep_usec = bus->sweep_usec;
+        if (bus->failed < 0 && failed >= 0)
+            failed = bus->failed;
+        else if (bus->failed > 0 && failed >= 0)
+            failed = (int16_t)(failed + bus->failed);
+    }
+    return failed;
+}
+
+void sht_sched_release(sht_scheduler_t* sched) {
+    pthread_cond_destroy(&sched->swept_cond);
+    pthread_mutex_destroy(&sched->lock);
+}
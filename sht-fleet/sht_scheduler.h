@@ -0,0 +1,168 @@
+/*
+ * Copyright (c) 2026, Sensirion AG
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * * Redistributions of source code must retain the above copyright notice, this
+ *   list of conditions and the following disclaimer.
+ *
+ * * Redistributions in binary form must reproduce the above copyright notice,
+ *   this list of conditions and the following disclaimer in the documentation
+ *   and/or other materials provided with the distribution.
+ *
+ * * Neither the name of Sensirion AG nor the names of its
+ *   contributors may be used to endorse or promote products derived from
+ *   this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * \file
+ *
+ * \brief Parallel sweeps over several I2C buses
+ *
+ * The scheduler gives every bus its own worker thread that sweeps the
+ * sensors of that bus with sht_fleet_sweep(), so that the buses are used in
+ * parallel and a sweep over all buses takes about as long as the sweep of the
+ * slowest bus. The results are then post-processed, e.g. converted or
+ * aggregated, by a user function: a worker that is done with its own bus
+ * takes over the pending post-processing of the buses that are still busy.
+ *
+ * The I2C implementation has to keep the bus selection per thread, see
+ * sht_dev_select_bus(). Requires POSIX threads.
+ */
+
+#ifndef SHT_SCHEDULER_H
+#define SHT_SCHEDULER_H
+
+#include <pthread.h>
+
+#include "sensirion_arch_config.h"
+#include "sht_fleet.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * Maximal number of buses of a scheduler
+ */
+#ifndef SHT_SCHED_MAX_BUSES
+#define SHT_SCHED_MAX_BUSES 4
+#endif
+
+/**
+ * Post-processing of a successful measurement, e.g. a conversion to other
+ * units or the aggregation into a statistic. Called on any worker thread and
+ * possibly concurrently for different sensors, shared state has to be
+ * protected.
+ */
+typedef void (*sht_sched_post_t)(void* user_data, sht_fleet_sensor_t* sensor,
+                                 sht_fleet_result_t* result);
+
+struct sht_scheduler;
+
+/**
+ * A bus of the scheduler and the state of its worker
+ */
+typedef struct sht_sched_bus {
+    struct sht_scheduler* sched;
+    uint8_t index;
+    sht_fleet_sensor_t* sensors;
+    uint16_t count;
+    sht_fleet_result_t* results;
+    sht_mux_state_t mux;
+    pthread_t thread;
+    /* set once the results of the bus are ready for post-processing */
+    uint8_t swept;
+    /* next result to post-process, claimed by any worker */
+    uint32_t post_next;
+    /* result of sht_fleet_sweep() and its duration on this bus */
+    int16_t failed;
+    uint32_t sweep_usec;
+    /* results post-processed by this worker, of which from other buses */
+    uint32_t post_jobs;
+    uint32_t stolen;
+} sht_sched_bus_t;
+
+/**
+ * Scheduler of several buses. Initialize it with sht_sched_init() and treat
+ * the members as read-only.
+ */
+typedef struct sht_scheduler {
+    sht_sched_bus_t buses[SHT_SCHED_MAX_BUSES];
+    uint8_t num_buses;
+    sht_sched_post_t post;
+    void* user_data;
+    pthread_mutex_t lock;
+    pthread_cond_t swept_cond;
+    uint8_t num_swept;
+    /* duration of the last sweep: the longest sweep of a bus */
+    uint32_t sweep_usec;
+} sht_scheduler_t;
+
+/**
+ * Initialize a scheduler without buses
+ *
+ * @param sched     the scheduler
+ * @param post      the post-processing function or NULL
+ * @param user_data passed to the post-processing function
+ * @return          0 on success, an error code otherwise
+ */
+int16_t sht_sched_init(sht_scheduler_t* sched, sht_sched_post_t post,
+                       void* user_data);
+
+/**
+ * Add a bus to the scheduler. The sensors and results have to stay valid
+ * while the scheduler is used. The multiplexer routing state of the bus is
+ * kept across sweeps.
+ *
+ * @param sched     the scheduler
+ * @param bus       the bus index, each worker selects its bus explicitly so
+ *                  SHT_BUS_DEFAULT is not allowed
+ * @param sensors   the sensors, all on the bus
+ * @param count     the number of sensors
+ * @param results   the results, one per sensor
+ * @return          0 on success, STATUS_ERR_INVALID_PARAMS if there are too
+ *                  many buses or the bus is SHT_BUS_DEFAULT
+ */
+int16_t sht_sched_add_bus(sht_scheduler_t* sched, uint8_t bus,
+                          sht_fleet_sensor_t* sensors, uint16_t count,
+                          sht_fleet_result_t* results);
+
+/**
+ * Sweep all buses in parallel and post-process the results, blocks until
+ * all results are done. The workers are started for each sweep.
+ *
+ * @param sched     the scheduler
+ * @return          0 if all sensors were measured, the number of sensors that
+ *                  failed otherwise, STATUS_ERR_INVALID_PARAMS if a sensor is
+ *                  on another bus, else an error code
+ */
+int16_t sht_sched_sweep(sht_scheduler_t* sched);
+
+/**
+ * Release a scheduler
+ *
+ * @param sched     the scheduler
+ */
+void sht_sched_release(sht_scheduler_t* sched);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* SHT_SCHEDULER_H */
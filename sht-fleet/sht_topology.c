@@ -0,0 +1,379 @@
+/*
+ * Copyright (c) 2026, Sensirion AG
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * * Redistributions of source code must retain the above copyright notice, this
+ *   list of conditions and the following disclaimer.
+ *
+ * * Redistributions in binary form must reproduce the above copyright notice,
+ *   this list of conditions and the following disclaimer in the documentation
+ *   and/or other materials provided with the distribution.
+ *
+ * * Neither the name of Sensirion AG nor the names of its
+ *   contributors may be used to endorse or promote products derived from
+ *   this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * \file
+ *
+ * \brief Sensor topology of a bus with multiplexers
+ */
+
+#include "sht_topology.h"
+#include "sensirion_common.h"
+#include "sensirion_i2c.h"
+#include "sht_dev.h"
+
+/* identification commands not exported by the drivers */
+#define SHT3X_CMD_READ_STATUS_REG 0xF32D
+#define SHTC1_CMD_READ_ID 0xEFC8
+#define SHTC1_ID_MASK 0x003F
+#define SHTC1_ID_VALUE 0x0007
+#define SHT_TOPOLOGY_CMD_DURATION_USEC 1000
+
+#define SHTC1_ADDRESS 0x70
+
+/* candidate addresses scanned on every channel */
+static const uint8_t SHT_TOPOLOGY_ADDRS[] = {0x44, 0x45, 0x46, SHTC1_ADDRESS};
+#define SHT_TOPOLOGY_SHT3X_MAX_ADDR 0x45
+
+/* group index of a multiplexer channel: directly connected sensors first,
+ * then the multiplexers in the configured order */
+static uint16_t sht_topology_group(const sht_topology_t* topology,
+                                   uint8_t mux_addr, uint8_t mux_channel) {
+    uint16_t i;
+
+    if (mux_addr == SHT_MUX_NONE)
+        return 0;
+    for (i = 0; i < topology->num_muxes; ++i) {
+        if (topology->mux_addrs[i] == mux_addr)
+            break;
+    }
+    return (uint16_t)(1 + i * SHT_TOPOLOGY_MUX_CHANNELS + mux_channel);
+}
+
+static uint8_t sht_topology_is_mux(const sht_topology_t* topology,
+                                   uint8_t addr) {
+    uint16_t i;
+
+    for (i = 0; i < topology->num_muxes; ++i) {
+        if (topology->mux_addrs[i] == addr)
+            return 1;
+    }
+    return 0;
+}
+
+void sht_topology_init(sht_topology_t* topology, uint8_t bus,
+                       const uint8_t* mux_addrs, uint8_t num_muxes) {
+    uint8_t i;
+
+    if (num_muxes > SHT_TOPOLOGY_MAX_MUXES)
+        num_muxes = SHT_TOPOLOGY_MAX_MUXES;
+    for (i = 0; i < num_muxes; ++i)
+        topology->mux_addrs[i] = mux_addrs[i];
+    topology->num_muxes = num_muxes;
+    topology->count = 0;
+    sht_mux_init(&topology->mux, bus);
+}
+
+int16_t sht_topology_add(sht_topology_t* topology, sht_family_t family,
+                         uint8_t addr, uint8_t mux_addr, uint8_t mux_channel,
+                         uint32_t serial) {
+    uint16_t group = sht_topology_group(topology, mux_addr, mux_channel);
+    uint16_t i;
+
+    if (topology->count >= SHT_TOPOLOGY_MAX_SENSORS)
+        return STATUS_ERR_INVALID_PARAMS;
+
+    /* insert after the last sensor of the same or a lower group */
+    for (i = topology->count; i > 0; --i) {
+        const sht_fleet_sensor_t* prev = &topology->sensors[i - 1];
+        if (sht_topology_group(topology, prev->mux_addr, prev->mux_channel) <=
+            group)
+            break;
+        topology->sensors[i] = *prev;
+        topology->serials[i] = topology->serials[i - 1];
+    }
+    sht_fleet_sensor_init(&topology->sensors[i], family, addr,
+                          topology->mux.bus, mux_addr, mux_channel);
+    topology->serials[i] = serial;
+    topology->count++;
+    return (int16_t)i;
+}
+
+/* Send the serial number command of the family answering at the address and
+ * append the sensor to the topology if one acknowledges. */
+static void sht_topology_request_serial(sht_topology_t* topology, uint8_t addr,
+                                        uint8_t mux_addr, uint8_t channel) {
+    const uint16_t otp_pointer[] = {SHTC1_OTP_SERIAL_POINTER};
+    const uint8_t sht4x_cmd = SHT4X_CMD_READ_SERIAL;
+    sht_family_t family;
+
+    if (addr == SHTC1_ADDRESS) {
+        /* a sleeping SHTC3 only acknowledges the wake up command */
+        (void)sensirion_i2c_write_cmd(addr, SHTC3_CMD_WAKEUP);
+        if (sensirion_i2c_write_cmd_with_args(
+                addr, SHTC1_CMD_SET_OTP_POINTER, otp_pointer,
+                SENSIRION_NUM_WORDS(otp_pointer)) != NO_ERROR)
+            return;
+        family = SHT_FAMILY_SHTC1;
+    } else if (addr <= SHT_TOPOLOGY_SHT3X_MAX_ADDR &&
+               sensirion_i2c_write_cmd(addr, SHT3X_CMD_READ_SERIAL_ID) ==
+                   NO_ERROR) {
+        family = SHT_FAMILY_SHT3X;
+    } else if (sensirion_i2c_write(addr, &sht4x_cmd, 1) == NO_ERROR) {
+        family = SHT_FAMILY_SHT4X;
+    } else {
+        return;
+    }
+    topology->serials[topology->count] = 0;
+    sht_fleet_sensor_init(&topology->sensors[topology->count++], family, addr,
+                          topology->mux.bus, mux_addr, channel);
+}
+
+static int16_t sht_topology_route(sht_topology_t* topology, uint16_t group) {
+    if (group == 0)
+        return sht_mux_route(&topology->mux, SHT_MUX_NONE, 0);
+    group--;
+    return sht_mux_route(&topology->mux,
+                         topology->mux_addrs[group / SHT_TOPOLOGY_MUX_CHANNELS],
+                         (uint8_t)(group % SHT_TOPOLOGY_MUX_CHANNELS));
+}
+
+static int16_t sht_topology_route_sensor(sht_topology_t* topology,
+                                         uint16_t i) {
+    return sht_mux_route(&topology->mux, topology->sensors[i].mux_addr,
+                         topology->sensors[i].mux_channel);
+}
+
+int16_t sht_topology_discover(sht_topology_t* topology) {
+    uint16_t num_groups =
+        (uint16_t)(1 + topology->num_muxes * SHT_TOPOLOGY_MUX_CHANNELS);
+    uint16_t word;
+    uint16_t group;
+    uint16_t i, j;
+    uint8_t found[SHT_TOPOLOGY_MAX_SENSORS];
+    uint8_t on_root[sizeof(SHT_TOPOLOGY_ADDRS)] = {0};
+    uint8_t shtc1_pending = 0;
+    int16_t ret;
+
+    ret = sht_dev_select_bus(topology->mux.bus);
+    if (ret)
+        return ret;
+    sht_mux_reset_all(&topology->mux, topology->mux_addrs,
+                      topology->num_muxes);
+    topology->count = 0;
+
+    /* send the serial number command to every candidate. A sensor on the
+     * root bus answers on every channel too, its address is not scanned
+     * behind the multiplexers. */
+    for (group = 0; group < num_groups; ++group) {
+        if (sht_topology_route(topology, group))
+            continue;
+        for (j = 0; j < sizeof(SHT_TOPOLOGY_ADDRS); ++j) {
+            uint8_t addr = SHT_TOPOLOGY_ADDRS[j];
+            uint16_t count = topology->count;
+
+            if (count >= SHT_TOPOLOGY_MAX_SENSORS)
+                break;
+            if (on_root[j] || sht_topology_is_mux(topology, addr))
+                continue;
+            sht_topology_request_serial(topology, addr, topology->mux.mux_addr,
+                                        topology->mux.channel);
+            if (group == 0 && topology->count > count)
+                on_root[j] = 1;
+        }
+    }
+    sensirion_sleep_usec(SHT_TOPOLOGY_CMD_DURATION_USEC);
+
+    /* collect the SHT3x and SHT4x serials, SHTC1 reads the serial one word
+     * at a time */
+    for (i = 0; i < topology->count; ++i) {
+        uint16_t words[2];
+        sht_fleet_sensor_t* sensor = &topology->sensors[i];
+
+        found[i] = 0;
+        if (sht_topology_route_sensor(topology, i))
+            continue;
+        if (sensor->family == SHT_FAMILY_SHTC1) {
+            if (sensirion_i2c_write_cmd(sht_fleet_sensor_address(sensor),
+                                        SHTC1_CMD_READ_OTP) == NO_ERROR) {
+                found[i] = 1;
+                shtc1_pending = 1;
+            }
+        } else if (sensirion_i2c_read_words(sht_fleet_sensor_address(sensor),
+                                            words, 2) == NO_ERROR) {
+            topology->serials[i] = ((uint32_t)words[0] << 16) | words[1];
+            found[i] = 1;
+        }
+    }
+
+    for (word = 0; word < 2 && shtc1_pending; ++word) {
+        sensirion_sleep_usec(SHT_TOPOLOGY_CMD_DURATION_USEC);
+        for (i = 0; i < topology->count; ++i) {
+            sht_fleet_sensor_t* sensor = &topology->sensors[i];
+            uint8_t addr = sht_fleet_sensor_address(sensor);
+            uint16_t serial_word;
+
+            if (!found[i] || sensor->family != SHT_FAMILY_SHTC1)
+                continue;
+            if (sht_topology_route_sensor(topology, i) ||
+                sensirion_i2c_read_words(addr, &serial_word, 1) != NO_ERROR ||
+                (word == 0 && sensirion_i2c_write_cmd(
+                                  addr, SHTC1_CMD_READ_OTP) != NO_ERROR)) {
+                found[i] = 0;
+                continue;
+            }
+            topology->serials[i] = (topology->serials[i] << 16) | serial_word;
+        }
+    }
+
+    /* drop the candidates that did not answer */
+    for (i = 0, j = 0; i < topology->count; ++i) {
+        if (!found[i])
+            continue;
+        topology->sensors[j] = topology->sensors[i];
+        topology->serials[j] = topology->serials[i];
+        j++;
+    }
+    topology->count = j;
+    return (int16_t)j;
+}
+
+/* a periodic SHT3x that reports a reset is back in single shot mode: check
+ * its serial and restart the acquisition with sht3x_dev_check_reset() */
+static int16_t sht_topology_verify_reset(sht_topology_t* topology,
+                                         const uint8_t* reset) {
+    uint8_t sent[SHT_TOPOLOGY_MAX_SENSORS];
+    int16_t mismatches = 0;
+    uint16_t i;
+
+    for (i = 0; i < topology->count; ++i) {
+        sent[i] = reset[i] &&
+                  sht_topology_route_sensor(topology, i) == NO_ERROR &&
+                  sensirion_i2c_write_cmd(
+                      sht_fleet_sensor_address(&topology->sensors[i]),
+                      SHT3X_CMD_READ_SERIAL_ID) == NO_ERROR;
+    }
+    sensirion_sleep_usec(SHT_TOPOLOGY_CMD_DURATION_USEC);
+
+    for (i = 0; i < topology->count; ++i) {
+        sht3x_dev_t* dev = &topology->sensors[i].dev.sht3x;
+        uint16_t words[2];
+        uint16_t status;
+        uint8_t match = 0;
+
+        if (!reset[i])
+            continue;
+        if (sent[i] && sht_topology_route_sensor(topology, i) == NO_ERROR) {
+            match = sensirion_i2c_read_words(dev->addr, words, 2) ==
+                        NO_ERROR &&
+                    (((uint32_t)words[0] << 16) | words[1]) ==
+                        topology->serials[i];
+        }
+        if (match)
+            match = sht3x_dev_check_reset(dev, &status) == STATUS_OK;
+        if (!match)
+            mismatches++;
+    }
+    return mismatches;
+}
+
+int16_t sht_topology_verify(sht_topology_t* topology) {
+    const uint8_t sht4x_cmd = SHT4X_CMD_READ_SERIAL;
+    uint8_t sent[SHT_TOPOLOGY_MAX_SENSORS];
+    uint8_t reset[SHT_TOPOLOGY_MAX_SENSORS] = {0};
+    uint16_t num_reset = 0;
+    int16_t mismatches = 0;
+    int16_t ret;
+    uint16_t i;
+
+    ret = sht_dev_select_bus(topology->mux.bus);
+    if (ret)
+        return ret;
+    if (!topology->mux.valid)
+        sht_mux_reset_all(&topology->mux, topology->mux_addrs,
+                          topology->num_muxes);
+
+    for (i = 0; i < topology->count; ++i) {
+        const sht_fleet_sensor_t* sensor = &topology->sensors[i];
+        uint8_t addr = sht_fleet_sensor_address(sensor);
+
+        ret = sht_topology_route_sensor(topology, i);
+        if (ret == NO_ERROR) {
+            switch (sensor->family) {
+                case SHT_FAMILY_SHT3X:
+                    ret = sensirion_i2c_write_cmd(
+                        addr, SHT3X_IS_PERIODIC_ACTIVE(
+                                  sensor->dev.sht3x.acq_state)
+                                  ? SHT3X_CMD_READ_STATUS_REG
+                                  : SHT3X_CMD_READ_SERIAL_ID);
+                    break;
+                case SHT_FAMILY_SHT4X:
+                    ret = sensirion_i2c_write(addr, &sht4x_cmd, 1);
+                    break;
+                default:
+                    (void)sensirion_i2c_write_cmd(addr, SHTC3_CMD_WAKEUP);
+                    ret = sensirion_i2c_write_cmd(addr, SHTC1_CMD_READ_ID);
+                    break;
+            }
+        }
+        sent[i] = ret == NO_ERROR;
+    }
+    sensirion_sleep_usec(SHT_TOPOLOGY_CMD_DURATION_USEC);
+
+    for (i = 0; i < topology->count; ++i) {
+        const sht_fleet_sensor_t* sensor = &topology->sensors[i];
+        uint16_t words[2];
+        uint8_t match = 0;
+
+        if (sent[i] && sht_topology_route_sensor(topology, i) == NO_ERROR) {
+            uint8_t addr = sht_fleet_sensor_address(sensor);
+
+            if (sensor->family == SHT_FAMILY_SHT3X &&
+                SHT3X_IS_PERIODIC_ACTIVE(sensor->dev.sht3x.acq_state)) {
+                /* the serial can't be read during the acquisition */
+                match = sensirion_i2c_read_words(addr, words, 1) == NO_ERROR;
+                if (match && SHT3X_IS_SYSTEM_RST_DETECT(words[0])) {
+                    reset[i] = 1;
+                    num_reset++;
+                    continue;
+                }
+            } else if (sensor->family == SHT_FAMILY_SHTC1) {
+                match = sensirion_i2c_read_words(addr, words, 1) == NO_ERROR &&
+                        (words[0] & SHTC1_ID_MASK) == SHTC1_ID_VALUE;
+            } else {
+                match = sensirion_i2c_read_words(addr, words, 2) == NO_ERROR &&
+                        (((uint32_t)words[0] << 16) | words[1]) ==
+                            topology->serials[i];
+            }
+        }
+        if (!match)
+            mismatches++;
+    }
+    if (num_reset)
+        mismatches += sht_topology_verify_reset(topology, reset);
+    return mismatches;
+}
+
+int16_t sht_topology_sweep(sht_topology_t* topology,
+                           sht_fleet_result_t* results) {
+    return sht_fleet_sweep(topology->sensors, topology->count, &topology->mux,
+                           results);
+}
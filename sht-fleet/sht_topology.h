@@ -0,0 +1,148 @@
+/*
+ * Copyright (c) 2026, Sensirion AG
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * * Redistributions of source code must retain the above copyright notice, this
+ *   list of conditions and the following disclaimer.
+ *
+ * * Redistributions in binary form must reproduce the above copyright notice,
+ *   this list of conditions and the following disclaimer in the documentation
+ *   and/or other materials provided with the distribution.
+ *
+ * * Neither the name of Sensirion AG nor the names of its
+ *   contributors may be used to endorse or promote products derived from
+ *   this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * \file
+ *
+ * \brief Sensor topology of a bus with multiplexers
+ *
+ * Records which sensors sit behind which multiplexer channel of a bus, either
+ * found by sht_topology_discover() or added by the application. Sensors are
+ * kept grouped by multiplexer and channel, so that a sweep over the topology
+ * switches each channel only once per phase.
+ */
+
+#ifndef SHT_TOPOLOGY_H
+#define SHT_TOPOLOGY_H
+
+#include "sensirion_arch_config.h"
+#include "sht_fleet.h"
+#include "sht_mux.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#ifndef SHT_TOPOLOGY_MAX_SENSORS
+#define SHT_TOPOLOGY_MAX_SENSORS 32
+#endif
+
+/* TCA9548A compatible multiplexers use the addresses 0x70 to 0x77 */
+#define SHT_TOPOLOGY_MAX_MUXES 8
+#define SHT_TOPOLOGY_MUX_CHANNELS 8
+
+/**
+ * Sensors of one bus
+ */
+typedef struct sht_topology {
+    sht_mux_state_t mux;
+    uint8_t mux_addrs[SHT_TOPOLOGY_MAX_MUXES];
+    uint8_t num_muxes;
+    uint16_t count;
+    sht_fleet_sensor_t sensors[SHT_TOPOLOGY_MAX_SENSORS];
+    uint32_t serials[SHT_TOPOLOGY_MAX_SENSORS];
+} sht_topology_t;
+
+/**
+ * Initialize an empty topology
+ *
+ * @param topology  the topology
+ * @param bus       the bus index, SHT_BUS_DEFAULT to use the current bus
+ * @param mux_addrs the multiplexer addresses on the bus
+ * @param num_muxes the number of multiplexers, at most SHT_TOPOLOGY_MAX_MUXES
+ */
+void sht_topology_init(sht_topology_t* topology, uint8_t bus,
+                       const uint8_t* mux_addrs, uint8_t num_muxes);
+
+/**
+ * Add a sensor behind its multiplexer channel group
+ *
+ * @param topology      the topology
+ * @param family        the sensor family
+ * @param addr          the sensor address
+ * @param mux_addr      the multiplexer address or SHT_MUX_NONE
+ * @param mux_channel   the multiplexer channel
+ * @param serial        the serial number, 0 if unknown
+ * @return              the index of the sensor, STATUS_ERR_INVALID_PARAMS
+ *                      if the topology is full
+ */
+int16_t sht_topology_add(sht_topology_t* topology, sht_family_t family,
+                         uint8_t addr, uint8_t mux_addr, uint8_t mux_channel,
+                         uint32_t serial);
+
+/**
+ * Scan the bus and every channel of the multiplexers for SHT3x, SHT4x and
+ * SHTC1 compatible sensors and replace the sensors of the topology with the
+ * ones found.
+ *
+ * The serial number command is sent to all candidate addresses of all
+ * channels before the results are collected, so the scan waits for the
+ * command durations once instead of once per sensor and family.
+ * Addresses that collide with a multiplexer address are not scanned.
+ *
+ * @param topology  the topology
+ * @return          the number of sensors found, an error code if the bus
+ *                  could not be selected
+ */
+int16_t sht_topology_discover(sht_topology_t* topology);
+
+/**
+ * Check that the sensors of the topology still answer as recorded, with one
+ * command per sensor and a single wait for all of them. SHT3x and SHT4x
+ * sensors have to report their recorded serial number, SHTC1 compatible
+ * sensors a valid ID register and SHT3x sensors in periodic mode a status
+ * register without a reset. A periodic SHT3x that reports a reset has to
+ * report its serial number as well and is re-provisioned with
+ * sht3x_dev_check_reset(), which restarts the acquisition.
+ *
+ * @param topology  the topology
+ * @return          0 if all sensors answered as recorded, the number of
+ *                  sensors that did not otherwise, an error code if the bus
+ *                  could not be selected
+ */
+int16_t sht_topology_verify(sht_topology_t* topology);
+
+/**
+ * Measure all sensors of the topology, see sht_fleet_sweep()
+ *
+ * @param topology  the topology
+ * @param results   the results, one per sensor
+ * @return          0 if all sensors were measured, the number of sensors that
+ *                  failed otherwise
+ */
+int16_t sht_topology_sweep(sht_topology_t* topology,
+                           sht_fleet_result_t* results);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* SHT_TOPOLOGY_H */
@@ -42,25 +42,41 @@
 #include "sensirion_arch_config.h"
 #include "sensirion_common.h"
 #include "sensirion_i2c.h"
+#include "sht_time.h"
 
 /* all measurement commands return T (CRC) RH (CRC) */
 #if USE_SENSIRION_CLOCK_STRETCHING
-#define SHT3X_CMD_MEASURE_HPM 0x2C06
-#define SHT3X_CMD_MEASURE_MPM 0x2C0D
-#define SHT3X_CMD_MEASURE_LPM 0x2C10
+#define SHT3X_CMD_MEASURE_HPM SHT3X_CMD_MEASURE_HPM_STRETCH
+#define SHT3X_CMD_MEASURE_MPM SHT3X_CMD_MEASURE_MPM_STRETCH
+#define SHT3X_CMD_MEASURE_LPM SHT3X_CMD_MEASURE_LPM_STRETCH
 #else /* USE_SENSIRION_CLOCK_STRETCHING */
-#define SHT3X_CMD_MEASURE_HPM 0x2400
-#define SHT3X_CMD_MEASURE_MPM 0x240B
-#define SHT3X_CMD_MEASURE_LPM 0x2416
+#define SHT3X_CMD_MEASURE_HPM SHT3X_CMD_MEASURE_HPM_NO_STRETCH
+#define SHT3X_CMD_MEASURE_MPM SHT3X_CMD_MEASURE_MPM_NO_STRETCH
+#define SHT3X_CMD_MEASURE_LPM SHT3X_CMD_MEASURE_LPM_NO_STRETCH
 #endif /* USE_SENSIRION_CLOCK_STRETCHING */
+#define SHT3X_CMD_ART 0x2B32
+
+/* acquisition states, see SHT3X_IS_PERIODIC_ACTIVE and SHT3X_IS_ART_ACTIVE */
+#define SHT3X_STATE_SINGLE_SHOT 0x00U
+#define SHT3X_STATE_PERIODIC 0x01U
+#define SHT3X_STATE_ART 0x03U
+
+/* event modes, see sht3x_dev_start_event_mode */
+#define SHT3X_EVENT_OFF 0x00U
+#define SHT3X_EVENT_ON_STATUS 0x01U
+#define SHT3X_EVENT_ON_PIN 0x02U
 
 #define SHT3X_HUMIDITY_LIMIT_MSK 0xFE00U
 #define SHT3X_TEMPERATURE_LIMIT_MSK 0x01FFU
 
+/* the temperature and humidity word of a fetch, each followed by its CRC */
+#define SHT3X_ART_READ_LEN 6
+
+static const uint16_t SHT3X_CMD_FETCH_DATA = 0xE000;
+static const uint16_t SHT3X_CMD_BREAK = 0x3093;
 static const uint16_t SHT3X_CMD_READ_STATUS_REG = 0xF32D;
 static const uint16_t SHT3X_CMD_CLR_STATUS_REG = 0x3041;
-static const uint16_t SHT3X_CMD_READ_SERIAL_ID = 0x3780;
-static const uint16_t SHT3X_CMD_DURATION_USEC = 1000;
+static const uint16_t SHT3X_ART_POLL_INTERVAL_USEC = 10000;
 /* read commands for the alert settings */
 static const uint16_t SHT3X_CMD_READ_HIALRT_LIM_SET = 0xE11F;
 static const uint16_t SHT3X_CMD_READ_HIALRT_LIM_CLR = 0xE114;
@@ -72,80 +88,746 @@ static const uint16_t SHT3X_CMD_WRITE_HIALRT_LIM_CLR = 0x6116;
 static const uint16_t SHT3X_CMD_WRITE_LOALRT_LIM_CLR = 0x610B;
 static const uint16_t SHT3X_CMD_WRITE_LOALRT_LIM_SET = 0x6100;
 
-static uint16_t sht3x_cmd_measure = SHT3X_CMD_MEASURE_HPM;
+/* periodic acquisition commands by rate (mps) and repeatability (LPM..HPM) */
+static const uint16_t SHT3X_CMD_PERIODIC[][3] = {
+    {0x202F, 0x2024, 0x2032}, /* 0.5 mps */
+    {0x212D, 0x2126, 0x2130}, /* 1 mps */
+    {0x222B, 0x2220, 0x2236}, /* 2 mps */
+    {0x2329, 0x2322, 0x2334}, /* 4 mps */
+    {0x272A, 0x2721, 0x2737}, /* 10 mps */
+};
+
+/* contexts behind the address based API */
+static sht3x_dev_t sht3x_default_dev[] = {
+    {SHT3X_I2C_ADDR_DFLT, SHT_BUS_DEFAULT, SHT3X_CMD_MEASURE_HPM,
+     SHT3X_MEASUREMENT_DURATION_USEC, SHT3X_MEAS_MODE_HPM,
+     SHT3X_STATE_SINGLE_SHOT, {0, 0, 0},
+     {0, 0}, 0, 0, SHT3X_EVENT_OFF, 0, 0, {0, 0, 0, 0}, 0, 0},
+    {SHT3X_I2C_ADDR_ALT, SHT_BUS_DEFAULT, SHT3X_CMD_MEASURE_HPM,
+     SHT3X_MEASUREMENT_DURATION_USEC, SHT3X_MEAS_MODE_HPM,
+     SHT3X_STATE_SINGLE_SHOT, {0, 0, 0},
+     {0, 0}, 0, 0, SHT3X_EVENT_OFF, 0, 0, {0, 0, 0, 0}, 0, 0},
+};
+
+static sht3x_dev_t* sht3x_dev(sht3x_i2c_addr_t addr) {
+    return &sht3x_default_dev[addr == SHT3X_I2C_ADDR_ALT ? 1 : 0];
+}
 
-int16_t sht3x_measure_blocking_read(sht3x_i2c_addr_t addr, int32_t* temperature,
-                                    int32_t* humidity) {
-    int16_t ret = sht3x_measure(addr);
+static int16_t sht3x_read_ticks(sht3x_dev_t* dev, uint16_t* temperature_ticks,
+                               uint16_t* humidity_ticks,
+                               uint8_t allow_polling) {
+    uint16_t words[2];
+    int16_t ret;
+
+    if (allow_polling && dev->poll.interval_usec)
+        ret = sht_poll_read_words(dev->addr, words, SENSIRION_NUM_WORDS(words),
+                                  &dev->poll);
+    else
+        ret = sensirion_i2c_read_words(dev->addr, words,
+                                       SENSIRION_NUM_WORDS(words));
+    if (ret == STATUS_OK) {
+        *temperature_ticks = words[0];
+        *humidity_ticks = words[1];
+    }
+    return sht_dev_count(&dev->stats, ret, 1);
+}
+
+static int16_t sht3x_convert_ticks(int16_t ret, uint16_t temperature_ticks,
+                                   uint16_t humidity_ticks,
+                                   int32_t* temperature, int32_t* humidity) {
+    if (ret == STATUS_OK) {
+        tick_to_temperature(temperature_ticks, temperature);
+        tick_to_humidity(humidity_ticks, humidity);
+    }
+    return ret;
+}
+
+static int16_t sht3x_write_alert_word(sht3x_i2c_addr_t addr,
+                                      sht3x_alert_thd_t thd,
+                                      uint16_t limitVal) {
+    int16_t ret;
+
+    switch (thd) {
+        case SHT3X_HIALRT_SET:
+            ret = sensirion_i2c_write_cmd_with_args(
+                addr, SHT3X_CMD_WRITE_HIALRT_LIM_SET, &limitVal, 1);
+            break;
+
+        case SHT3X_HIALRT_CLR:
+            ret = sensirion_i2c_write_cmd_with_args(
+                addr, SHT3X_CMD_WRITE_HIALRT_LIM_CLR, &limitVal, 1);
+            break;
+
+        case SHT3X_LOALRT_CLR:
+            ret = sensirion_i2c_write_cmd_with_args(
+                addr, SHT3X_CMD_WRITE_LOALRT_LIM_CLR, &limitVal, 1);
+            break;
+
+        case SHT3X_LOALRT_SET:
+            ret = sensirion_i2c_write_cmd_with_args(
+                addr, SHT3X_CMD_WRITE_LOALRT_LIM_SET, &limitVal, 1);
+            break;
+
+        default:
+            ret = STATUS_ERR_INVALID_PARAMS;
+            break;
+    }
+    return ret;
+}
+
+static int16_t sht3x_read_alert_word(sht3x_i2c_addr_t addr,
+                                     sht3x_alert_thd_t thd, uint16_t* word) {
+    int16_t ret;
+
+    switch (thd) {
+        case SHT3X_HIALRT_SET:
+            ret = sensirion_i2c_read_cmd(addr, SHT3X_CMD_READ_HIALRT_LIM_SET,
+                                         word, 1);
+            break;
+
+        case SHT3X_HIALRT_CLR:
+            ret = sensirion_i2c_read_cmd(addr, SHT3X_CMD_READ_HIALRT_LIM_CLR,
+                                         word, 1);
+            break;
+
+        case SHT3X_LOALRT_CLR:
+            ret = sensirion_i2c_read_cmd(addr, SHT3X_CMD_READ_LOALRT_LIM_CLR,
+                                         word, 1);
+            break;
+
+        case SHT3X_LOALRT_SET:
+            ret = sensirion_i2c_read_cmd(addr, SHT3X_CMD_READ_LOALRT_LIM_SET,
+                                         word, 1);
+            break;
+
+        default:
+            ret = STATUS_ERR_INVALID_PARAMS;
+            break;
+    }
+    return ret;
+}
+
+/* wait for the next new sample in ART mode: the sensor acknowledges the fetch
+ * command but NACKs the read until then. Only the final result is counted, a
+ * failed fetch command or a CRC error ends the wait. */
+static int16_t sht3x_art_blocking_read_raw(sht3x_dev_t* dev,
+                                           uint16_t* temperature_ticks,
+                                           uint16_t* humidity_ticks) {
+    const uint32_t timeout_usec =
+        SHT3X_ART_PERIOD_USEC + SHT3X_MEASUREMENT_DURATION_USEC;
+    uint32_t waited_usec = 0;
+    uint8_t buf[SHT3X_ART_READ_LEN];
+    int16_t ret = sht_dev_select_bus(dev->bus);
+
+    while (ret == STATUS_OK) {
+        ret = sensirion_i2c_write_cmd(dev->addr, SHT3X_CMD_FETCH_DATA);
+        if (ret != STATUS_OK)
+            break;
+        ret = sensirion_i2c_read(dev->addr, buf, SHT3X_ART_READ_LEN);
+        if (ret == STATUS_OK || waited_usec >= timeout_usec)
+            break;
+        sensirion_sleep_usec(SHT3X_ART_POLL_INTERVAL_USEC);
+        waited_usec += SHT3X_ART_POLL_INTERVAL_USEC;
+        ret = STATUS_OK;
+    }
+    if (ret == STATUS_OK)
+        ret = sensirion_common_check_crc(buf, SENSIRION_WORD_SIZE,
+                                         buf[SENSIRION_WORD_SIZE]);
+    if (ret == STATUS_OK)
+        ret = sensirion_common_check_crc(&buf[3], SENSIRION_WORD_SIZE,
+                                         buf[3 + SENSIRION_WORD_SIZE]);
+    if (ret == STATUS_OK) {
+        *temperature_ticks = (uint16_t)((uint16_t)buf[0] << 8 | buf[1]);
+        *humidity_ticks = (uint16_t)((uint16_t)buf[3] << 8 | buf[4]);
+    }
+    return sht_dev_count(&dev->stats, ret, 1);
+}
+
+void sht3x_dev_init(sht3x_dev_t* dev, sht3x_i2c_addr_t addr, uint8_t bus) {
+    uint8_t i;
+
+    dev->addr = addr;
+    dev->bus = bus;
+    dev->acq_state = SHT3X_STATE_SINGLE_SHOT;
+    dev->poll.interval_usec = 0;
+    dev->poll.timeout_usec = 0;
+    dev->poll.last_wait_usec = 0;
+    dev->stats.measurements = 0;
+    dev->stats.errors = 0;
+    dev->pending = 0;
+    dev->start_usec = 0;
+    dev->event_mode = SHT3X_EVENT_OFF;
+    dev->alert_signaled = 0;
+    dev->cmd_periodic = 0;
+    for (i = 0; i <= SHT3X_LOALRT_SET; ++i)
+        dev->alert_words[i] = 0;
+    dev->alert_cached = 0;
+    dev->resets = 0;
+    sht3x_dev_set_power_mode(dev, SHT3X_MEAS_MODE_HPM);
+}
+
+int16_t sht3x_dev_measure_blocking_read(sht3x_dev_t* dev,
+                                        int32_t* temperature,
+                                        int32_t* humidity) {
+    uint16_t temperature_ticks, humidity_ticks;
+    int16_t ret = sht3x_dev_measure_blocking_read_raw(dev, &temperature_ticks,
+                                                      &humidity_ticks);
+    return sht3x_convert_ticks(ret, temperature_ticks, humidity_ticks,
+                               temperature, humidity);
+}
+
+int16_t sht3x_dev_measure_blocking_read_raw(sht3x_dev_t* dev,
+                                            uint16_t* temperature_ticks,
+                                            uint16_t* humidity_ticks) {
+    int16_t ret = sht3x_dev_measure(dev);
+    if (ret == STATUS_OK && dev->cmd_measure == SHT3X_CMD_ART)
+        return sht3x_art_blocking_read_raw(dev, temperature_ticks,
+                                           humidity_ticks);
     if (ret == STATUS_OK) {
 #if !defined(USE_SENSIRION_CLOCK_STRETCHING) || !USE_SENSIRION_CLOCK_STRETCHING
-        sensirion_sleep_usec(SHT3X_MEASUREMENT_DURATION_USEC);
+        if (!dev->poll.interval_usec)
+            sensirion_sleep_usec(dev->measure_delay_usec);
 #endif /* USE_SENSIRION_CLOCK_STRETCHING */
-        ret = sht3x_read(addr, temperature, humidity);
+        ret = sht3x_dev_read_raw(dev, temperature_ticks, humidity_ticks);
     }
     return ret;
 }
 
-int16_t sht3x_measure(sht3x_i2c_addr_t addr) {
-    return sensirion_i2c_write_cmd(addr, sht3x_cmd_measure);
+int16_t sht3x_dev_measure(sht3x_dev_t* dev) {
+    int16_t ret;
+
+    if (dev->cmd_measure == SHT3X_CMD_ART &&
+        dev->acq_state == SHT3X_STATE_ART)
+        return STATUS_OK; /* already running */
+    if (dev->acq_state != SHT3X_STATE_SINGLE_SHOT)
+        return STATUS_ERR_PERIODIC_MODE;
+
+    ret = sht_dev_select_bus(dev->bus);
+    /* see sht3x_dev_start_periodic() */
+    if (ret == STATUS_OK && dev->cmd_measure == SHT3X_CMD_ART)
+        ret = sht3x_clear_status(dev->addr);
+    if (ret == STATUS_OK)
+        ret = sensirion_i2c_write_cmd(dev->addr, dev->cmd_measure);
+    if (ret == STATUS_OK && dev->cmd_measure == SHT3X_CMD_ART) {
+        /* restarted by sht3x_dev_check_reset() */
+        dev->cmd_periodic = SHT3X_CMD_ART;
+        dev->acq_state = SHT3X_STATE_ART;
+    }
+    return sht_dev_count(&dev->stats, ret, 0);
 }
 
-int16_t sht3x_read(sht3x_i2c_addr_t addr, int32_t* temperature,
-                   int32_t* humidity) {
+int16_t sht3x_dev_start_measurement(sht3x_dev_t* dev, uint32_t now_usec) {
+    int16_t ret = sht3x_dev_measure(dev);
+    if (ret)
+        return ret;
+
+    dev->pending = 1;
+    dev->start_usec = now_usec;
+    return STATUS_OK;
+}
+
+int16_t sht3x_dev_poll_measurement(sht3x_dev_t* dev, uint32_t now_usec,
+                                   int32_t* temperature, int32_t* humidity) {
     uint16_t words[2];
-    int16_t ret =
-        sensirion_i2c_read_words(addr, words, SENSIRION_NUM_WORDS(words));
-    /**
-     * formulas for conversion of the sensor signals, optimized for fixed point
-     * algebra: Temperature = 175 * S_T / 2^16 - 45
-     * Relative Humidity = * 100 * S_RH / 2^16
-     */
-    tick_to_temperature(words[0], temperature);
-    tick_to_humidity(words[1], humidity);
+    uint32_t due_usec = dev->measure_delay_usec;
+    uint8_t art = dev->acq_state == SHT3X_STATE_ART;
+    uint8_t early;
+    int16_t ret;
 
-    return ret;
+    if (!dev->pending)
+        return STATUS_ERR_NOT_STARTED;
+
+    if (art)
+        due_usec += SHT3X_MEASUREMENT_DURATION_USEC;
+    early = !SHT_TIME_REACHED(now_usec, dev->start_usec + due_usec);
+    if (early && !art && !dev->poll.interval_usec)
+        return STATUS_NOT_READY;
+
+    ret = sht_dev_select_bus(dev->bus);
+    if (ret == STATUS_OK && art)
+        ret = sensirion_i2c_write_cmd(dev->addr, SHT3X_CMD_FETCH_DATA);
+    if (ret == STATUS_OK)
+        ret = sensirion_i2c_read_words(dev->addr, words,
+                                       SENSIRION_NUM_WORDS(words));
+    if (ret != STATUS_OK && early)
+        return STATUS_NOT_READY; /* NACKed, still measuring */
+
+    dev->pending = 0;
+    if (ret == STATUS_OK) {
+        tick_to_temperature(words[0], temperature);
+        tick_to_humidity(words[1], humidity);
+        if (dev->poll.interval_usec)
+            dev->poll.last_wait_usec = now_usec - dev->start_usec;
+    }
+    return sht_dev_count(&dev->stats, ret, 1);
 }
 
-int16_t sht3x_probe(sht3x_i2c_addr_t addr) {
-    uint16_t status;
-    return sensirion_i2c_delayed_read_cmd(addr, SHT3X_CMD_READ_STATUS_REG,
-                                          SHT3X_CMD_DURATION_USEC, &status, 1);
+int16_t sht3x_dev_read(sht3x_dev_t* dev, int32_t* temperature,
+                       int32_t* humidity) {
+    uint16_t temperature_ticks, humidity_ticks;
+    int16_t ret = sht3x_dev_read_raw(dev, &temperature_ticks, &humidity_ticks);
+    return sht3x_convert_ticks(ret, temperature_ticks, humidity_ticks,
+                               temperature, humidity);
 }
 
-int16_t sht3x_get_status(sht3x_i2c_addr_t addr, uint16_t* status) {
-    return sensirion_i2c_delayed_read_cmd(addr, SHT3X_CMD_READ_STATUS_REG,
-                                          SHT3X_CMD_DURATION_USEC, status, 1);
+int16_t sht3x_dev_read_raw(sht3x_dev_t* dev, uint16_t* temperature_ticks,
+                           uint16_t* humidity_ticks) {
+    int16_t ret = sht_dev_select_bus(dev->bus);
+    if (ret)
+        return sht_dev_count(&dev->stats, ret, 0);
+    return sht3x_read_ticks(dev, temperature_ticks, humidity_ticks, 1);
 }
 
-int16_t sht3x_clear_status(sht3x_i2c_addr_t addr) {
-    return sensirion_i2c_write_cmd(addr, SHT3X_CMD_CLR_STATUS_REG);
+void sht3x_dev_set_nack_polling(sht3x_dev_t* dev, uint16_t interval_usec,
+                                uint32_t timeout_usec) {
+    dev->poll.interval_usec = interval_usec;
+    dev->poll.timeout_usec = timeout_usec;
+    dev->poll.last_wait_usec = 0;
 }
 
-void sht3x_enable_low_power_mode(uint8_t enable_low_power_mode) {
-    sht3x_cmd_measure =
-        enable_low_power_mode ? SHT3X_CMD_MEASURE_LPM : SHT3X_CMD_MEASURE_HPM;
+uint32_t sht3x_dev_get_polled_duration_usec(const sht3x_dev_t* dev) {
+    return dev->poll.last_wait_usec;
 }
 
-void sht3x_set_power_mode(sht3x_measurement_mode_t mode) {
+int16_t sht3x_dev_start_periodic(sht3x_dev_t* dev, sht3x_periodic_mps_t mps,
+                                 sht3x_measurement_mode_t repeatability) {
+    int16_t ret;
+    uint16_t cmd;
+
+    if ((uint32_t)mps > SHT3X_PERIODIC_MPS_10 ||
+        (uint32_t)repeatability > SHT3X_MEAS_MODE_ART)
+        return STATUS_ERR_INVALID_PARAMS;
+
+    if (dev->acq_state != SHT3X_STATE_SINGLE_SHOT) {
+        ret = sht3x_dev_stop_periodic(dev);
+        if (ret)
+            return ret;
+    }
+
+    if (repeatability == SHT3X_MEAS_MODE_ART)
+        cmd = SHT3X_CMD_ART;
+    else
+        cmd = SHT3X_CMD_PERIODIC[mps][repeatability];
+
+    ret = sht_dev_select_bus(dev->bus);
+    /* a reset flag left from power-up would look like a reset during the
+     * acquisition to sht3x_dev_check_reset() */
+    if (ret == STATUS_OK)
+        ret = sht3x_clear_status(dev->addr);
+    if (ret == STATUS_OK)
+        ret = sensirion_i2c_write_cmd(dev->addr, cmd);
+    if (ret == STATUS_OK)
+        dev->cmd_periodic = cmd;
+    if (ret == STATUS_OK)
+        dev->acq_state = repeatability == SHT3X_MEAS_MODE_ART
+                             ? SHT3X_STATE_ART
+                             : SHT3X_STATE_PERIODIC;
+    return sht_dev_count(&dev->stats, ret, 0);
+}
+
+int16_t sht3x_dev_fetch_periodic(sht3x_dev_t* dev, int32_t* temperature,
+                                 int32_t* humidity) {
+    uint16_t temperature_ticks, humidity_ticks;
+    int16_t ret =
+        sht3x_dev_fetch_periodic_raw(dev, &temperature_ticks, &humidity_ticks);
+    return sht3x_convert_ticks(ret, temperature_ticks, humidity_ticks,
+                               temperature, humidity);
+}
+
+int16_t sht3x_dev_fetch_periodic_raw(sht3x_dev_t* dev,
+                                     uint16_t* temperature_ticks,
+                                     uint16_t* humidity_ticks) {
+    int16_t ret;
+
+    if (dev->acq_state == SHT3X_STATE_SINGLE_SHOT)
+        return STATUS_ERR_PERIODIC_MODE;
+
+    ret = sht_dev_select_bus(dev->bus);
+    if (ret == STATUS_OK)
+        ret = sensirion_i2c_write_cmd(dev->addr, SHT3X_CMD_FETCH_DATA);
+    if (ret)
+        return sht_dev_count(&dev->stats, ret, 0);
+    /* a NACK means there is no new data, polling would not change that */
+    return sht3x_read_ticks(dev, temperature_ticks, humidity_ticks, 0);
+}
+
+int16_t sht3x_dev_stop_periodic(sht3x_dev_t* dev) {
+    int16_t ret = sht_dev_select_bus(dev->bus);
+    if (ret == STATUS_OK)
+        ret = sensirion_i2c_write_cmd(dev->addr, SHT3X_CMD_BREAK);
+    if (ret)
+        return sht_dev_count(&dev->stats, ret, 0);
+
+    dev->acq_state = SHT3X_STATE_SINGLE_SHOT;
+    dev->event_mode = SHT3X_EVENT_OFF;
+    /* the sensor needs 1ms to abort the acquisition */
+    sensirion_sleep_usec(SHT3X_CMD_DURATION_USEC);
+    return STATUS_OK;
+}
 
+uint8_t sht3x_dev_get_acquisition_state(const sht3x_dev_t* dev) {
+    return dev->acq_state;
+}
+
+void sht3x_dev_set_power_mode(sht3x_dev_t* dev,
+                              sht3x_measurement_mode_t mode) {
     switch (mode) {
         case SHT3X_MEAS_MODE_LPM: {
-            sht3x_cmd_measure = SHT3X_CMD_MEASURE_LPM;
+            dev->cmd_measure = SHT3X_CMD_MEASURE_LPM;
+            dev->measure_delay_usec = SHT3X_MEASUREMENT_DURATION_LPM_USEC;
             break;
         }
         case SHT3X_MEAS_MODE_MPM: {
-            sht3x_cmd_measure = SHT3X_CMD_MEASURE_MPM;
+            dev->cmd_measure = SHT3X_CMD_MEASURE_MPM;
+            dev->measure_delay_usec = SHT3X_MEASUREMENT_DURATION_MPM_USEC;
             break;
         }
         case SHT3X_MEAS_MODE_HPM: {
-            sht3x_cmd_measure = SHT3X_CMD_MEASURE_HPM;
+            dev->cmd_measure = SHT3X_CMD_MEASURE_HPM;
+            dev->measure_delay_usec = SHT3X_MEASUREMENT_DURATION_USEC;
+            break;
+        }
+        case SHT3X_MEAS_MODE_ART: {
+            dev->cmd_measure = SHT3X_CMD_ART;
+            dev->measure_delay_usec = SHT3X_ART_PERIOD_USEC;
             break;
         }
         default: {
-            sht3x_cmd_measure = SHT3X_CMD_MEASURE_HPM;
+            dev->cmd_measure = SHT3X_CMD_MEASURE_HPM;
+            dev->measure_delay_usec = SHT3X_MEASUREMENT_DURATION_USEC;
+            mode = SHT3X_MEAS_MODE_HPM;
             break;
         }
     }
+    dev->mode = (uint8_t)mode;
+}
+
+uint32_t sht3x_dev_get_measurement_duration_usec(const sht3x_dev_t* dev) {
+    return dev->measure_delay_usec;
+}
+
+int16_t sht3x_dev_probe(sht3x_dev_t* dev) {
+    int16_t ret = sht_dev_select_bus(dev->bus);
+    if (ret == STATUS_OK)
+        ret = sht3x_probe(dev->addr);
+    return sht_dev_count(&dev->stats, ret, 0);
+}
+
+int16_t sht3x_dev_get_status(sht3x_dev_t* dev, uint16_t* status) {
+    int16_t ret = sht_dev_select_bus(dev->bus);
+    if (ret == STATUS_OK)
+        ret = sht3x_get_status(dev->addr, status);
+    return sht_dev_count(&dev->stats, ret, 0);
+}
+
+int16_t sht3x_dev_clear_status(sht3x_dev_t* dev) {
+    int16_t ret = sht_dev_select_bus(dev->bus);
+    if (ret == STATUS_OK)
+        ret = sht3x_clear_status(dev->addr);
+    return sht_dev_count(&dev->stats, ret, 0);
+}
+
+int16_t sht3x_dev_read_serial(sht3x_dev_t* dev, uint32_t* serial) {
+    int16_t ret = sht_dev_select_bus(dev->bus);
+    if (ret == STATUS_OK)
+        ret = sht3x_read_serial(dev->addr, serial);
+    return sht_dev_count(&dev->stats, ret, 0);
+}
+
+int16_t sht3x_dev_set_alert_thd(sht3x_dev_t* dev, sht3x_alert_thd_t thd,
+                                uint32_t humidity, int32_t temperature) {
+    uint16_t limitVal = sht3x_alert_limit_word(humidity, temperature);
+    int16_t ret = sht_dev_select_bus(dev->bus);
+    if (ret == STATUS_OK)
+        ret = sht3x_write_alert_word(dev->addr, thd, limitVal);
+    if (ret == STATUS_OK) {
+        /* the sensor forgets the limits on a reset */
+        dev->alert_words[thd] = limitVal;
+        dev->alert_cached |= (uint8_t)(1U << thd);
+    }
+    return sht_dev_count(&dev->stats, ret, 0);
+}
+
+int16_t sht3x_dev_set_alert_words(sht3x_dev_t* dev, const uint16_t* words,
+                                  sht3x_verify_t verify) {
+    uint16_t status;
+    uint16_t word;
+    uint8_t crc_failed = 0;
+    uint8_t i;
+    int16_t ret;
+
+    if (dev->acq_state != SHT3X_STATE_SINGLE_SHOT)
+        return STATUS_ERR_PERIODIC_MODE;
+
+    ret = sht_dev_select_bus(dev->bus);
+    for (i = 0; i <= SHT3X_LOALRT_SET && ret == STATUS_OK; ++i) {
+        ret = sht3x_write_alert_word(dev->addr, (sht3x_alert_thd_t)i,
+                                     words[i]);
+        if (ret == STATUS_OK) {
+            dev->alert_words[i] = words[i];
+            dev->alert_cached |= (uint8_t)(1U << i);
+        }
+        /* the status reports the checksum of the last command only */
+        if (ret == STATUS_OK && verify == SHT3X_VERIFY_STATUS) {
+            ret = sht3x_get_status(dev->addr, &status);
+            if (ret == STATUS_OK && SHT3X_IS_LAST_CRC_FAIL(status))
+                crc_failed = 1;
+        }
+    }
+
+    if (ret == STATUS_OK && verify == SHT3X_VERIFY_STATUS && !crc_failed)
+        verify = SHT3X_VERIFY_NONE;
+    if (verify != SHT3X_VERIFY_NONE) {
+        for (i = 0; i <= SHT3X_LOALRT_SET && ret == STATUS_OK; ++i) {
+            ret = sht3x_read_alert_word(dev->addr, (sht3x_alert_thd_t)i,
+                                        &word);
+            if (ret == STATUS_OK && word != words[i])
+                ret = STATUS_ERR_BAD_DATA;
+        }
+    }
+    return sht_dev_count(&dev->stats, ret, 0);
+}
+
+/* re-apply the cached configuration, the sensor restarts in single shot mode
+ * with the default limits after a reset */
+static int16_t sht3x_dev_reprovision(sht3x_dev_t* dev) {
+    int16_t ret = STATUS_OK;
+    uint8_t i;
+
+    ++dev->resets;
+    for (i = 0; i <= SHT3X_LOALRT_SET && ret == STATUS_OK; ++i) {
+        if (dev->alert_cached & (1U << i))
+            ret = sht3x_write_alert_word(dev->addr, (sht3x_alert_thd_t)i,
+                                         dev->alert_words[i]);
+    }
+    if (ret == STATUS_OK)
+        ret = sht3x_clear_status(dev->addr);
+    if (ret == STATUS_OK && dev->acq_state != SHT3X_STATE_SINGLE_SHOT)
+        ret = sensirion_i2c_write_cmd(dev->addr, dev->cmd_periodic);
+    return ret;
+}
+
+int16_t sht3x_dev_check_reset(sht3x_dev_t* dev, uint16_t* status) {
+    int16_t ret = sht_dev_select_bus(dev->bus);
+    if (ret == STATUS_OK)
+        ret = sht3x_get_status(dev->addr, status);
+    if (ret == STATUS_OK && SHT3X_IS_SYSTEM_RST_DETECT(*status))
+        ret = sht3x_dev_reprovision(dev);
+    return sht_dev_count(&dev->stats, ret, 0);
+}
+
+int16_t sht3x_dev_get_alert_thd(sht3x_dev_t* dev, sht3x_alert_thd_t thd,
+                                int32_t* humidity, int32_t* temperature) {
+    int16_t ret = sht_dev_select_bus(dev->bus);
+    if (ret == STATUS_OK)
+        ret = sht3x_get_alert_thd(dev->addr, thd, humidity, temperature);
+    return sht_dev_count(&dev->stats, ret, 0);
+}
+
+int16_t sht3x_dev_start_event_mode(sht3x_dev_t* dev,
+                                   const sht3x_alert_limit_t* limits,
+                                   sht3x_periodic_mps_t mps,
+                                   sht3x_measurement_mode_t repeatability,
+                                   sht3x_event_source_t source) {
+    int16_t ret;
+    uint8_t i;
+
+    /* ART mode does not evaluate the alert limits */
+    if ((uint32_t)repeatability > SHT3X_MEAS_MODE_HPM ||
+        (uint32_t)source > SHT3X_EVENT_ALERT_PIN)
+        return STATUS_ERR_INVALID_PARAMS;
+
+    /* the limits can only be written in single shot mode */
+    if (dev->acq_state != SHT3X_STATE_SINGLE_SHOT) {
+        ret = sht3x_dev_stop_periodic(dev);
+        if (ret)
+            return ret;
+    }
+
+    if (limits) {
+        for (i = 0; i <= SHT3X_LOALRT_SET; ++i) {
+            ret = sht3x_dev_set_alert_thd(dev, (sht3x_alert_thd_t)i,
+                                          limits[i].humidity,
+                                          limits[i].temperature);
+            if (ret)
+                return ret;
+        }
+    }
+
+    ret = sht3x_dev_clear_status(dev);
+    if (ret)
+        return ret;
+
+    dev->alert_signaled = 0;
+    ret = sht3x_dev_start_periodic(dev, mps, repeatability);
+    if (ret == STATUS_OK)
+        dev->event_mode = source == SHT3X_EVENT_ALERT_PIN
+                              ? SHT3X_EVENT_ON_PIN
+                              : SHT3X_EVENT_ON_STATUS;
+    return ret;
+}
+
+void sht3x_dev_signal_alert(sht3x_dev_t* dev) {
+    dev->alert_signaled = 1;
+}
+
+int16_t sht3x_dev_poll_event(sht3x_dev_t* dev, uint16_t* status,
+                             int32_t* temperature, int32_t* humidity) {
+    int16_t ret;
+
+    if (dev->event_mode == SHT3X_EVENT_OFF)
+        return STATUS_ERR_NOT_STARTED;
+
+    if (dev->event_mode == SHT3X_EVENT_ON_PIN) {
+        if (!dev->alert_signaled)
+            return STATUS_NOT_READY;
+        /* clear before the bus access to not miss an edge in between */
+        dev->alert_signaled = 0;
+    }
+
+    ret = sht3x_dev_check_reset(dev, status);
+    if (ret)
+        return ret;
+    /* the pending flag of a reset was cleared with the re-provisioning */
+    if (SHT3X_IS_SYSTEM_RST_DETECT(*status) || !SHT3X_IS_ALRT_PENDING(*status))
+        return STATUS_NOT_READY;
+
+    ret = sht3x_dev_clear_status(dev);
+    if (ret)
+        return ret;
+    return sht3x_dev_fetch_periodic(dev, temperature, humidity);
+}
+
+int16_t sht3x_dev_stop_event_mode(sht3x_dev_t* dev) {
+    if (dev->event_mode == SHT3X_EVENT_OFF)
+        return STATUS_OK;
+    return sht3x_dev_stop_periodic(dev);
+}
+
+int16_t sht3x_measure_blocking_read(sht3x_i2c_addr_t addr, int32_t* temperature,
+                                    int32_t* humidity) {
+    return sht3x_dev_measure_blocking_read(sht3x_dev(addr), temperature,
+                                           humidity);
+}
+
+int16_t sht3x_measure(sht3x_i2c_addr_t addr) {
+    return sht3x_dev_measure(sht3x_dev(addr));
+}
+
+int16_t sht3x_read(sht3x_i2c_addr_t addr, int32_t* temperature,
+                   int32_t* humidity) {
+    return sht3x_dev_read(sht3x_dev(addr), temperature, humidity);
+}
+
+int16_t sht3x_measure_blocking_read_raw(sht3x_i2c_addr_t addr,
+                                        uint16_t* temperature_ticks,
+                                        uint16_t* humidity_ticks) {
+    return sht3x_dev_measure_blocking_read_raw(sht3x_dev(addr),
+                                               temperature_ticks,
+                                               humidity_ticks);
+}
+
+int16_t sht3x_read_raw(sht3x_i2c_addr_t addr, uint16_t* temperature_ticks,
+                       uint16_t* humidity_ticks) {
+    return sht3x_dev_read_raw(sht3x_dev(addr), temperature_ticks,
+                              humidity_ticks);
+}
+
+int16_t sht3x_start_measurement(sht3x_i2c_addr_t addr, uint32_t now_usec) {
+    return sht3x_dev_start_measurement(sht3x_dev(addr), now_usec);
+}
+
+int16_t sht3x_poll_measurement(sht3x_i2c_addr_t addr, uint32_t now_usec,
+                               int32_t* temperature, int32_t* humidity) {
+    return sht3x_dev_poll_measurement(sht3x_dev(addr), now_usec, temperature,
+                                      humidity);
+}
+
+void sht3x_set_nack_polling(sht3x_i2c_addr_t addr, uint16_t interval_usec,
+                            uint32_t timeout_usec) {
+    sht3x_dev_set_nack_polling(sht3x_dev(addr), interval_usec, timeout_usec);
+}
+
+uint32_t sht3x_get_polled_duration_usec(sht3x_i2c_addr_t addr) {
+    return sht3x_dev_get_polled_duration_usec(sht3x_dev(addr));
+}
+
+int16_t sht3x_start_periodic(sht3x_i2c_addr_t addr, sht3x_periodic_mps_t mps,
+                             sht3x_measurement_mode_t repeatability) {
+    return sht3x_dev_start_periodic(sht3x_dev(addr), mps, repeatability);
+}
+
+int16_t sht3x_fetch_periodic(sht3x_i2c_addr_t addr, int32_t* temperature,
+                             int32_t* humidity) {
+    return sht3x_dev_fetch_periodic(sht3x_dev(addr), temperature, humidity);
+}
+
+int16_t sht3x_fetch_periodic_raw(sht3x_i2c_addr_t addr,
+                                 uint16_t* temperature_ticks,
+                                 uint16_t* humidity_ticks) {
+    return sht3x_dev_fetch_periodic_raw(sht3x_dev(addr), temperature_ticks,
+                                        humidity_ticks);
+}
+
+int16_t sht3x_stop_periodic(sht3x_i2c_addr_t addr) {
+    return sht3x_dev_stop_periodic(sht3x_dev(addr));
+}
+
+int16_t sht3x_start_event_mode(sht3x_i2c_addr_t addr,
+                               const sht3x_alert_limit_t* limits,
+                               sht3x_periodic_mps_t mps,
+                               sht3x_measurement_mode_t repeatability,
+                               sht3x_event_source_t source) {
+    return sht3x_dev_start_event_mode(sht3x_dev(addr), limits, mps,
+                                      repeatability, source);
+}
+
+void sht3x_signal_alert(sht3x_i2c_addr_t addr) {
+    sht3x_dev_signal_alert(sht3x_dev(addr));
+}
+
+int16_t sht3x_poll_event(sht3x_i2c_addr_t addr, uint16_t* status,
+                         int32_t* temperature, int32_t* humidity) {
+    return sht3x_dev_poll_event(sht3x_dev(addr), status, temperature,
+                                humidity);
+}
+
+int16_t sht3x_stop_event_mode(sht3x_i2c_addr_t addr) {
+    return sht3x_dev_stop_event_mode(sht3x_dev(addr));
+}
+
+int16_t sht3x_probe(sht3x_i2c_addr_t addr) {
+    uint16_t status;
+    return sensirion_i2c_delayed_read_cmd(addr, SHT3X_CMD_READ_STATUS_REG,
+                                          SHT3X_CMD_DURATION_USEC, &status, 1);
+}
+
+int16_t sht3x_get_status(sht3x_i2c_addr_t addr, uint16_t* status) {
+    return sensirion_i2c_delayed_read_cmd(addr, SHT3X_CMD_READ_STATUS_REG,
+                                          SHT3X_CMD_DURATION_USEC, status, 1);
+}
+
+int16_t sht3x_clear_status(sht3x_i2c_addr_t addr) {
+    return sensirion_i2c_write_cmd(addr, SHT3X_CMD_CLR_STATUS_REG);
+}
+
+void sht3x_enable_low_power_mode(uint8_t enable_low_power_mode) {
+    sht3x_set_power_mode(enable_low_power_mode ? SHT3X_MEAS_MODE_LPM
+                                               : SHT3X_MEAS_MODE_HPM);
+}
+
+void sht3x_set_power_mode(sht3x_measurement_mode_t mode) {
+    sht3x_dev_set_power_mode(sht3x_dev(SHT3X_I2C_ADDR_DFLT), mode);
+    sht3x_dev_set_power_mode(sht3x_dev(SHT3X_I2C_ADDR_ALT), mode);
+}
+
+uint32_t sht3x_get_measurement_duration_usec(void) {
+    return sht3x_dev_get_measurement_duration_usec(
+        sht3x_dev(SHT3X_I2C_ADDR_DFLT));
+}
+
+uint8_t sht3x_get_acquisition_state(sht3x_i2c_addr_t addr) {
+    return sht3x_dev_get_acquisition_state(sht3x_dev(addr));
 }
 
 int16_t sht3x_read_serial(sht3x_i2c_addr_t addr, uint32_t* serial) {
@@ -170,90 +852,46 @@ const char* sht3x_get_driver_version(void) {
 
 int16_t sht3x_set_alert_thd(sht3x_i2c_addr_t addr, sht3x_alert_thd_t thd,
                             uint32_t humidity, int32_t temperature) {
-    int16_t ret;
-    uint16_t rawT;
-    uint16_t rawRH;
-    uint16_t limitVal = 0U;
-
-    temperature_to_tick(temperature, &rawT);
-    humidity_to_tick(humidity, &rawRH);
-
-    /* convert inputs to alert threshold word */
-    limitVal = (rawRH & SHT3X_HUMIDITY_LIMIT_MSK);
-    limitVal |= ((rawT >> 7) & SHT3X_TEMPERATURE_LIMIT_MSK);
-
-    switch (thd) {
-        case SHT3X_HIALRT_SET:
-            ret = sensirion_i2c_write_cmd_with_args(
-                addr, SHT3X_CMD_WRITE_HIALRT_LIM_SET, &limitVal, 1);
-            break;
-
-        case SHT3X_HIALRT_CLR:
-            ret = sensirion_i2c_write_cmd_with_args(
-                addr, SHT3X_CMD_WRITE_HIALRT_LIM_CLR, &limitVal, 1);
-            break;
-
-        case SHT3X_LOALRT_CLR:
-            ret = sensirion_i2c_write_cmd_with_args(
-                addr, SHT3X_CMD_WRITE_LOALRT_LIM_CLR, &limitVal, 1);
-            break;
+    return sht3x_dev_set_alert_thd(sht3x_dev(addr), thd, humidity,
+                                   temperature);
+}
 
-        case SHT3X_LOALRT_SET:
-            ret = sensirion_i2c_write_cmd_with_args(
-                addr, SHT3X_CMD_WRITE_LOALRT_LIM_SET, &limitVal, 1);
-            break;
+int16_t sht3x_set_alert_words(sht3x_i2c_addr_t addr, const uint16_t* words,
+                              sht3x_verify_t verify) {
+    return sht3x_dev_set_alert_words(sht3x_dev(addr), words, verify);
+}
 
-        default:
-            ret = STATUS_ERR_INVALID_PARAMS;
-            break;
-    }
-    return ret;
+int16_t sht3x_check_reset(sht3x_i2c_addr_t addr, uint16_t* status) {
+    return sht3x_dev_check_reset(sht3x_dev(addr), status);
 }
 
 int16_t sht3x_get_alert_thd(sht3x_i2c_addr_t addr, sht3x_alert_thd_t thd,
                             int32_t* humidity, int32_t* temperature) {
-
-    int16_t ret;
     uint16_t word;
     uint16_t rawT;
     uint16_t rawRH;
+    int16_t ret = sht3x_read_alert_word(addr, thd, &word);
 
-    switch (thd) {
-        case SHT3X_HIALRT_SET:
-            ret = sensirion_i2c_read_cmd(addr, SHT3X_CMD_READ_HIALRT_LIM_SET,
-                                         &word, 1);
-            break;
-
-        case SHT3X_HIALRT_CLR:
-            ret = sensirion_i2c_read_cmd(addr, SHT3X_CMD_READ_HIALRT_LIM_CLR,
-                                         &word, 1);
-            break;
-
-        case SHT3X_LOALRT_CLR:
-            ret = sensirion_i2c_read_cmd(addr, SHT3X_CMD_READ_LOALRT_LIM_CLR,
-                                         &word, 1);
-            break;
-
-        case SHT3X_LOALRT_SET:
-            ret = sensirion_i2c_read_cmd(addr, SHT3X_CMD_READ_LOALRT_LIM_SET,
-                                         &word, 1);
-            break;
+    if (ret == STATUS_OK) {
+        /* convert threshold word to alert settings in 10*%RH & 10*°C */
+        rawRH = (word & SHT3X_HUMIDITY_LIMIT_MSK);
+        rawT = ((word & SHT3X_TEMPERATURE_LIMIT_MSK) << 7);
 
-        default:
-            ret = STATUS_ERR_INVALID_PARAMS;
-            break;
+        tick_to_humidity(rawRH, humidity);
+        tick_to_temperature(rawT, temperature);
     }
-
-    /* convert threshold word to alert settings in 10*%RH & 10*°C */
-    rawRH = (word & SHT3X_HUMIDITY_LIMIT_MSK);
-    rawT = ((word & SHT3X_TEMPERATURE_LIMIT_MSK) << 7);
-
-    tick_to_humidity(rawRH, humidity);
-    tick_to_temperature(rawT, temperature);
-
     return ret;
 }
 
+uint16_t sht3x_alert_limit_word(uint32_t humidity, int32_t temperature) {
+    return SHT3X_ALERT_LIMIT_WORD((int32_t)humidity, temperature);
+}
+
+/**
+ * formulas for conversion of the sensor signals, optimized for fixed point
+ * algebra: Temperature = 175 * S_T / 2^16 - 45
+ * Relative Humidity = * 100 * S_RH / 2^16
+ */
 void tick_to_temperature(uint16_t tick, int32_t* temperature) {
     *temperature = ((21875 * (int32_t)tick) >> 13) - 45000;
 }
@@ -43,7 +43,9 @@
 
 #include "sensirion_arch_config.h"
 #include "sensirion_i2c.h"
+#include "sht_dev.h"
 #include "sht_git_version.h"
+#include "sht_poll.h"
 
 #ifdef __cplusplus
 extern "C" {
@@ -54,7 +56,23 @@ extern "C" {
 #define STATUS_CRC_FAIL (-2)
 #define STATUS_UNKNOWN_DEVICE (-3)
 #define STATUS_ERR_INVALID_PARAMS (-4)
-#define SHT3X_MEASUREMENT_DURATION_USEC 15000
+#define STATUS_ERR_PERIODIC_MODE (-5)
+#define STATUS_NOT_READY 1
+#define STATUS_ERR_NOT_STARTED (-6)
+#define SHT3X_MEASUREMENT_DURATION_USEC 15000 /* high repeatability */
+#define SHT3X_MEASUREMENT_DURATION_MPM_USEC 6500
+#define SHT3X_MEASUREMENT_DURATION_LPM_USEC 4500
+#define SHT3X_ART_PERIOD_USEC 250000
+
+/* single shot measurement command words with and without clock stretching */
+#define SHT3X_CMD_MEASURE_HPM_STRETCH 0x2C06
+#define SHT3X_CMD_MEASURE_MPM_STRETCH 0x2C0D
+#define SHT3X_CMD_MEASURE_LPM_STRETCH 0x2C10
+#define SHT3X_CMD_MEASURE_HPM_NO_STRETCH 0x2400
+#define SHT3X_CMD_MEASURE_MPM_NO_STRETCH 0x240B
+#define SHT3X_CMD_MEASURE_LPM_NO_STRETCH 0x2416
+#define SHT3X_CMD_READ_SERIAL_ID 0x3780
+#define SHT3X_CMD_DURATION_USEC 1000
 
 /* status word macros */
 #define SHT3X_IS_ALRT_PENDING(status) (((status)&0x8000U) != 0U)
@@ -63,6 +81,21 @@ extern "C" {
 #define SHT3X_IS_SYSTEM_RST_DETECT(status) (((status)&0x0010U) != 0U)
 #define SHT3X_IS_LAST_CRC_FAIL(status) (((status)&0x0001U) != 0U)
 
+/**
+ * Alert limit word of a humidity in 1000*%RH and a temperature in 1000*°C:
+ * the 7 MSBs of the humidity ticks and the 9 MSBs of the temperature ticks.
+ * Same result as sht3x_alert_limit_word() but a constant expression for
+ * constant arguments, e.g. for limit tables.
+ */
+#define SHT3X_ALERT_LIMIT_WORD(humidity, temperature)                          \
+    ((uint16_t)(((uint32_t)(((humidity)*21474) >> 15) & 0xFE00U) |             \
+                ((uint32_t)(((temperature)*12271 + 552195000) >> 22) &         \
+                 0x01FFU)))
+
+/* acquisition state macros, see sht3x_get_acquisition_state() */
+#define SHT3X_IS_PERIODIC_ACTIVE(state) (((state)&0x01U) != 0U)
+#define SHT3X_IS_ART_ACTIVE(state) (((state)&0x02U) != 0U)
+
 /**
  * @brief SHT3x I2C 7-bit address option
  */
@@ -77,9 +110,21 @@ typedef enum _sht3x_i2c_addr {
 typedef enum _sht3x_measurement_mode {
     SHT3X_MEAS_MODE_LPM, /*low power mode*/
     SHT3X_MEAS_MODE_MPM, /*medium power mode*/
-    SHT3X_MEAS_MODE_HPM  /*high power mode*/
+    SHT3X_MEAS_MODE_HPM, /*high power mode*/
+    SHT3X_MEAS_MODE_ART  /*accelerated response time, periodic at 4Hz*/
 } sht3x_measurement_mode_t;
 
+/**
+ * @brief SHT3x periodic acquisition rates in measurements per second
+ */
+typedef enum _sht3x_periodic_mps {
+    SHT3X_PERIODIC_MPS_0_5, /*0.5 measurements per second*/
+    SHT3X_PERIODIC_MPS_1,   /*1 measurement per second*/
+    SHT3X_PERIODIC_MPS_2,   /*2 measurements per second*/
+    SHT3X_PERIODIC_MPS_4,   /*4 measurements per second*/
+    SHT3X_PERIODIC_MPS_10   /*10 measurements per second*/
+} sht3x_periodic_mps_t;
+
 /**
  * @brief SHT3x Alert Thresholds
  */
@@ -90,6 +135,64 @@ typedef enum _sht3x_alert_thd {
     SHT3X_LOALRT_SET,
 } sht3x_alert_thd_t;
 
+/**
+ * @brief One alert limit, see sht3x_set_alert_thd()
+ */
+typedef struct sht3x_alert_limit {
+    uint32_t humidity;   /* 1000*%RH */
+    int32_t temperature; /* 1000*°C */
+} sht3x_alert_limit_t;
+
+/**
+ * @brief How sht3x_dev_poll_event() learns about a pending alert
+ */
+typedef enum _sht3x_event_source {
+    SHT3X_EVENT_STATUS, /* read the status register on every poll */
+    SHT3X_EVENT_ALERT_PIN, /* wait for sht3x_dev_signal_alert() */
+} sht3x_event_source_t;
+
+/**
+ * @brief Verification of written alert limits, see sht3x_set_alert_words()
+ */
+typedef enum _sht3x_verify {
+    SHT3X_VERIFY_NONE,
+    SHT3X_VERIFY_STATUS,   /* read back only if the status reports a CRC fail */
+    SHT3X_VERIFY_READ_BACK /* always read back */
+} sht3x_verify_t;
+
+/**
+ * @brief SHT3x device context
+ *
+ * Holds the configuration and state of one sensor so that several sensors can
+ * be driven with independent settings. Initialize it with sht3x_dev_init() and
+ * treat the members as read-only. The address based functions use one
+ * internal context per address on the default bus.
+ */
+typedef struct sht3x_dev {
+    sht3x_i2c_addr_t addr;
+    /* bus index passed to sensirion_i2c_select_bus() or SHT_BUS_DEFAULT */
+    uint8_t bus;
+    uint16_t cmd_measure;
+    uint32_t measure_delay_usec;
+    /* sht3x_measurement_mode_t, see sht3x_dev_set_power_mode */
+    uint8_t mode;
+    /* see SHT3X_IS_PERIODIC_ACTIVE and SHT3X_IS_ART_ACTIVE */
+    uint8_t acq_state;
+    sht_poll_t poll;
+    sht_dev_stats_t stats;
+    /* non-blocking measurement in progress, see sht3x_dev_start_measurement */
+    uint8_t pending;
+    uint32_t start_usec;
+    /* event mode, see sht3x_dev_start_event_mode */
+    uint8_t event_mode;
+    volatile uint8_t alert_signaled;
+    /* configuration re-applied after a reset, see sht3x_dev_check_reset */
+    uint16_t cmd_periodic;
+    uint16_t alert_words[4];
+    uint8_t alert_cached;
+    uint16_t resets;
+} sht3x_dev_t;
+
 /**
  * @brief Detects if a sensor is connected by reading out the ID register.
  * If the sensor does not answer or if the answer is not the expected value,
@@ -145,14 +248,16 @@ int16_t sht3x_measure_blocking_read(sht3x_i2c_addr_t addr, int32_t* temperature,
  *
  * @param[in]  addr the sensor address
  *
- * @return     0 if the command was successful, else an error code.
+ * @return     0 if the command was successful, STATUS_ERR_PERIODIC_MODE if
+ *             periodic acquisition is running, else an error code.
  */
 int16_t sht3x_measure(sht3x_i2c_addr_t addr);
 
 /**
  * @brief Reads out the results of a measurement that was previously started by
  * sht3x_measure(). If the measurement is still in progress, this function
- * returns an error.
+ * returns an error, or waits for it with NACK polling enabled (see
+ * sht3x_set_nack_polling()).
  * Temperature is returned in [degree Celsius], multiplied by 1000,
  * and relative humidity in [percent relative humidity], multiplied by 1000.
  *
@@ -167,6 +272,158 @@ int16_t sht3x_measure(sht3x_i2c_addr_t addr);
 int16_t sht3x_read(sht3x_i2c_addr_t addr, int32_t* temperature,
                    int32_t* humidity);
 
+/**
+ * @brief Same as sht3x_measure_blocking_read() but returns the CRC checked raw
+ * ticks of the sensor. Convert them with tick_to_temperature() and
+ * tick_to_humidity().
+ *
+ * @param[in]  addr              the sensor address
+ * @param[out] temperature_ticks the address for the temperature ticks
+ * @param[out] humidity_ticks    the address for the humidity ticks
+ *
+ * @return              0 if the command was successful, else an error code.
+ */
+int16_t sht3x_measure_blocking_read_raw(sht3x_i2c_addr_t addr,
+                                        uint16_t* temperature_ticks,
+                                        uint16_t* humidity_ticks);
+
+/**
+ * @brief Same as sht3x_read() but returns the CRC checked raw ticks of the
+ * sensor. Convert them with tick_to_temperature() and tick_to_humidity().
+ *
+ * @param[in]  addr              the sensor address
+ * @param[out] temperature_ticks the address for the temperature ticks
+ * @param[out] humidity_ticks    the address for the humidity ticks
+ *
+ * @return              0 if the command was successful, else an error code.
+ */
+int16_t sht3x_read_raw(sht3x_i2c_addr_t addr, uint16_t* temperature_ticks,
+                       uint16_t* humidity_ticks);
+
+/**
+ * @brief Starts a non-blocking measurement in the configured power mode and
+ * records when its result is due. Use sht3x_poll_measurement() to collect
+ * the result. Neither function sleeps.
+ *
+ * @param[in] addr      the sensor address
+ * @param[in] now_usec  the current time, e.g. sht_time_now_usec()
+ *
+ * @return     0 if the command was successful, else an error code.
+ */
+int16_t sht3x_start_measurement(sht3x_i2c_addr_t addr, uint32_t now_usec);
+
+/**
+ * @brief Collects the result of a measurement started with
+ * sht3x_start_measurement() once it is due. The sensor is only accessed once
+ * the measurement duration has passed, or on every call with NACK polling
+ * enabled. In ART mode every call fetches until a new sample is available or
+ * the ART period has passed.
+ *
+ * @param[in]  addr         the sensor address
+ * @param[in]  now_usec     the current time, on the same clock as for the start
+ * @param[out] temperature  the address for the result of the temperature
+ * measurement
+ * @param[out] humidity     the address for the result of the relative humidity
+ * measurement
+ *
+ * @return     0 when the result was read, STATUS_NOT_READY while the
+ *             measurement is in progress, STATUS_ERR_NOT_STARTED without a
+ *             started measurement, else an error code.
+ */
+int16_t sht3x_poll_measurement(sht3x_i2c_addr_t addr, uint32_t now_usec,
+                               int32_t* temperature, int32_t* humidity);
+
+/**
+ * @brief Enable NACK polling for a sensor. Instead of waiting the maximum
+ * measurement duration, sht3x_measure_blocking_read() reads right away and
+ * sht3x_read() retries the read every interval_usec until the sensor
+ * acknowledges it, i.e. the measurement is done, or timeout_usec passed.
+ * Periodic and ART fetches are not retried.
+ *
+ * @param[in] addr          the sensor address
+ * @param[in] interval_usec time between read attempts, 0 disables polling
+ * @param[in] timeout_usec  maximum time to wait for the measurement, e.g.
+ *                          sht3x_get_measurement_duration_usec()
+ */
+void sht3x_set_nack_polling(sht3x_i2c_addr_t addr, uint16_t interval_usec,
+                            uint32_t timeout_usec);
+
+/**
+ * @brief Return the time the last polled sht3x_read() waited for the
+ * measurement to complete, with the resolution of the polling interval.
+ *
+ * @param[in] addr the sensor address
+ *
+ * @return     the measured conversion time in microseconds
+ */
+uint32_t sht3x_get_polled_duration_usec(sht3x_i2c_addr_t addr);
+
+/**
+ * @brief Starts periodic acquisition. The sensor measures on its own at the
+ * given rate and sht3x_fetch_periodic() reads out the latest measurement.
+ * Single shot measurements (sht3x_measure(), sht3x_measure_blocking_read())
+ * fail with STATUS_ERR_PERIODIC_MODE until sht3x_stop_periodic() is called.
+ * If periodic acquisition is already running, it is stopped first. The status
+ * register is cleared before the start, so that SHT3X_IS_SYSTEM_RST_DETECT()
+ * reports a reset during the acquisition.
+ *
+ * @param[in] addr          the sensor address
+ * @param[in] mps           the measurement rate
+ * @param[in] repeatability the repeatability, SHT3X_MEAS_MODE_LPM (low) to
+ *                          SHT3X_MEAS_MODE_HPM (high), or SHT3X_MEAS_MODE_ART
+ *                          to start ART mode (mps is ignored)
+ *
+ * @return          0 if the command was successful, else an error code.
+ */
+int16_t sht3x_start_periodic(sht3x_i2c_addr_t addr, sht3x_periodic_mps_t mps,
+                             sht3x_measurement_mode_t repeatability);
+
+/**
+ * @brief Reads out the latest measurement of the periodic acquisition or ART
+ * mode with a single Fetch Data command. The sensor answers each measurement
+ * only once; if no new measurement is available yet, the read is not
+ * acknowledged and an error is returned.
+ * Temperature is returned in [degree Celsius], multiplied by 1000,
+ * and relative humidity in [percent relative humidity], multiplied by 1000.
+ *
+ * @param[in]  addr the sensor address
+ * @param[out] temperature   the address for the result of the temperature
+ * measurement
+ * @param[out] humidity      the address for the result of the relative humidity
+ * measurement
+ *
+ * @return     0 if the command was successful, STATUS_ERR_PERIODIC_MODE if
+ *             periodic acquisition is not running, else an error code.
+ */
+int16_t sht3x_fetch_periodic(sht3x_i2c_addr_t addr, int32_t* temperature,
+                             int32_t* humidity);
+
+/**
+ * @brief Same as sht3x_fetch_periodic() but returns the CRC checked raw ticks
+ * of the sensor. Convert them with tick_to_temperature() and
+ * tick_to_humidity().
+ *
+ * @param[in]  addr              the sensor address
+ * @param[out] temperature_ticks the address for the temperature ticks
+ * @param[out] humidity_ticks    the address for the humidity ticks
+ *
+ * @return     0 if the command was successful, STATUS_ERR_PERIODIC_MODE if
+ *             periodic acquisition is not running, else an error code.
+ */
+int16_t sht3x_fetch_periodic_raw(sht3x_i2c_addr_t addr,
+                                 uint16_t* temperature_ticks,
+                                 uint16_t* humidity_ticks);
+
+/**
+ * @brief Stops periodic acquisition or ART mode (Break command) and returns
+ * the sensor to single shot mode.
+ *
+ * @param[in] addr the sensor address
+ *
+ * @return          0 if the command was successful, else an error code.
+ */
+int16_t sht3x_stop_periodic(sht3x_i2c_addr_t addr);
+
 /**
  * @brief Enable or disable the SHT's low power mode
  *
@@ -177,10 +434,38 @@ void sht3x_enable_low_power_mode(uint8_t enable_low_power_mode);
 /**
  * @brief Set the desired sensor's operating power mode
  *
+ * With SHT3X_MEAS_MODE_ART, sht3x_measure() starts the accelerated response
+ * time mode (periodic acquisition at 4Hz, started like with
+ * sht3x_start_periodic()) unless it is already running, and
+ * sht3x_measure_blocking_read() waits for the next new sample. Use
+ * sht3x_fetch_periodic() to read a sample without waiting and
+ * sht3x_stop_periodic() to leave ART mode.
+ *
  * @param[in] mode power mode selector
  */
 void sht3x_set_power_mode(sht3x_measurement_mode_t mode);
 
+/**
+ * @brief Return the maximum measurement duration of the configured power mode,
+ * i.e. the time to wait between sht3x_measure() and sht3x_read(). In ART mode
+ * this is the sample period.
+ *
+ * @return     the measurement duration in microseconds
+ */
+uint32_t sht3x_get_measurement_duration_usec(void);
+
+/**
+ * @brief Return the acquisition state the driver put the sensor in. Evaluate
+ * it with SHT3X_IS_PERIODIC_ACTIVE() and SHT3X_IS_ART_ACTIVE(); ART mode
+ * reports both. The sensor's status register has no acquisition mode bits, a
+ * sensor reset (e.g. sensirion_i2c_general_call_reset()) is not reflected.
+ *
+ * @param[in] addr the sensor address
+ *
+ * @return     the acquisition state, 0 in single shot mode
+ */
+uint8_t sht3x_get_acquisition_state(sht3x_i2c_addr_t addr);
+
 /**
  * @brief Read out the serial number
  *
@@ -211,6 +496,52 @@ const char* sht3x_get_driver_version(void);
 int16_t sht3x_set_alert_thd(sht3x_i2c_addr_t addr, sht3x_alert_thd_t thd,
                             uint32_t humidity, int32_t temperature);
 
+/**
+ * @brief Returns the alert limit word of a threshold, see
+ * SHT3X_ALERT_LIMIT_WORD
+ *
+ * @param[in] humidity    humidity threshold in 1000*%RH
+ * @param[in] temperature temperature threshold in 1000*°C
+ *
+ * @return          the limit word as written by sht3x_set_alert_thd()
+ */
+uint16_t sht3x_alert_limit_word(uint32_t humidity, int32_t temperature);
+
+/**
+ * @brief Writes all four alert limits as precomputed limit words, back to
+ * back and without any conversion. With SHT3X_VERIFY_STATUS the status word
+ * is read after each write, since its checksum flag covers the last command
+ * only, and the limits are only read back and compared if the sensor reports
+ * a checksum failure for any of them. The limits can only be written in
+ * single shot mode.
+ *
+ * @param[in] addr   the sensor address
+ * @param[in] words  the limit words indexed by sht3x_alert_thd_t
+ * @param[in] verify the verification of the written limits
+ *
+ * @return          0 if the command was successful, STATUS_ERR_BAD_DATA if a
+ *                  limit read back differs, STATUS_ERR_PERIODIC_MODE if the
+ *                  sensor is not in single shot mode, else an error code.
+ */
+int16_t sht3x_set_alert_words(sht3x_i2c_addr_t addr, const uint16_t* words,
+                              sht3x_verify_t verify);
+
+/**
+ * @brief Reads the status register and re-provisions the sensor if it reports
+ * a reset (SHT3X_IS_SYSTEM_RST_DETECT), e.g. after a brown-out: the alert
+ * limits written with sht3x_set_alert_thd() and the periodic acquisition or
+ * ART mode are restored from the driver's cache and the status register is
+ * cleared. Since the cache is what was programmed, no read back with
+ * sht3x_get_alert_thd() is needed. Call it periodically; in event mode
+ * sht3x_poll_event() does it on every status read.
+ *
+ * @param[in]  addr   the sensor address
+ * @param[out] status the status word read before the re-provisioning
+ *
+ * @return          0 if the command was successful, else an error code.
+ */
+int16_t sht3x_check_reset(sht3x_i2c_addr_t addr, uint16_t* status);
+
 /**
  * @brief Get target temperature and humidity alert threshold
  *
@@ -224,6 +555,133 @@ int16_t sht3x_set_alert_thd(sht3x_i2c_addr_t addr, sht3x_alert_thd_t thd,
 int16_t sht3x_get_alert_thd(sht3x_i2c_addr_t addr, sht3x_alert_thd_t thd,
                             int32_t* humidity, int32_t* temperature);
 
+/**
+ * @brief Starts the event mode: programs the alert limits, clears the status
+ * register and starts periodic acquisition. The sensor then compares every
+ * sample with the limits and flags crossings in the status register and on
+ * its ALERT pin, so that sht3x_poll_event() only reads the measurement when
+ * an alert is pending.
+ *
+ * @param[in] addr          the sensor address
+ * @param[in] limits        the limits indexed by sht3x_alert_thd_t, NULL to
+ *                          keep the programmed limits
+ * @param[in] mps           the measurement rate
+ * @param[in] repeatability the repeatability, SHT3X_MEAS_MODE_LPM to
+ *                          SHT3X_MEAS_MODE_HPM
+ * @param[in] source        poll the status register or wait for the ALERT pin
+ *
+ * @return          0 if the command was successful, else an error code.
+ */
+int16_t sht3x_start_event_mode(sht3x_i2c_addr_t addr,
+                               const sht3x_alert_limit_t* limits,
+                               sht3x_periodic_mps_t mps,
+                               sht3x_measurement_mode_t repeatability,
+                               sht3x_event_source_t source);
+
+/**
+ * @brief Notes a level change of the ALERT pin for the next
+ * sht3x_poll_event(). Only touches the device context and may be called
+ * from an interrupt handler.
+ *
+ * @param[in] addr the sensor address
+ */
+void sht3x_signal_alert(sht3x_i2c_addr_t addr);
+
+/**
+ * @brief Checks for an alert in event mode. With SHT3X_EVENT_STATUS this
+ * reads one status word; with SHT3X_EVENT_ALERT_PIN the bus is only accessed
+ * after sht3x_signal_alert(). On a pending alert, the status register is
+ * cleared and the latest measurement fetched.
+ * Temperature is returned in [degree Celsius], multiplied by 1000,
+ * and relative humidity in [percent relative humidity], multiplied by 1000.
+ *
+ * @param[in]  addr        the sensor address
+ * @param[out] status      the status word with the alert tracking bits, see
+ *                         SHT3X_IS_ALRT_RH_TRACK and SHT3X_IS_ALRT_T_TRACK
+ * @param[out] temperature the address for the temperature
+ * @param[out] humidity    the address for the relative humidity
+ *
+ * @return     0 if an alert was pending and the measurement was read,
+ *             STATUS_NOT_READY if no alert is pending or the sensor was
+ *             re-provisioned after a reset (see sht3x_check_reset()),
+ *             STATUS_ERR_NOT_STARTED if the event mode is not running,
+ *             else an error code.
+ */
+int16_t sht3x_poll_event(sht3x_i2c_addr_t addr, uint16_t* status,
+                         int32_t* temperature, int32_t* humidity);
+
+/**
+ * @brief Stops the event mode and periodic acquisition
+ *
+ * @param[in] addr the sensor address
+ *
+ * @return          0 if the command was successful, else an error code.
+ */
+int16_t sht3x_stop_event_mode(sht3x_i2c_addr_t addr);
+
+/**
+ * @brief Initialize a device context in single shot high repeatability mode
+ * without NACK polling
+ *
+ * @param[out] dev  the device context
+ * @param[in]  addr the sensor address
+ * @param[in]  bus  the bus index, SHT_BUS_DEFAULT to use the current bus
+ */
+void sht3x_dev_init(sht3x_dev_t* dev, sht3x_i2c_addr_t addr, uint8_t bus);
+
+/**
+ * The following functions behave like their address based counterparts but
+ * act on a device context: they select the context's bus, use its settings
+ * and state, and count successful measurements and errors in dev->stats.
+ */
+int16_t sht3x_dev_probe(sht3x_dev_t* dev);
+int16_t sht3x_dev_measure_blocking_read(sht3x_dev_t* dev, int32_t* temperature,
+                                        int32_t* humidity);
+int16_t sht3x_dev_measure(sht3x_dev_t* dev);
+int16_t sht3x_dev_read(sht3x_dev_t* dev, int32_t* temperature,
+                       int32_t* humidity);
+int16_t sht3x_dev_measure_blocking_read_raw(sht3x_dev_t* dev,
+                                            uint16_t* temperature_ticks,
+                                            uint16_t* humidity_ticks);
+int16_t sht3x_dev_read_raw(sht3x_dev_t* dev, uint16_t* temperature_ticks,
+                           uint16_t* humidity_ticks);
+int16_t sht3x_dev_start_measurement(sht3x_dev_t* dev, uint32_t now_usec);
+int16_t sht3x_dev_poll_measurement(sht3x_dev_t* dev, uint32_t now_usec,
+                                   int32_t* temperature, int32_t* humidity);
+void sht3x_dev_set_power_mode(sht3x_dev_t* dev, sht3x_measurement_mode_t mode);
+uint32_t sht3x_dev_get_measurement_duration_usec(const sht3x_dev_t* dev);
+void sht3x_dev_set_nack_polling(sht3x_dev_t* dev, uint16_t interval_usec,
+                                uint32_t timeout_usec);
+uint32_t sht3x_dev_get_polled_duration_usec(const sht3x_dev_t* dev);
+int16_t sht3x_dev_start_periodic(sht3x_dev_t* dev, sht3x_periodic_mps_t mps,
+                                 sht3x_measurement_mode_t repeatability);
+int16_t sht3x_dev_fetch_periodic(sht3x_dev_t* dev, int32_t* temperature,
+                                 int32_t* humidity);
+int16_t sht3x_dev_fetch_periodic_raw(sht3x_dev_t* dev,
+                                     uint16_t* temperature_ticks,
+                                     uint16_t* humidity_ticks);
+int16_t sht3x_dev_stop_periodic(sht3x_dev_t* dev);
+uint8_t sht3x_dev_get_acquisition_state(const sht3x_dev_t* dev);
+int16_t sht3x_dev_get_status(sht3x_dev_t* dev, uint16_t* status);
+int16_t sht3x_dev_clear_status(sht3x_dev_t* dev);
+int16_t sht3x_dev_read_serial(sht3x_dev_t* dev, uint32_t* serial);
+int16_t sht3x_dev_set_alert_thd(sht3x_dev_t* dev, sht3x_alert_thd_t thd,
+                                uint32_t humidity, int32_t temperature);
+int16_t sht3x_dev_get_alert_thd(sht3x_dev_t* dev, sht3x_alert_thd_t thd,
+                                int32_t* humidity, int32_t* temperature);
+int16_t sht3x_dev_set_alert_words(sht3x_dev_t* dev, const uint16_t* words,
+                                  sht3x_verify_t verify);
+int16_t sht3x_dev_check_reset(sht3x_dev_t* dev, uint16_t* status);
+int16_t sht3x_dev_start_event_mode(sht3x_dev_t* dev,
+                                   const sht3x_alert_limit_t* limits,
+                                   sht3x_periodic_mps_t mps,
+                                   sht3x_measurement_mode_t repeatability,
+                                   sht3x_event_source_t source);
+void sht3x_dev_signal_alert(sht3x_dev_t* dev);
+int16_t sht3x_dev_poll_event(sht3x_dev_t* dev, uint16_t* status,
+                             int32_t* temperature, int32_t* humidity);
+int16_t sht3x_dev_stop_event_mode(sht3x_dev_t* dev);
+
 /**
  * @brief converts temperature from ADC ticks
  *
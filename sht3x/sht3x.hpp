@@ -0,0 +1,183 @@
+/*
+ * Copyright (c) 2026, Sensirion AG
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * * Redistributions of source code must retain the above copyright notice, this
+ *   list of conditions and the following disclaimer.
+ *
+ * * Redistributions in binary form must reproduce the above copyright notice,
+ *   this list of conditions and the following disclaimer in the documentation
+ *   and/or other materials provided with the distribution.
+ *
+ * * Neither the name of Sensirion AG nor the names of its
+ *   contributors may be used to endorse or promote products derived from
+ *   this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * \file
+ *
+ * \brief Header-only C++11 interface to the SHT3x
+ *
+ * Sht3x<Addr, Mode, ClockStretch> fixes the I2C address, the repeatability
+ * and the clock stretching setting at compile time. The command word, the
+ * conversion duration and the conversion formulas are constants, the
+ * functions call the sensirion_i2c.h primitives directly and need neither a
+ * device context nor sht3x.c.
+ *
+ * Periodic acquisition, ART, alert limits, NACK polling and bus selection
+ * are only available through the C interface in sht3x.h.
+ */
+
+#ifndef SHT3X_HPP
+#define SHT3X_HPP
+
+#include "sensirion_arch_config.h"
+#include "sensirion_common.h"
+#include "sensirion_i2c.h"
+#include "sht3x.h"
+
+namespace sht {
+
+/**
+ * SHT3x at address Addr measuring with repeatability Mode. With ClockStretch
+ * the sensor holds the bus during the conversion and the blocking reads do
+ * not sleep. The functions return the STATUS_* codes of sht3x.h.
+ *
+ *     typedef sht::Sht3x<SHT3X_I2C_ADDR_ALT, SHT3X_MEAS_MODE_LPM> Sensor;
+ *     ret = Sensor::measure_blocking_read(&temperature, &humidity);
+ */
+template <sht3x_i2c_addr_t Addr = SHT3X_I2C_ADDR_DFLT,
+          sht3x_measurement_mode_t Mode = SHT3X_MEAS_MODE_HPM,
+          bool ClockStretch = false>
+class Sht3x {
+    static_assert(Mode != SHT3X_MEAS_MODE_ART,
+                  "ART is a periodic mode, use the C interface");
+
+  public:
+    static constexpr uint8_t address = Addr;
+
+    static constexpr uint16_t cmd_measure =
+        ClockStretch
+            ? (Mode == SHT3X_MEAS_MODE_LPM   ? SHT3X_CMD_MEASURE_LPM_STRETCH
+               : Mode == SHT3X_MEAS_MODE_MPM ? SHT3X_CMD_MEASURE_MPM_STRETCH
+                                             : SHT3X_CMD_MEASURE_HPM_STRETCH)
+            : (Mode == SHT3X_MEAS_MODE_LPM ? SHT3X_CMD_MEASURE_LPM_NO_STRETCH
+               : Mode == SHT3X_MEAS_MODE_MPM
+                   ? SHT3X_CMD_MEASURE_MPM_NO_STRETCH
+                   : SHT3X_CMD_MEASURE_HPM_NO_STRETCH);
+
+    static constexpr uint32_t measurement_duration_usec =
+        Mode == SHT3X_MEAS_MODE_LPM   ? SHT3X_MEASUREMENT_DURATION_LPM_USEC
+        : Mode == SHT3X_MEAS_MODE_MPM ? SHT3X_MEASUREMENT_DURATION_MPM_USEC
+                                      : SHT3X_MEASUREMENT_DURATION_USEC;
+
+    /**
+     * Same formulas as tick_to_temperature() and tick_to_humidity() in
+     * sht3x.h, usable in constant expressions.
+     */
+    static constexpr int32_t tick_to_temperature(uint16_t tick) {
+        return ((21875 * (int32_t)tick) >> 13) - 45000;
+    }
+
+    static constexpr int32_t tick_to_humidity(uint16_t tick) {
+        return ((12500 * (int32_t)tick) >> 13);
+    }
+
+    static constexpr uint16_t temperature_to_tick(int32_t temperature) {
+        return (uint16_t)(((int64_t)temperature * 12271 + 552195000) >> 15);
+    }
+
+    static constexpr uint16_t humidity_to_tick(int32_t humidity) {
+        return (uint16_t)(((int64_t)humidity * 21474) >> 15);
+    }
+
+    static int16_t measure() {
+        return sensirion_i2c_write_cmd(Addr, cmd_measure);
+    }
+
+    static int16_t read_raw(uint16_t* temperature_ticks,
+                            uint16_t* humidity_ticks) {
+        uint16_t words[2];
+        int16_t ret =
+            sensirion_i2c_read_words(Addr, words, SENSIRION_NUM_WORDS(words));
+        if (ret == STATUS_OK) {
+            *temperature_ticks = words[0];
+            *humidity_ticks = words[1];
+        }
+        return ret;
+    }
+
+    static int16_t read(int32_t* temperature, int32_t* humidity) {
+        uint16_t ticks[2];
+        return convert(read_raw(&ticks[0], &ticks[1]), ticks, temperature,
+                       humidity);
+    }
+
+    static int16_t measure_blocking_read_raw(uint16_t* temperature_ticks,
+                                             uint16_t* humidity_ticks) {
+        int16_t ret = measure();
+        if (ret)
+            return ret;
+        if (!ClockStretch)
+            sensirion_sleep_usec(measurement_duration_usec);
+        return read_raw(temperature_ticks, humidity_ticks);
+    }
+
+    static int16_t measure_blocking_read(int32_t* temperature,
+                                         int32_t* humidity) {
+        uint16_t ticks[2];
+        return convert(measure_blocking_read_raw(&ticks[0], &ticks[1]), ticks,
+                       temperature, humidity);
+    }
+
+    static int16_t read_serial(uint32_t* serial) {
+        uint8_t serial_bytes[4];
+        int16_t ret = sensirion_i2c_write_cmd(Addr, SHT3X_CMD_READ_SERIAL_ID);
+        if (ret)
+            return ret;
+        sensirion_sleep_usec(SHT3X_CMD_DURATION_USEC);
+        ret = sensirion_i2c_read_words_as_bytes(
+            Addr, serial_bytes, SENSIRION_NUM_WORDS(serial_bytes));
+        if (ret == STATUS_OK)
+            *serial = sensirion_bytes_to_uint32_t(serial_bytes);
+        return ret;
+    }
+
+  private:
+    static int16_t convert(int16_t ret, const uint16_t* ticks,
+                           int32_t* temperature, int32_t* humidity) {
+        if (ret == STATUS_OK) {
+            *temperature = tick_to_temperature(ticks[0]);
+            *humidity = tick_to_humidity(ticks[1]);
+        }
+        return ret;
+    }
+};
+
+/* out of class definitions for C++11, redundant but allowed since C++17 */
+template <sht3x_i2c_addr_t A, sht3x_measurement_mode_t M, bool S>
+constexpr uint8_t Sht3x<A, M, S>::address;
+template <sht3x_i2c_addr_t A, sht3x_measurement_mode_t M, bool S>
+constexpr uint16_t Sht3x<A, M, S>::cmd_measure;
+template <sht3x_i2c_addr_t A, sht3x_measurement_mode_t M, bool S>
+constexpr uint32_t Sht3x<A, M, S>::measurement_duration_usec;
+
+}  // namespace sht
+
+#endif /* SHT3X_HPP */
@@ -42,79 +42,273 @@
 #include "sensirion_arch_config.h"
 #include "sensirion_common.h"
 #include "sensirion_i2c.h"
-
-/* all measurement commands return T (CRC) RH (CRC) */
-#define SHT4X_CMD_MEASURE_HPM 0xFD
-#define SHT4X_CMD_MEASURE_LPM 0xE0
-#define SHT4X_CMD_READ_SERIAL 0x89
-#define SHT4X_CMD_DURATION_USEC 1000
+#include "sht_threshold.h"
+#include "sht_time.h"
 
 #define SHT4X_ADDRESS 0x44
 
-static uint8_t sht4x_cmd_measure = SHT4X_CMD_MEASURE_HPM;
-static uint16_t sht4x_cmd_measure_delay_us = SHT4X_MEASUREMENT_DURATION_USEC;
+/* context behind the API without device context */
+static sht4x_dev_t sht4x_default_dev = {
+    SHT4X_ADDRESS, SHT_BUS_DEFAULT, SHT4X_CMD_MEASURE_HPM,
+    SHT4X_MEASUREMENT_DURATION_USEC, SHT4X_MEAS_MODE_HPM, {0, 0, 0}, {0, 0},
+    0, 0, NULL};
 
-int16_t sht4x_measure_blocking_read(int32_t* temperature, int32_t* humidity) {
+void sht4x_dev_init(sht4x_dev_t* dev, uint8_t addr, uint8_t bus) {
+    dev->addr = addr;
+    dev->bus = bus;
+    dev->poll.interval_usec = 0;
+    dev->poll.timeout_usec = 0;
+    dev->poll.last_wait_usec = 0;
+    dev->stats.measurements = 0;
+    dev->stats.errors = 0;
+    dev->pending = 0;
+    dev->start_usec = 0;
+    dev->alert = NULL;
+    sht4x_dev_set_power_mode(dev, SHT4X_MEAS_MODE_HPM);
+}
+
+static int16_t sht4x_convert_ticks(int16_t ret, uint16_t temperature_ticks,
+                                   uint16_t humidity_ticks,
+                                   int32_t* temperature, int32_t* humidity) {
+    if (ret == STATUS_OK) {
+        sht4x_tick_to_temperature(temperature_ticks, temperature);
+        sht4x_tick_to_humidity(humidity_ticks, humidity);
+    }
+    return ret;
+}
+
+int16_t sht4x_dev_measure_blocking_read(sht4x_dev_t* dev, int32_t* temperature,
+                                        int32_t* humidity) {
+    uint16_t temperature_ticks, humidity_ticks;
+    int16_t ret = sht4x_dev_measure_blocking_read_raw(dev, &temperature_ticks,
+                                                      &humidity_ticks);
+    return sht4x_convert_ticks(ret, temperature_ticks, humidity_ticks,
+                               temperature, humidity);
+}
+
+int16_t sht4x_dev_measure_blocking_read_raw(sht4x_dev_t* dev,
+                                            uint16_t* temperature_ticks,
+                                            uint16_t* humidity_ticks) {
     int16_t ret;
 
-    ret = sht4x_measure();
+    ret = sht4x_dev_measure(dev);
     if (ret)
         return ret;
-    sensirion_sleep_usec(sht4x_cmd_measure_delay_us);
-    return sht4x_read(temperature, humidity);
+    if (!dev->poll.interval_usec)
+        sensirion_sleep_usec(dev->measure_delay_usec);
+    return sht4x_dev_read_raw(dev, temperature_ticks, humidity_ticks);
 }
 
-int16_t sht4x_measure(void) {
-    return sensirion_i2c_write(SHT4X_ADDRESS, &sht4x_cmd_measure, 1);
+int16_t sht4x_dev_measure(sht4x_dev_t* dev) {
+    int16_t ret = sht_dev_select_bus(dev->bus);
+    if (ret == STATUS_OK)
+        ret = sensirion_i2c_write(dev->addr, &dev->cmd_measure, 1);
+    return sht_dev_count(&dev->stats, ret, 0);
 }
 
-int16_t sht4x_read(int32_t* temperature, int32_t* humidity) {
+int16_t sht4x_dev_start_measurement(sht4x_dev_t* dev, uint32_t now_usec) {
+    int16_t ret = sht4x_dev_measure(dev);
+    if (ret)
+        return ret;
+
+    dev->pending = 1;
+    dev->start_usec = now_usec;
+    return STATUS_OK;
+}
+
+int16_t sht4x_dev_poll_measurement(sht4x_dev_t* dev, uint32_t now_usec,
+                                   int32_t* temperature, int32_t* humidity) {
     uint16_t words[2];
-    int16_t ret = sensirion_i2c_read_words(SHT4X_ADDRESS, words,
-                                           SENSIRION_NUM_WORDS(words));
-    /**
-     * formulas for conversion of the sensor signals, optimized for fixed point
-     * algebra:
-     * Temperature = 175 * S_T / 65535 - 45
-     * Relative Humidity = 125 * (S_RH / 65535) - 6
-     */
-    *temperature = ((21875 * (int32_t)words[0]) >> 13) - 45000;
-    *humidity = ((15625 * (int32_t)words[1]) >> 13) - 6000;
+    uint8_t early;
+    int16_t ret;
 
-    return ret;
+    if (!dev->pending)
+        return STATUS_ERR_NOT_STARTED;
+
+    early = !SHT_TIME_REACHED(now_usec,
+                              dev->start_usec + dev->measure_delay_usec);
+    if (early && !dev->poll.interval_usec)
+        return STATUS_NOT_READY;
+
+    ret = sht_dev_select_bus(dev->bus);
+    if (ret == STATUS_OK)
+        ret = sensirion_i2c_read_words(dev->addr, words,
+                                       SENSIRION_NUM_WORDS(words));
+    if (ret != STATUS_OK && early)
+        return STATUS_NOT_READY; /* NACKed, still measuring */
+
+    dev->pending = 0;
+    if (ret == STATUS_OK) {
+        sht4x_tick_to_temperature(words[0], temperature);
+        sht4x_tick_to_humidity(words[1], humidity);
+        if (dev->alert)
+            sht_alert_update(dev->alert, words[0], words[1]);
+        if (dev->poll.interval_usec)
+            dev->poll.last_wait_usec = now_usec - dev->start_usec;
+    }
+    return sht_dev_count(&dev->stats, ret, 1);
 }
 
-int16_t sht4x_probe(void) {
+int16_t sht4x_dev_read(sht4x_dev_t* dev, int32_t* temperature,
+                       int32_t* humidity) {
+    uint16_t temperature_ticks, humidity_ticks;
+    int16_t ret = sht4x_dev_read_raw(dev, &temperature_ticks, &humidity_ticks);
+    return sht4x_convert_ticks(ret, temperature_ticks, humidity_ticks,
+                               temperature, humidity);
+}
+
+int16_t sht4x_dev_read_raw(sht4x_dev_t* dev, uint16_t* temperature_ticks,
+                           uint16_t* humidity_ticks) {
+    uint16_t words[2];
+    int16_t ret = sht_dev_select_bus(dev->bus);
+
+    if (ret)
+        return sht_dev_count(&dev->stats, ret, 0);
+    if (dev->poll.interval_usec)
+        ret = sht_poll_read_words(dev->addr, words, SENSIRION_NUM_WORDS(words),
+                                  &dev->poll);
+    else
+        ret = sensirion_i2c_read_words(dev->addr, words,
+                                       SENSIRION_NUM_WORDS(words));
+    if (ret == STATUS_OK) {
+        *temperature_ticks = words[0];
+        *humidity_ticks = words[1];
+        if (dev->alert)
+            sht_alert_update(dev->alert, words[0], words[1]);
+    }
+    return sht_dev_count(&dev->stats, ret, 1);
+}
+
+int16_t sht4x_dev_probe(sht4x_dev_t* dev) {
     uint32_t serial;
 
-    return sht4x_read_serial(&serial);
+    return sht4x_dev_read_serial(dev, &serial);
 }
 
-void sht4x_enable_low_power_mode(uint8_t enable_low_power_mode) {
-    if (enable_low_power_mode) {
-        sht4x_cmd_measure = SHT4X_CMD_MEASURE_LPM;
-        sht4x_cmd_measure_delay_us = SHT4X_MEASUREMENT_DURATION_LPM_USEC;
-    } else {
-        sht4x_cmd_measure = SHT4X_CMD_MEASURE_HPM;
-        sht4x_cmd_measure_delay_us = SHT4X_MEASUREMENT_DURATION_USEC;
+void sht4x_dev_set_power_mode(sht4x_dev_t* dev, sht4x_measurement_mode_t mode) {
+    switch (mode) {
+        case SHT4X_MEAS_MODE_LPM:
+            dev->cmd_measure = SHT4X_CMD_MEASURE_LPM;
+            dev->measure_delay_usec = SHT4X_MEASUREMENT_DURATION_LPM_USEC;
+            break;
+        case SHT4X_MEAS_MODE_MPM:
+            dev->cmd_measure = SHT4X_CMD_MEASURE_MPM;
+            dev->measure_delay_usec = SHT4X_MEASUREMENT_DURATION_MPM_USEC;
+            break;
+        default:
+            dev->cmd_measure = SHT4X_CMD_MEASURE_HPM;
+            dev->measure_delay_usec = SHT4X_MEASUREMENT_DURATION_USEC;
+            mode = SHT4X_MEAS_MODE_HPM;
+            break;
     }
+    dev->mode = (uint8_t)mode;
 }
 
-int16_t sht4x_read_serial(uint32_t* serial) {
+uint32_t sht4x_dev_get_measurement_duration_usec(const sht4x_dev_t* dev) {
+    return dev->measure_delay_usec;
+}
+
+void sht4x_dev_set_nack_polling(sht4x_dev_t* dev, uint16_t interval_usec,
+                                uint32_t timeout_usec) {
+    dev->poll.interval_usec = interval_usec;
+    dev->poll.timeout_usec = timeout_usec;
+    dev->poll.last_wait_usec = 0;
+}
+
+uint32_t sht4x_dev_get_polled_duration_usec(const sht4x_dev_t* dev) {
+    return dev->poll.last_wait_usec;
+}
+
+void sht4x_dev_set_alert(sht4x_dev_t* dev, sht_alert_t* alert) {
+    dev->alert = alert;
+}
+
+int16_t sht4x_dev_read_serial(sht4x_dev_t* dev, uint32_t* serial) {
     const uint8_t cmd = SHT4X_CMD_READ_SERIAL;
     int16_t ret;
     uint16_t serial_words[SENSIRION_NUM_WORDS(*serial)];
 
-    ret = sensirion_i2c_write(SHT4X_ADDRESS, &cmd, 1);
+    ret = sht_dev_select_bus(dev->bus);
+    if (ret == STATUS_OK)
+        ret = sensirion_i2c_write(dev->addr, &cmd, 1);
     if (ret)
-        return ret;
+        return sht_dev_count(&dev->stats, ret, 0);
 
     sensirion_sleep_usec(SHT4X_CMD_DURATION_USEC);
-    ret = sensirion_i2c_read_words(SHT4X_ADDRESS, serial_words,
+    ret = sensirion_i2c_read_words(dev->addr, serial_words,
                                    SENSIRION_NUM_WORDS(serial_words));
     *serial = ((uint32_t)serial_words[0] << 16) | serial_words[1];
 
-    return ret;
+    return sht_dev_count(&dev->stats, ret, 0);
+}
+
+int16_t sht4x_measure_blocking_read(int32_t* temperature, int32_t* humidity) {
+    return sht4x_dev_measure_blocking_read(&sht4x_default_dev, temperature,
+                                           humidity);
+}
+
+int16_t sht4x_measure(void) {
+    return sht4x_dev_measure(&sht4x_default_dev);
+}
+
+int16_t sht4x_read(int32_t* temperature, int32_t* humidity) {
+    return sht4x_dev_read(&sht4x_default_dev, temperature, humidity);
+}
+
+int16_t sht4x_measure_blocking_read_raw(uint16_t* temperature_ticks,
+                                        uint16_t* humidity_ticks) {
+    return sht4x_dev_measure_blocking_read_raw(&sht4x_default_dev,
+                                               temperature_ticks,
+                                               humidity_ticks);
+}
+
+int16_t sht4x_read_raw(uint16_t* temperature_ticks, uint16_t* humidity_ticks) {
+    return sht4x_dev_read_raw(&sht4x_default_dev, temperature_ticks,
+                              humidity_ticks);
+}
+
+int16_t sht4x_probe(void) {
+    return sht4x_dev_probe(&sht4x_default_dev);
+}
+
+void sht4x_enable_low_power_mode(uint8_t enable_low_power_mode) {
+    sht4x_set_power_mode(enable_low_power_mode ? SHT4X_MEAS_MODE_LPM
+                                               : SHT4X_MEAS_MODE_HPM);
+}
+
+void sht4x_set_power_mode(sht4x_measurement_mode_t mode) {
+    sht4x_dev_set_power_mode(&sht4x_default_dev, mode);
+}
+
+uint32_t sht4x_get_measurement_duration_usec(void) {
+    return sht4x_dev_get_measurement_duration_usec(&sht4x_default_dev);
+}
+
+int16_t sht4x_start_measurement(uint32_t now_usec) {
+    return sht4x_dev_start_measurement(&sht4x_default_dev, now_usec);
+}
+
+int16_t sht4x_poll_measurement(uint32_t now_usec, int32_t* temperature,
+                               int32_t* humidity) {
+    return sht4x_dev_poll_measurement(&sht4x_default_dev, now_usec, temperature,
+                                      humidity);
+}
+
+void sht4x_set_nack_polling(uint16_t interval_usec, uint32_t timeout_usec) {
+    sht4x_dev_set_nack_polling(&sht4x_default_dev, interval_usec,
+                               timeout_usec);
+}
+
+uint32_t sht4x_get_polled_duration_usec(void) {
+    return sht4x_dev_get_polled_duration_usec(&sht4x_default_dev);
+}
+
+void sht4x_set_alert(sht_alert_t* alert) {
+    sht4x_dev_set_alert(&sht4x_default_dev, alert);
+}
+
+int16_t sht4x_read_serial(uint32_t* serial) {
+    return sht4x_dev_read_serial(&sht4x_default_dev, serial);
 }
 
 const char* sht4x_get_driver_version(void) {
@@ -124,3 +318,25 @@ const char* sht4x_get_driver_version(void) {
 uint8_t sht4x_get_configured_address(void) {
     return SHT4X_ADDRESS;
 }
+
+/**
+ * formulas for conversion of the sensor signals, optimized for fixed point
+ * algebra:
+ * Temperature = 175 * S_T / 65535 - 45
+ * Relative Humidity = 125 * (S_RH / 65535) - 6
+ */
+void sht4x_tick_to_temperature(uint16_t tick, int32_t* temperature) {
+    *temperature = ((21875 * (int32_t)tick) >> 13) - 45000;
+}
+
+void sht4x_tick_to_humidity(uint16_t tick, int32_t* humidity) {
+    *humidity = ((15625 * (int32_t)tick) >> 13) - 6000;
+}
+
+void sht4x_temperature_to_tick(int32_t temperature, uint16_t* tick) {
+    *tick = sht_threshold_value_to_tick(21875, -45000, temperature);
+}
+
+void sht4x_humidity_to_tick(int32_t humidity, uint16_t* tick) {
+    *tick = sht_threshold_value_to_tick(15625, -6000, humidity);
+}
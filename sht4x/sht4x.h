@@ -43,7 +43,10 @@
 
 #include "sensirion_arch_config.h"
 #include "sensirion_i2c.h"
+#include "sht_alert.h"
+#include "sht_dev.h"
 #include "sht_git_version.h"
+#include "sht_poll.h"
 
 #ifdef __cplusplus
 extern "C" {
@@ -53,11 +56,58 @@ extern "C" {
 #define STATUS_ERR_BAD_DATA (-1)
 #define STATUS_CRC_FAIL (-2)
 #define STATUS_UNKNOWN_DEVICE (-3)
+#define STATUS_NOT_READY 1
+#define STATUS_ERR_NOT_STARTED (-6)
 #define SHT4X_MEASUREMENT_DURATION_USEC 10000 /* 10ms "high repeatability" */
+#define SHT4X_MEASUREMENT_DURATION_MPM_USEC \
+    5000 /* 5ms "medium repeatability"      \
+          */
 #define SHT4X_MEASUREMENT_DURATION_LPM_USEC \
     2500 /* 2.5ms "low repeatability"       \
           */
 
+/* command bytes, all measurement commands return T (CRC) RH (CRC) */
+#define SHT4X_CMD_MEASURE_HPM 0xFD
+#define SHT4X_CMD_MEASURE_MPM 0xF6
+#define SHT4X_CMD_MEASURE_LPM 0xE0
+#define SHT4X_CMD_READ_SERIAL 0x89
+#define SHT4X_CMD_DURATION_USEC 1000
+
+/**
+ * SHT4x measurement mode options (low, medium and high repeatability)
+ */
+typedef enum _sht4x_measurement_mode {
+    SHT4X_MEAS_MODE_LPM, /*low power mode*/
+    SHT4X_MEAS_MODE_MPM, /*medium power mode*/
+    SHT4X_MEAS_MODE_HPM  /*high power mode*/
+} sht4x_measurement_mode_t;
+
+/**
+ * SHT4x device context
+ *
+ * Holds the configuration and state of one sensor so that several sensors,
+ * e.g. on different buses or addresses, can be driven with independent
+ * settings. Initialize it with sht4x_dev_init() and treat the members as
+ * read-only. The functions without device context use an internal context on
+ * the default bus.
+ */
+typedef struct sht4x_dev {
+    uint8_t addr;
+    /* bus index passed to sensirion_i2c_select_bus() or SHT_BUS_DEFAULT */
+    uint8_t bus;
+    uint8_t cmd_measure;
+    uint32_t measure_delay_usec;
+    /* sht4x_measurement_mode_t, see sht4x_dev_set_power_mode */
+    uint8_t mode;
+    sht_poll_t poll;
+    sht_dev_stats_t stats;
+    /* non-blocking measurement in progress, see sht4x_dev_start_measurement */
+    uint8_t pending;
+    uint32_t start_usec;
+    /* software alert evaluated on every read, NULL if none */
+    sht_alert_t* alert;
+} sht4x_dev_t;
+
 /**
  * Detects if a sensor is connected by reading out the ID register.
  * If the sensor does not answer or if the answer is not the expected value,
@@ -94,7 +144,8 @@ int16_t sht4x_measure(void);
 /**
  * Reads out the results of a measurement that was previously started by
  * sht4x_measure(). If the measurement is still in progress, this function
- * returns an error.
+ * returns an error, or waits for it with NACK polling enabled (see
+ * sht4x_set_nack_polling()).
  * Temperature is returned in [degree Celsius], multiplied by 1000,
  * and relative humidity in [percent relative humidity], multiplied by 1000.
  *
@@ -106,6 +157,69 @@ int16_t sht4x_measure(void);
  */
 int16_t sht4x_read(int32_t* temperature, int32_t* humidity);
 
+/**
+ * Same as sht4x_measure_blocking_read() but returns the CRC checked raw ticks
+ * of the sensor. Convert them with sht4x_tick_to_temperature() and
+ * sht4x_tick_to_humidity().
+ *
+ * @param temperature_ticks the address for the temperature ticks
+ * @param humidity_ticks    the address for the humidity ticks
+ * @return                  0 if the command was successful, else an error
+ *                          code.
+ */
+int16_t sht4x_measure_blocking_read_raw(uint16_t* temperature_ticks,
+                                        uint16_t* humidity_ticks);
+
+/**
+ * Same as sht4x_read() but returns the CRC checked raw ticks of the sensor.
+ * Convert them with sht4x_tick_to_temperature() and sht4x_tick_to_humidity().
+ *
+ * @param temperature_ticks the address for the temperature ticks
+ * @param humidity_ticks    the address for the humidity ticks
+ * @return                  0 if the command was successful, else an error
+ *                          code.
+ */
+int16_t sht4x_read_raw(uint16_t* temperature_ticks, uint16_t* humidity_ticks);
+
+/**
+ * Convert temperature ticks of the sensor
+ *
+ * @param tick          sensor ticks
+ * @param temperature   temperature in [degree Celsius], multiplied by 1000
+ */
+void sht4x_tick_to_temperature(uint16_t tick, int32_t* temperature);
+
+/**
+ * Convert humidity ticks of the sensor
+ *
+ * @param tick      sensor ticks
+ * @param humidity  relative humidity in [percent relative humidity],
+ *                  multiplied by 1000
+ */
+void sht4x_tick_to_humidity(uint16_t tick, int32_t* humidity);
+
+/**
+ * Convert a temperature to sensor ticks, the inverse of
+ * sht4x_tick_to_temperature(). Returns the smallest tick that converts to at
+ * least the given temperature, so tick >= sht4x_temperature_to_tick(t) holds
+ * exactly when the converted temperature is >= t. Saturates at 0 and 0xFFFF.
+ *
+ * @param temperature   temperature in [degree Celsius], multiplied by 1000
+ * @param tick          sensor ticks
+ */
+void sht4x_temperature_to_tick(int32_t temperature, uint16_t* tick);
+
+/**
+ * Convert a relative humidity to sensor ticks, the inverse of
+ * sht4x_tick_to_humidity(). Returns the smallest tick that converts to at least
+ * the given humidity, saturated at 0 and 0xFFFF.
+ *
+ * @param humidity  relative humidity in [percent relative humidity],
+ *                  multiplied by 1000
+ * @param tick      sensor ticks
+ */
+void sht4x_humidity_to_tick(int32_t humidity, uint16_t* tick);
+
 /**
  * Enable or disable the SHT's low power mode
  *
@@ -113,6 +227,79 @@ int16_t sht4x_read(int32_t* temperature, int32_t* humidity);
  */
 void sht4x_enable_low_power_mode(uint8_t enable_low_power_mode);
 
+/**
+ * Set the measurement mode (repeatability) used by sht4x_measure() and
+ * sht4x_measure_blocking_read()
+ *
+ * @param mode  measurement mode selector
+ */
+void sht4x_set_power_mode(sht4x_measurement_mode_t mode);
+
+/**
+ * Return the maximum measurement duration of the configured measurement mode,
+ * i.e. the time to wait between sht4x_measure() and sht4x_read()
+ *
+ * @return  the measurement duration in microseconds
+ */
+uint32_t sht4x_get_measurement_duration_usec(void);
+
+/**
+ * Starts a non-blocking measurement in the configured mode and records when
+ * its result is due. Use sht4x_poll_measurement() to collect the result.
+ * Neither function sleeps.
+ *
+ * @param now_usec  the current time, e.g. sht_time_now_usec()
+ * @return          0 if the command was successful, else an error code.
+ */
+int16_t sht4x_start_measurement(uint32_t now_usec);
+
+/**
+ * Collects the result of a measurement started with sht4x_start_measurement()
+ * once it is due. The sensor is only accessed once the measurement duration
+ * has passed, or on every call with NACK polling enabled.
+ *
+ * @param now_usec      the current time, on the same clock as for the start
+ * @param temperature   the address for the result of the temperature
+ * measurement
+ * @param humidity      the address for the result of the relative humidity
+ * measurement
+ * @return              0 when the result was read, STATUS_NOT_READY while the
+ *                      measurement is in progress, STATUS_ERR_NOT_STARTED
+ *                      without a started measurement, else an error code.
+ */
+int16_t sht4x_poll_measurement(uint32_t now_usec, int32_t* temperature,
+                               int32_t* humidity);
+
+/**
+ * Enable NACK polling. Instead of waiting the maximum measurement duration,
+ * sht4x_measure_blocking_read() reads right away and sht4x_read() retries the
+ * read every interval_usec until the sensor acknowledges it, i.e. the
+ * measurement is done, or timeout_usec passed.
+ *
+ * @param interval_usec time between read attempts, 0 disables polling
+ * @param timeout_usec  maximum time to wait for the measurement, e.g.
+ *                      sht4x_get_measurement_duration_usec()
+ */
+void sht4x_set_nack_polling(uint16_t interval_usec, uint32_t timeout_usec);
+
+/**
+ * Return the time the last polled sht4x_read() waited for the measurement to
+ * complete, with the resolution of the polling interval.
+ *
+ * @return  the measured conversion time in microseconds
+ */
+uint32_t sht4x_get_polled_duration_usec(void);
+
+/**
+ * Attach a software alert that is evaluated on every measurement read, see
+ * sht_alert.h. Its callback runs in the read and its state follows the
+ * HIALRT/LOALRT limits like the alert pin of an SHT3x. Initialize it with
+ * sht_alert_init(alert, SHT_THRESHOLD_SHT4X).
+ *
+ * @param alert the alert, NULL to detach it
+ */
+void sht4x_set_alert(sht_alert_t* alert);
+
 /**
  * Read out the serial number
  *
@@ -135,6 +322,43 @@ const char* sht4x_get_driver_version(void);
  */
 uint8_t sht4x_get_configured_address(void);
 
+/**
+ * Initialize a device context in high repeatability mode without NACK polling
+ *
+ * @param dev   the device context
+ * @param addr  the sensor address, e.g. sht4x_get_configured_address()
+ * @param bus   the bus index, SHT_BUS_DEFAULT to use the current bus
+ */
+void sht4x_dev_init(sht4x_dev_t* dev, uint8_t addr, uint8_t bus);
+
+/**
+ * The following functions behave like their counterparts without device
+ * context but act on a device context: they select the context's bus, use its
+ * settings and state, and count successful measurements and errors in
+ * dev->stats.
+ */
+int16_t sht4x_dev_probe(sht4x_dev_t* dev);
+int16_t sht4x_dev_measure_blocking_read(sht4x_dev_t* dev, int32_t* temperature,
+                                        int32_t* humidity);
+int16_t sht4x_dev_measure(sht4x_dev_t* dev);
+int16_t sht4x_dev_read(sht4x_dev_t* dev, int32_t* temperature,
+                       int32_t* humidity);
+int16_t sht4x_dev_measure_blocking_read_raw(sht4x_dev_t* dev,
+                                            uint16_t* temperature_ticks,
+                                            uint16_t* humidity_ticks);
+int16_t sht4x_dev_read_raw(sht4x_dev_t* dev, uint16_t* temperature_ticks,
+                           uint16_t* humidity_ticks);
+int16_t sht4x_dev_start_measurement(sht4x_dev_t* dev, uint32_t now_usec);
+int16_t sht4x_dev_poll_measurement(sht4x_dev_t* dev, uint32_t now_usec,
+                                   int32_t* temperature, int32_t* humidity);
+void sht4x_dev_set_power_mode(sht4x_dev_t* dev, sht4x_measurement_mode_t mode);
+uint32_t sht4x_dev_get_measurement_duration_usec(const sht4x_dev_t* dev);
+void sht4x_dev_set_nack_polling(sht4x_dev_t* dev, uint16_t interval_usec,
+                                uint32_t timeout_usec);
+uint32_t sht4x_dev_get_polled_duration_usec(const sht4x_dev_t* dev);
+void sht4x_dev_set_alert(sht4x_dev_t* dev, sht_alert_t* alert);
+int16_t sht4x_dev_read_serial(sht4x_dev_t* dev, uint32_t* serial);
+
 #ifdef __cplusplus
 }
 #endif
@@ -0,0 +1,175 @@
+/*
+ * Copyright (c) 2026, Sensirion AG
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * * Redistributions of source code must retain the above copyright notice, this
+ *   list of conditions and the following disclaimer.
+ *
+ * * Redistributions in binary form must reproduce the above copyright notice,
+ *   this list of conditions and the following disclaimer in the documentation
+ *   and/or other materials provided with the distribution.
+ *
+ * * Neither the name of Sensirion AG nor the names of its
+ *   contributors may be used to endorse or promote products derived from
+ *   this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * \file
+ *
+ * \brief Header-only C++11 interface to the SHT4x
+ *
+ * Sht4x<Mode, Addr> fixes the repeatability and the I2C address at compile
+ * time. The command byte, the conversion duration and the conversion
+ * formulas are constants, the functions call the sensirion_i2c.h primitives
+ * directly and need neither a device context nor sht4x.c.
+ *
+ * NACK polling and bus selection are only available through the C interface
+ * in sht4x.h.
+ */
+
+#ifndef SHT4X_HPP
+#define SHT4X_HPP
+
+#include "sensirion_arch_config.h"
+#include "sensirion_common.h"
+#include "sensirion_i2c.h"
+#include "sht4x.h"
+#include "sht_threshold.h"
+
+namespace sht {
+
+/**
+ * SHT4x measuring with repeatability Mode. The default address is the one of
+ * sht4x_get_configured_address(). The functions return the STATUS_* codes of
+ * sht4x.h.
+ *
+ *     typedef sht::Sht4x<SHT4X_MEAS_MODE_MPM> Sensor;
+ *     ret = Sensor::measure_blocking_read(&temperature, &humidity);
+ */
+template <sht4x_measurement_mode_t Mode = SHT4X_MEAS_MODE_HPM,
+          uint8_t Addr = 0x44>
+class Sht4x {
+  public:
+    static constexpr uint8_t address = Addr;
+
+    static constexpr uint8_t cmd_measure =
+        Mode == SHT4X_MEAS_MODE_LPM   ? SHT4X_CMD_MEASURE_LPM
+        : Mode == SHT4X_MEAS_MODE_MPM ? SHT4X_CMD_MEASURE_MPM
+                                      : SHT4X_CMD_MEASURE_HPM;
+
+    static constexpr uint32_t measurement_duration_usec =
+        Mode == SHT4X_MEAS_MODE_LPM   ? SHT4X_MEASUREMENT_DURATION_LPM_USEC
+        : Mode == SHT4X_MEAS_MODE_MPM ? SHT4X_MEASUREMENT_DURATION_MPM_USEC
+                                      : SHT4X_MEASUREMENT_DURATION_USEC;
+
+    /**
+     * Same formulas as sht4x_tick_to_temperature(), sht4x_tick_to_humidity(),
+     * sht4x_temperature_to_tick() and sht4x_humidity_to_tick(), usable in
+     * constant expressions.
+     */
+    static constexpr int32_t tick_to_temperature(uint16_t tick) {
+        return ((21875 * (int32_t)tick) >> 13) - 45000;
+    }
+
+    static constexpr int32_t tick_to_humidity(uint16_t tick) {
+        return ((15625 * (int32_t)tick) >> 13) - 6000;
+    }
+
+    static constexpr uint16_t temperature_to_tick(int32_t temperature) {
+        return threshold_value_to_tick(21875, -45000, temperature);
+    }
+
+    static constexpr uint16_t humidity_to_tick(int32_t humidity) {
+        return threshold_value_to_tick(15625, -6000, humidity);
+    }
+
+    static int16_t measure() {
+        const uint8_t cmd = cmd_measure;
+        return sensirion_i2c_write(Addr, &cmd, 1);
+    }
+
+    static int16_t read_raw(uint16_t* temperature_ticks,
+                            uint16_t* humidity_ticks) {
+        uint16_t words[2];
+        int16_t ret =
+            sensirion_i2c_read_words(Addr, words, SENSIRION_NUM_WORDS(words));
+        if (ret == STATUS_OK) {
+            *temperature_ticks = words[0];
+            *humidity_ticks = words[1];
+        }
+        return ret;
+    }
+
+    static int16_t read(int32_t* temperature, int32_t* humidity) {
+        uint16_t ticks[2];
+        return convert(read_raw(&ticks[0], &ticks[1]), ticks, temperature,
+                       humidity);
+    }
+
+    static int16_t measure_blocking_read_raw(uint16_t* temperature_ticks,
+                                             uint16_t* humidity_ticks) {
+        int16_t ret = measure();
+        if (ret)
+            return ret;
+        sensirion_sleep_usec(measurement_duration_usec);
+        return read_raw(temperature_ticks, humidity_ticks);
+    }
+
+    static int16_t measure_blocking_read(int32_t* temperature,
+                                         int32_t* humidity) {
+        uint16_t ticks[2];
+        return convert(measure_blocking_read_raw(&ticks[0], &ticks[1]), ticks,
+                       temperature, humidity);
+    }
+
+    static int16_t read_serial(uint32_t* serial) {
+        const uint8_t cmd = SHT4X_CMD_READ_SERIAL;
+        uint16_t words[2];
+        int16_t ret = sensirion_i2c_write(Addr, &cmd, 1);
+        if (ret)
+            return ret;
+        sensirion_sleep_usec(SHT4X_CMD_DURATION_USEC);
+        ret = sensirion_i2c_read_words(Addr, words, SENSIRION_NUM_WORDS(words));
+        if (ret == STATUS_OK)
+            *serial = ((uint32_t)words[0] << 16) | words[1];
+        return ret;
+    }
+
+  private:
+    static int16_t convert(int16_t ret, const uint16_t* ticks,
+                           int32_t* temperature, int32_t* humidity) {
+        if (ret == STATUS_OK) {
+            *temperature = tick_to_temperature(ticks[0]);
+            *humidity = tick_to_humidity(ticks[1]);
+        }
+        return ret;
+    }
+};
+
+/* out of class definitions for C++11, redundant but allowed since C++17 */
+template <sht4x_measurement_mode_t M, uint8_t A>
+constexpr uint8_t Sht4x<M, A>::address;
+template <sht4x_measurement_mode_t M, uint8_t A>
+constexpr uint8_t Sht4x<M, A>::cmd_measure;
+template <sht4x_measurement_mode_t M, uint8_t A>
+constexpr uint32_t Sht4x<M, A>::measurement_duration_usec;
+
+}  // namespace sht
+
+#endif /* SHT4X_HPP */
@@ -44,105 +44,311 @@
 #include "sensirion_arch_config.h"
 #include "sensirion_common.h"
 #include "sensirion_i2c.h"
+#include "sht_threshold.h"
+#include "sht_time.h"
 
-/* all measurement commands return T (CRC) RH (CRC) */
 #if USE_SENSIRION_CLOCK_STRETCHING
-#define SHTC1_CMD_MEASURE_HPM 0x7CA2
-#define SHTC1_CMD_MEASURE_LPM 0x6458
+#define SHTC1_CMD_MEASURE_HPM SHTC1_CMD_MEASURE_HPM_STRETCH
+#define SHTC1_CMD_MEASURE_LPM SHTC1_CMD_MEASURE_LPM_STRETCH
 #else /* USE_SENSIRION_CLOCK_STRETCHING */
-#define SHTC1_CMD_MEASURE_HPM 0x7866
-#define SHTC1_CMD_MEASURE_LPM 0x609C
+#define SHTC1_CMD_MEASURE_HPM SHTC1_CMD_MEASURE_HPM_NO_STRETCH
+#define SHTC1_CMD_MEASURE_LPM SHTC1_CMD_MEASURE_LPM_NO_STRETCH
 #endif /* USE_SENSIRION_CLOCK_STRETCHING */
-static const uint16_t SHTC1_CMD_DURATION_USEC = 1000;
 
-static const uint16_t SHTC3_CMD_SLEEP = 0xB098;
-static const uint16_t SHTC3_CMD_WAKEUP = 0x3517;
 #ifdef SHT_ADDRESS
-static const uint8_t SHTC1_ADDRESS = SHT_ADDRESS;
+#define SHTC1_ADDRESS SHT_ADDRESS
 #else
-static const uint8_t SHTC1_ADDRESS = 0x70;
+#define SHTC1_ADDRESS 0x70
 #endif
 
-static uint16_t shtc1_cmd_measure = SHTC1_CMD_MEASURE_HPM;
+/* context behind the API without device context */
+static shtc1_dev_t shtc1_default_dev = {
+    SHTC1_ADDRESS, SHT_BUS_DEFAULT, SHTC1_CMD_MEASURE_HPM,
+    SHTC1_MEASUREMENT_DURATION_USEC, 0, {0, 0, 0}, {0, 0}, 0, 0, NULL};
 
-int16_t shtc1_sleep(void) {
-    return sensirion_i2c_write_cmd(SHTC1_ADDRESS, SHTC3_CMD_SLEEP);
+void shtc1_dev_init(shtc1_dev_t* dev, uint8_t bus) {
+    dev->addr = SHTC1_ADDRESS;
+    dev->bus = bus;
+    dev->poll.interval_usec = 0;
+    dev->poll.timeout_usec = 0;
+    dev->poll.last_wait_usec = 0;
+    dev->stats.measurements = 0;
+    dev->stats.errors = 0;
+    dev->pending = 0;
+    dev->start_usec = 0;
+    dev->alert = NULL;
+    shtc1_dev_enable_low_power_mode(dev, 0);
 }
 
-int16_t shtc1_wake_up(void) {
-    return sensirion_i2c_write_cmd(SHTC1_ADDRESS, SHTC3_CMD_WAKEUP);
+int16_t shtc1_dev_sleep(shtc1_dev_t* dev) {
+    int16_t ret = sht_dev_select_bus(dev->bus);
+    if (ret == STATUS_OK)
+        ret = sensirion_i2c_write_cmd(dev->addr, SHTC3_CMD_SLEEP);
+    return sht_dev_count(&dev->stats, ret, 0);
 }
 
-int16_t shtc1_measure_blocking_read(int32_t* temperature, int32_t* humidity) {
+int16_t shtc1_dev_wake_up(shtc1_dev_t* dev) {
+    int16_t ret = sht_dev_select_bus(dev->bus);
+    if (ret == STATUS_OK)
+        ret = sensirion_i2c_write_cmd(dev->addr, SHTC3_CMD_WAKEUP);
+    return sht_dev_count(&dev->stats, ret, 0);
+}
+
+static int16_t shtc1_convert_ticks(int16_t ret, uint16_t temperature_ticks,
+                                   uint16_t humidity_ticks,
+                                   int32_t* temperature, int32_t* humidity) {
+    if (ret == STATUS_OK) {
+        shtc1_tick_to_temperature(temperature_ticks, temperature);
+        shtc1_tick_to_humidity(humidity_ticks, humidity);
+    }
+    return ret;
+}
+
+int16_t shtc1_dev_measure_blocking_read(shtc1_dev_t* dev, int32_t* temperature,
+                                        int32_t* humidity) {
+    uint16_t temperature_ticks, humidity_ticks;
+    int16_t ret = shtc1_dev_measure_blocking_read_raw(dev, &temperature_ticks,
+                                                      &humidity_ticks);
+    return shtc1_convert_ticks(ret, temperature_ticks, humidity_ticks,
+                               temperature, humidity);
+}
+
+int16_t shtc1_dev_measure_blocking_read_raw(shtc1_dev_t* dev,
+                                            uint16_t* temperature_ticks,
+                                            uint16_t* humidity_ticks) {
     int16_t ret;
 
-    ret = shtc1_measure();
+    ret = shtc1_dev_measure(dev);
     if (ret)
         return ret;
 #if !defined(USE_SENSIRION_CLOCK_STRETCHING) || !USE_SENSIRION_CLOCK_STRETCHING
-    sensirion_sleep_usec(SHTC1_MEASUREMENT_DURATION_USEC);
+    if (!dev->poll.interval_usec)
+        sensirion_sleep_usec(dev->measure_delay_usec);
 #endif /* USE_SENSIRION_CLOCK_STRETCHING */
-    return shtc1_read(temperature, humidity);
+    return shtc1_dev_read_raw(dev, temperature_ticks, humidity_ticks);
 }
 
-int16_t shtc1_measure(void) {
-    return sensirion_i2c_write_cmd(SHTC1_ADDRESS, shtc1_cmd_measure);
+int16_t shtc1_dev_measure(shtc1_dev_t* dev) {
+    int16_t ret = sht_dev_select_bus(dev->bus);
+    if (ret == STATUS_OK)
+        ret = sensirion_i2c_write_cmd(dev->addr, dev->cmd_measure);
+    return sht_dev_count(&dev->stats, ret, 0);
 }
 
-int16_t shtc1_read(int32_t* temperature, int32_t* humidity) {
+int16_t shtc1_dev_start_measurement(shtc1_dev_t* dev, uint32_t now_usec) {
+    int16_t ret = shtc1_dev_measure(dev);
+    if (ret)
+        return ret;
+
+    dev->pending = 1;
+    dev->start_usec = now_usec;
+    return STATUS_OK;
+}
+
+int16_t shtc1_dev_poll_measurement(shtc1_dev_t* dev, uint32_t now_usec,
+                                   int32_t* temperature, int32_t* humidity) {
     uint16_t words[2];
-    int16_t ret = sensirion_i2c_read_words(SHTC1_ADDRESS, words,
-                                           SENSIRION_NUM_WORDS(words));
-    /**
-     * formulas for conversion of the sensor signals, optimized for fixed point
-     * algebra:
-     * Temperature = 175 * S_T / 2^16 - 45
-     * Relative Humidity = 100 * S_RH / 2^16
-     */
-    *temperature = ((21875 * (int32_t)words[0]) >> 13) - 45000;
-    *humidity = ((12500 * (int32_t)words[1]) >> 13);
+    uint8_t early;
+    int16_t ret;
 
-    return ret;
+    if (!dev->pending)
+        return STATUS_ERR_NOT_STARTED;
+
+    early = !SHT_TIME_REACHED(now_usec,
+                              dev->start_usec + dev->measure_delay_usec);
+    if (early && !dev->poll.interval_usec)
+        return STATUS_NOT_READY;
+
+    ret = sht_dev_select_bus(dev->bus);
+    if (ret == STATUS_OK)
+        ret = sensirion_i2c_read_words(dev->addr, words,
+                                       SENSIRION_NUM_WORDS(words));
+    if (ret != STATUS_OK && early)
+        return STATUS_NOT_READY; /* NACKed, still measuring */
+
+    dev->pending = 0;
+    if (ret == STATUS_OK) {
+        shtc1_tick_to_temperature(words[0], temperature);
+        shtc1_tick_to_humidity(words[1], humidity);
+        if (dev->alert)
+            sht_alert_update(dev->alert, words[0], words[1]);
+        if (dev->poll.interval_usec)
+            dev->poll.last_wait_usec = now_usec - dev->start_usec;
+    }
+    return sht_dev_count(&dev->stats, ret, 1);
 }
 
-int16_t shtc1_probe(void) {
+int16_t shtc1_dev_read(shtc1_dev_t* dev, int32_t* temperature,
+                       int32_t* humidity) {
+    uint16_t temperature_ticks, humidity_ticks;
+    int16_t ret = shtc1_dev_read_raw(dev, &temperature_ticks, &humidity_ticks);
+    return shtc1_convert_ticks(ret, temperature_ticks, humidity_ticks,
+                               temperature, humidity);
+}
+
+int16_t shtc1_dev_read_raw(shtc1_dev_t* dev, uint16_t* temperature_ticks,
+                           uint16_t* humidity_ticks) {
+    uint16_t words[2];
+    int16_t ret = sht_dev_select_bus(dev->bus);
+
+    if (ret)
+        return sht_dev_count(&dev->stats, ret, 0);
+    if (dev->poll.interval_usec)
+        ret = sht_poll_read_words(dev->addr, words, SENSIRION_NUM_WORDS(words),
+                                  &dev->poll);
+    else
+        ret = sensirion_i2c_read_words(dev->addr, words,
+                                       SENSIRION_NUM_WORDS(words));
+    if (ret == STATUS_OK) {
+        *temperature_ticks = words[0];
+        *humidity_ticks = words[1];
+        if (dev->alert)
+            sht_alert_update(dev->alert, words[0], words[1]);
+    }
+    return sht_dev_count(&dev->stats, ret, 1);
+}
+
+int16_t shtc1_dev_probe(shtc1_dev_t* dev) {
     uint32_t serial;
 
-    (void)shtc1_wake_up(); /* Try to wake up the sensor, ignore return value */
-    return shtc1_read_serial(&serial);
+    (void)shtc1_dev_wake_up(dev); /* Try to wake up the sensor, ignore return */
+    return shtc1_dev_read_serial(dev, &serial);
 }
 
-void shtc1_enable_low_power_mode(uint8_t enable_low_power_mode) {
-    shtc1_cmd_measure =
-        enable_low_power_mode ? SHTC1_CMD_MEASURE_LPM : SHTC1_CMD_MEASURE_HPM;
+void shtc1_dev_enable_low_power_mode(shtc1_dev_t* dev,
+                                     uint8_t enable_low_power_mode) {
+    if (enable_low_power_mode) {
+        dev->cmd_measure = SHTC1_CMD_MEASURE_LPM;
+        dev->measure_delay_usec = SHTC1_MEASUREMENT_DURATION_LPM_USEC;
+    } else {
+        dev->cmd_measure = SHTC1_CMD_MEASURE_HPM;
+        dev->measure_delay_usec = SHTC1_MEASUREMENT_DURATION_USEC;
+    }
+    dev->low_power = enable_low_power_mode ? 1 : 0;
 }
 
-int16_t shtc1_read_serial(uint32_t* serial) {
+uint32_t shtc1_dev_get_measurement_duration_usec(const shtc1_dev_t* dev) {
+    return dev->measure_delay_usec;
+}
+
+void shtc1_dev_set_nack_polling(shtc1_dev_t* dev, uint16_t interval_usec,
+                                uint32_t timeout_usec) {
+    dev->poll.interval_usec = interval_usec;
+    dev->poll.timeout_usec = timeout_usec;
+    dev->poll.last_wait_usec = 0;
+}
+
+uint32_t shtc1_dev_get_polled_duration_usec(const shtc1_dev_t* dev) {
+    return dev->poll.last_wait_usec;
+}
+
+void shtc1_dev_set_alert(shtc1_dev_t* dev, sht_alert_t* alert) {
+    dev->alert = alert;
+}
+
+int16_t shtc1_dev_read_serial(shtc1_dev_t* dev, uint32_t* serial) {
     int16_t ret;
-    const uint16_t tx_words[] = {0x007B};
+    const uint16_t tx_words[] = {SHTC1_OTP_SERIAL_POINTER};
     uint16_t serial_words[SENSIRION_NUM_WORDS(*serial)];
 
-    ret = sensirion_i2c_write_cmd_with_args(SHTC1_ADDRESS, 0xC595, tx_words,
-                                            SENSIRION_NUM_WORDS(tx_words));
+    ret = sht_dev_select_bus(dev->bus);
+    if (ret == STATUS_OK)
+        ret = sensirion_i2c_write_cmd_with_args(
+            dev->addr, SHTC1_CMD_SET_OTP_POINTER, tx_words,
+            SENSIRION_NUM_WORDS(tx_words));
     if (ret)
-        return ret;
+        return sht_dev_count(&dev->stats, ret, 0);
 
     sensirion_sleep_usec(SHTC1_CMD_DURATION_USEC);
 
-    ret = sensirion_i2c_delayed_read_cmd(
-        SHTC1_ADDRESS, 0xC7F7, SHTC1_CMD_DURATION_USEC, &serial_words[0], 1);
+    ret = sensirion_i2c_delayed_read_cmd(dev->addr, SHTC1_CMD_READ_OTP,
+                                         SHTC1_CMD_DURATION_USEC,
+                                         &serial_words[0], 1);
     if (ret)
-        return ret;
+        return sht_dev_count(&dev->stats, ret, 0);
 
-    ret = sensirion_i2c_delayed_read_cmd(
-        SHTC1_ADDRESS, 0xC7F7, SHTC1_CMD_DURATION_USEC, &serial_words[1], 1);
+    ret = sensirion_i2c_delayed_read_cmd(dev->addr, SHTC1_CMD_READ_OTP,
+                                         SHTC1_CMD_DURATION_USEC,
+                                         &serial_words[1], 1);
     if (ret)
-        return ret;
+        return sht_dev_count(&dev->stats, ret, 0);
 
     *serial = ((uint32_t)serial_words[0] << 16) | serial_words[1];
     return ret;
 }
 
+int16_t shtc1_sleep(void) {
+    return shtc1_dev_sleep(&shtc1_default_dev);
+}
+
+int16_t shtc1_wake_up(void) {
+    return shtc1_dev_wake_up(&shtc1_default_dev);
+}
+
+int16_t shtc1_measure_blocking_read(int32_t* temperature, int32_t* humidity) {
+    return shtc1_dev_measure_blocking_read(&shtc1_default_dev, temperature,
+                                           humidity);
+}
+
+int16_t shtc1_measure(void) {
+    return shtc1_dev_measure(&shtc1_default_dev);
+}
+
+int16_t shtc1_read(int32_t* temperature, int32_t* humidity) {
+    return shtc1_dev_read(&shtc1_default_dev, temperature, humidity);
+}
+
+int16_t shtc1_measure_blocking_read_raw(uint16_t* temperature_ticks,
+                                        uint16_t* humidity_ticks) {
+    return shtc1_dev_measure_blocking_read_raw(&shtc1_default_dev,
+                                               temperature_ticks,
+                                               humidity_ticks);
+}
+
+int16_t shtc1_read_raw(uint16_t* temperature_ticks, uint16_t* humidity_ticks) {
+    return shtc1_dev_read_raw(&shtc1_default_dev, temperature_ticks,
+                              humidity_ticks);
+}
+
+int16_t shtc1_probe(void) {
+    return shtc1_dev_probe(&shtc1_default_dev);
+}
+
+void shtc1_enable_low_power_mode(uint8_t enable_low_power_mode) {
+    shtc1_dev_enable_low_power_mode(&shtc1_default_dev, enable_low_power_mode);
+}
+
+uint32_t shtc1_get_measurement_duration_usec(void) {
+    return shtc1_dev_get_measurement_duration_usec(&shtc1_default_dev);
+}
+
+int16_t shtc1_start_measurement(uint32_t now_usec) {
+    return shtc1_dev_start_measurement(&shtc1_default_dev, now_usec);
+}
+
+int16_t shtc1_poll_measurement(uint32_t now_usec, int32_t* temperature,
+                               int32_t* humidity) {
+    return shtc1_dev_poll_measurement(&shtc1_default_dev, now_usec, temperature,
+                                      humidity);
+}
+
+void shtc1_set_nack_polling(uint16_t interval_usec, uint32_t timeout_usec) {
+    shtc1_dev_set_nack_polling(&shtc1_default_dev, interval_usec,
+                               timeout_usec);
+}
+
+uint32_t shtc1_get_polled_duration_usec(void) {
+    return shtc1_dev_get_polled_duration_usec(&shtc1_default_dev);
+}
+
+void shtc1_set_alert(sht_alert_t* alert) {
+    shtc1_dev_set_alert(&shtc1_default_dev, alert);
+}
+
+int16_t shtc1_read_serial(uint32_t* serial) {
+    return shtc1_dev_read_serial(&shtc1_default_dev, serial);
+}
+
 const char* shtc1_get_driver_version(void) {
     return SHT_DRV_VERSION_STR;
 }
@@ -150,3 +356,25 @@ const char* shtc1_get_driver_version(void) {
 uint8_t shtc1_get_configured_address(void) {
     return SHTC1_ADDRESS;
 }
+
+/**
+ * formulas for conversion of the sensor signals, optimized for fixed point
+ * algebra:
+ * Temperature = 175 * S_T / 2^16 - 45
+ * Relative Humidity = 100 * S_RH / 2^16
+ */
+void shtc1_tick_to_temperature(uint16_t tick, int32_t* temperature) {
+    *temperature = ((21875 * (int32_t)tick) >> 13) - 45000;
+}
+
+void shtc1_tick_to_humidity(uint16_t tick, int32_t* humidity) {
+    *humidity = ((12500 * (int32_t)tick) >> 13);
+}
+
+void shtc1_temperature_to_tick(int32_t temperature, uint16_t* tick) {
+    *tick = sht_threshold_value_to_tick(21875, -45000, temperature);
+}
+
+void shtc1_humidity_to_tick(int32_t humidity, uint16_t* tick) {
+    *tick = sht_threshold_value_to_tick(12500, 0, humidity);
+}
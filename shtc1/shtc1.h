@@ -43,7 +43,10 @@
 
 #include "sensirion_arch_config.h"
 #include "sensirion_i2c.h"
+#include "sht_alert.h"
+#include "sht_dev.h"
 #include "sht_git_version.h"
+#include "sht_poll.h"
 
 #ifdef __cplusplus
 extern "C" {
@@ -53,7 +56,47 @@ extern "C" {
 #define STATUS_ERR_BAD_DATA (-1)
 #define STATUS_CRC_FAIL (-2)
 #define STATUS_UNKNOWN_DEVICE (-3)
+#define STATUS_NOT_READY 1
+#define STATUS_ERR_NOT_STARTED (-6)
 #define SHTC1_MEASUREMENT_DURATION_USEC 14400
+#define SHTC1_MEASUREMENT_DURATION_LPM_USEC 1000
+
+/* command words, all measurement commands return T (CRC) RH (CRC) */
+#define SHTC1_CMD_MEASURE_HPM_STRETCH 0x7CA2
+#define SHTC1_CMD_MEASURE_LPM_STRETCH 0x6458
+#define SHTC1_CMD_MEASURE_HPM_NO_STRETCH 0x7866
+#define SHTC1_CMD_MEASURE_LPM_NO_STRETCH 0x609C
+#define SHTC1_CMD_SET_OTP_POINTER 0xC595
+#define SHTC1_CMD_READ_OTP 0xC7F7
+#define SHTC1_OTP_SERIAL_POINTER 0x007B
+#define SHTC1_CMD_DURATION_USEC 1000
+#define SHTC3_CMD_SLEEP 0xB098
+#define SHTC3_CMD_WAKEUP 0x3517
+
+/**
+ * SHTC1 device context
+ *
+ * Holds the configuration and state of one sensor so that several sensors on
+ * different buses can be driven with independent settings. Initialize it with
+ * shtc1_dev_init() and treat the members as read-only. The functions without
+ * device context use an internal context on the default bus.
+ */
+typedef struct shtc1_dev {
+    uint8_t addr;
+    /* bus index passed to sensirion_i2c_select_bus() or SHT_BUS_DEFAULT */
+    uint8_t bus;
+    uint16_t cmd_measure;
+    uint32_t measure_delay_usec;
+    /* 1 in low power mode, see shtc1_dev_enable_low_power_mode */
+    uint8_t low_power;
+    sht_poll_t poll;
+    sht_dev_stats_t stats;
+    /* non-blocking measurement in progress, see shtc1_dev_start_measurement */
+    uint8_t pending;
+    uint32_t start_usec;
+    /* software alert evaluated on every read, NULL if none */
+    sht_alert_t* alert;
+} shtc1_dev_t;
 
 /**
  * Detects if a sensor is connected by reading out the ID register.
@@ -91,7 +134,8 @@ int16_t shtc1_measure(void);
 /**
  * Reads out the results of a measurement that was previously started by
  * shtc1_measure(). If the measurement is still in progress, this function
- * returns an error.
+ * returns an error, or waits for it with NACK polling enabled (see
+ * shtc1_set_nack_polling()).
  * Temperature is returned in [degree Celsius], multiplied by 1000,
  * and relative humidity in [percent relative humidity], multiplied by 1000.
  *
@@ -103,6 +147,69 @@ int16_t shtc1_measure(void);
  */
 int16_t shtc1_read(int32_t* temperature, int32_t* humidity);
 
+/**
+ * Same as shtc1_measure_blocking_read() but returns the CRC checked raw ticks
+ * of the sensor. Convert them with shtc1_tick_to_temperature() and
+ * shtc1_tick_to_humidity().
+ *
+ * @param temperature_ticks the address for the temperature ticks
+ * @param humidity_ticks    the address for the humidity ticks
+ * @return                  0 if the command was successful, else an error
+ *                          code.
+ */
+int16_t shtc1_measure_blocking_read_raw(uint16_t* temperature_ticks,
+                                        uint16_t* humidity_ticks);
+
+/**
+ * Same as shtc1_read() but returns the CRC checked raw ticks of the sensor.
+ * Convert them with shtc1_tick_to_temperature() and shtc1_tick_to_humidity().
+ *
+ * @param temperature_ticks the address for the temperature ticks
+ * @param humidity_ticks    the address for the humidity ticks
+ * @return                  0 if the command was successful, else an error
+ *                          code.
+ */
+int16_t shtc1_read_raw(uint16_t* temperature_ticks, uint16_t* humidity_ticks);
+
+/**
+ * Convert temperature ticks of the sensor
+ *
+ * @param tick          sensor ticks
+ * @param temperature   temperature in [degree Celsius], multiplied by 1000
+ */
+void shtc1_tick_to_temperature(uint16_t tick, int32_t* temperature);
+
+/**
+ * Convert humidity ticks of the sensor
+ *
+ * @param tick      sensor ticks
+ * @param humidity  relative humidity in [percent relative humidity],
+ *                  multiplied by 1000
+ */
+void shtc1_tick_to_humidity(uint16_t tick, int32_t* humidity);
+
+/**
+ * Convert a temperature to sensor ticks, the inverse of
+ * shtc1_tick_to_temperature(). Returns the smallest tick that converts to at
+ * least the given temperature, so tick >= shtc1_temperature_to_tick(t) holds
+ * exactly when the converted temperature is >= t. Saturates at 0 and 0xFFFF.
+ *
+ * @param temperature   temperature in [degree Celsius], multiplied by 1000
+ * @param tick          sensor ticks
+ */
+void shtc1_temperature_to_tick(int32_t temperature, uint16_t* tick);
+
+/**
+ * Convert a relative humidity to sensor ticks, the inverse of
+ * shtc1_tick_to_humidity(). Returns the smallest tick that converts to at least
+ * the given humidity, saturated at 0 and 0xFFFF.
+ *
+ * @param humidity  relative humidity in [percent relative humidity],
+ *                  multiplied by 1000
+ * @param tick      sensor ticks
+ */
+void shtc1_humidity_to_tick(int32_t humidity, uint16_t* tick);
+
 /**
  * Send the sensor to sleep, if supported.
  *
@@ -164,6 +271,63 @@ int16_t shtc1_wake_up(void);
  */
 void shtc1_enable_low_power_mode(uint8_t enable_low_power_mode);
 
+/**
+ * Starts a non-blocking measurement in the configured mode and records when
+ * its result is due. Use shtc1_poll_measurement() to collect the result.
+ * Neither function sleeps.
+ *
+ * @param now_usec  the current time, e.g. sht_time_now_usec()
+ * @return          0 if the command was successful, else an error code.
+ */
+int16_t shtc1_start_measurement(uint32_t now_usec);
+
+/**
+ * Collects the result of a measurement started with shtc1_start_measurement()
+ * once it is due. The sensor is only accessed once the measurement duration
+ * has passed, or on every call with NACK polling enabled.
+ *
+ * @param now_usec      the current time, on the same clock as for the start
+ * @param temperature   the address for the result of the temperature
+ * measurement
+ * @param humidity      the address for the result of the relative humidity
+ * measurement
+ * @return              0 when the result was read, STATUS_NOT_READY while the
+ *                      measurement is in progress, STATUS_ERR_NOT_STARTED
+ *                      without a started measurement, else an error code.
+ */
+int16_t shtc1_poll_measurement(uint32_t now_usec, int32_t* temperature,
+                               int32_t* humidity);
+
+/**
+ * Enable NACK polling. Instead of waiting the maximum measurement duration,
+ * shtc1_measure_blocking_read() reads right away and shtc1_read() retries the
+ * read every interval_usec until the sensor acknowledges it, i.e. the
+ * measurement is done, or timeout_usec passed.
+ *
+ * @param interval_usec time between read attempts, 0 disables polling
+ * @param timeout_usec  maximum time to wait for the measurement, e.g.
+ *                      shtc1_get_measurement_duration_usec()
+ */
+void shtc1_set_nack_polling(uint16_t interval_usec, uint32_t timeout_usec);
+
+/**
+ * Return the time the last polled shtc1_read() waited for the measurement to
+ * complete, with the resolution of the polling interval.
+ *
+ * @return  the measured conversion time in microseconds
+ */
+uint32_t shtc1_get_polled_duration_usec(void);
+
+/**
+ * Attach a software alert that is evaluated on every measurement read, see
+ * sht_alert.h. Its callback runs in the read and its state follows the
+ * HIALRT/LOALRT limits like the alert pin of an SHT3x. Initialize it with
+ * sht_alert_init(alert, SHT_THRESHOLD_SHTC1).
+ *
+ * @param alert the alert, NULL to detach it
+ */
+void shtc1_set_alert(sht_alert_t* alert);
+
 /**
  * Read out the serial number
  *
@@ -172,6 +336,14 @@ void shtc1_enable_low_power_mode(uint8_t enable_low_power_mode);
  */
 int16_t shtc1_read_serial(uint32_t* serial);
 
+/**
+ * Return the maximum measurement duration of the configured measurement mode,
+ * i.e. the time to wait between shtc1_measure() and shtc1_read()
+ *
+ * @return  the measurement duration in microseconds
+ */
+uint32_t shtc1_get_measurement_duration_usec(void);
+
 /**
  * Return the driver version
  *
@@ -186,6 +358,46 @@ const char* shtc1_get_driver_version(void);
  */
 uint8_t shtc1_get_configured_address(void);
 
+/**
+ * Initialize a device context at the configured address in normal mode
+ * without NACK polling
+ *
+ * @param dev   the device context
+ * @param bus   the bus index, SHT_BUS_DEFAULT to use the current bus
+ */
+void shtc1_dev_init(shtc1_dev_t* dev, uint8_t bus);
+
+/**
+ * The following functions behave like their counterparts without device
+ * context but act on a device context: they select the context's bus, use its
+ * settings and state, and count successful measurements and errors in
+ * dev->stats.
+ */
+int16_t shtc1_dev_probe(shtc1_dev_t* dev);
+int16_t shtc1_dev_measure_blocking_read(shtc1_dev_t* dev, int32_t* temperature,
+                                        int32_t* humidity);
+int16_t shtc1_dev_measure(shtc1_dev_t* dev);
+int16_t shtc1_dev_read(shtc1_dev_t* dev, int32_t* temperature,
+                       int32_t* humidity);
+int16_t shtc1_dev_measure_blocking_read_raw(shtc1_dev_t* dev,
+                                            uint16_t* temperature_ticks,
+                                            uint16_t* humidity_ticks);
+int16_t shtc1_dev_read_raw(shtc1_dev_t* dev, uint16_t* temperature_ticks,
+                           uint16_t* humidity_ticks);
+int16_t shtc1_dev_start_measurement(shtc1_dev_t* dev, uint32_t now_usec);
+int16_t shtc1_dev_poll_measurement(shtc1_dev_t* dev, uint32_t now_usec,
+                                   int32_t* temperature, int32_t* humidity);
+int16_t shtc1_dev_sleep(shtc1_dev_t* dev);
+int16_t shtc1_dev_wake_up(shtc1_dev_t* dev);
+void shtc1_dev_enable_low_power_mode(shtc1_dev_t* dev,
+                                     uint8_t enable_low_power_mode);
+uint32_t shtc1_dev_get_measurement_duration_usec(const shtc1_dev_t* dev);
+void shtc1_dev_set_nack_polling(shtc1_dev_t* dev, uint16_t interval_usec,
+                                uint32_t timeout_usec);
+uint32_t shtc1_dev_get_polled_duration_usec(const shtc1_dev_t* dev);
+void shtc1_dev_set_alert(shtc1_dev_t* dev, sht_alert_t* alert);
+int16_t shtc1_dev_read_serial(shtc1_dev_t* dev, uint32_t* serial);
+
 #ifdef __cplusplus
 }
 #endif
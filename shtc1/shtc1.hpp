@@ -0,0 +1,191 @@
+/*
+ * Copyright (c) 2026, Sensirion AG
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * * Redistributions of source code must retain the above copyright notice, this
+ *   list of conditions and the following disclaimer.
+ *
+ * * Redistributions in binary form must reproduce the above copyright notice,
+ *   this list of conditions and the following disclaimer in the documentation
+ *   and/or other materials provided with the distribution.
+ *
+ * * Neither the name of Sensirion AG nor the names of its
+ *   contributors may be used to endorse or promote products derived from
+ *   this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * \file
+ *
+ * \brief Header-only C++11 interface to the SHTC1 family
+ *
+ * Shtc1<LowPower, ClockStretch> fixes the power mode and the clock
+ * stretching setting at compile time. The command word, the conversion
+ * duration and the conversion formulas are constants, the functions call the
+ * sensirion_i2c.h primitives directly and need neither a device context nor
+ * shtc1.c. Works with SHTC1, SHTC3 and SHTW2.
+ *
+ * NACK polling and bus selection are only available through the C interface
+ * in shtc1.h.
+ */
+
+#ifndef SHTC1_HPP
+#define SHTC1_HPP
+
+#include "sensirion_arch_config.h"
+#include "sensirion_common.h"
+#include "sensirion_i2c.h"
+#include "sht_threshold.h"
+#include "shtc1.h"
+
+namespace sht {
+
+/**
+ * SHTC1 in normal or low power mode (SHTC3 only). With ClockStretch the
+ * sensor holds the bus during the conversion and the blocking reads do not
+ * sleep. The functions return the STATUS_* codes of shtc1.h.
+ *
+ *     typedef sht::Shtc1<true> Sensor;
+ *     ret = Sensor::measure_blocking_read(&temperature, &humidity);
+ */
+template <bool LowPower = false, bool ClockStretch = false, uint8_t Addr = 0x70>
+class Shtc1 {
+  public:
+    static constexpr uint8_t address = Addr;
+
+    static constexpr uint16_t cmd_measure =
+        ClockStretch ? (LowPower ? SHTC1_CMD_MEASURE_LPM_STRETCH
+                                 : SHTC1_CMD_MEASURE_HPM_STRETCH)
+                     : (LowPower ? SHTC1_CMD_MEASURE_LPM_NO_STRETCH
+                                 : SHTC1_CMD_MEASURE_HPM_NO_STRETCH);
+
+    static constexpr uint32_t measurement_duration_usec =
+        LowPower ? SHTC1_MEASUREMENT_DURATION_LPM_USEC
+                 : SHTC1_MEASUREMENT_DURATION_USEC;
+
+    /**
+     * Same formulas as shtc1_tick_to_temperature(), shtc1_tick_to_humidity(),
+     * shtc1_temperature_to_tick() and shtc1_humidity_to_tick(), usable in
+     * constant expressions.
+     */
+    static constexpr int32_t tick_to_temperature(uint16_t tick) {
+        return ((21875 * (int32_t)tick) >> 13) - 45000;
+    }
+
+    static constexpr int32_t tick_to_humidity(uint16_t tick) {
+        return ((12500 * (int32_t)tick) >> 13);
+    }
+
+    static constexpr uint16_t temperature_to_tick(int32_t temperature) {
+        return threshold_value_to_tick(21875, -45000, temperature);
+    }
+
+    static constexpr uint16_t humidity_to_tick(int32_t humidity) {
+        return threshold_value_to_tick(12500, 0, humidity);
+    }
+
+    static int16_t measure() {
+        return sensirion_i2c_write_cmd(Addr, cmd_measure);
+    }
+
+    static int16_t read_raw(uint16_t* temperature_ticks,
+                            uint16_t* humidity_ticks) {
+        uint16_t words[2];
+        int16_t ret =
+            sensirion_i2c_read_words(Addr, words, SENSIRION_NUM_WORDS(words));
+        if (ret == STATUS_OK) {
+            *temperature_ticks = words[0];
+            *humidity_ticks = words[1];
+        }
+        return ret;
+    }
+
+    static int16_t read(int32_t* temperature, int32_t* humidity) {
+        uint16_t ticks[2];
+        return convert(read_raw(&ticks[0], &ticks[1]), ticks, temperature,
+                       humidity);
+    }
+
+    static int16_t measure_blocking_read_raw(uint16_t* temperature_ticks,
+                                             uint16_t* humidity_ticks) {
+        int16_t ret = measure();
+        if (ret)
+            return ret;
+        if (!ClockStretch)
+            sensirion_sleep_usec(measurement_duration_usec);
+        return read_raw(temperature_ticks, humidity_ticks);
+    }
+
+    static int16_t measure_blocking_read(int32_t* temperature,
+                                         int32_t* humidity) {
+        uint16_t ticks[2];
+        return convert(measure_blocking_read_raw(&ticks[0], &ticks[1]), ticks,
+                       temperature, humidity);
+    }
+
+    static int16_t sleep() {
+        return sensirion_i2c_write_cmd(Addr, SHTC3_CMD_SLEEP);
+    }
+
+    static int16_t wake_up() {
+        return sensirion_i2c_write_cmd(Addr, SHTC3_CMD_WAKEUP);
+    }
+
+    static int16_t read_serial(uint32_t* serial) {
+        const uint16_t otp_address[] = {SHTC1_OTP_SERIAL_POINTER};
+        uint16_t words[2];
+        int16_t ret = sensirion_i2c_write_cmd_with_args(
+            Addr, SHTC1_CMD_SET_OTP_POINTER, otp_address,
+            SENSIRION_NUM_WORDS(otp_address));
+        if (ret)
+            return ret;
+        sensirion_sleep_usec(SHTC1_CMD_DURATION_USEC);
+        ret = sensirion_i2c_delayed_read_cmd(Addr, SHTC1_CMD_READ_OTP,
+                                             SHTC1_CMD_DURATION_USEC,
+                                             &words[0], 1);
+        if (ret)
+            return ret;
+        ret = sensirion_i2c_delayed_read_cmd(Addr, SHTC1_CMD_READ_OTP,
+                                             SHTC1_CMD_DURATION_USEC,
+                                             &words[1], 1);
+        if (ret == STATUS_OK)
+            *serial = ((uint32_t)words[0] << 16) | words[1];
+        return ret;
+    }
+
+  private:
+    static int16_t convert(int16_t ret, const uint16_t* ticks,
+                           int32_t* temperature, int32_t* humidity) {
+        if (ret == STATUS_OK) {
+            *temperature = tick_to_temperature(ticks[0]);
+            *humidity = tick_to_humidity(ticks[1]);
+        }
+        return ret;
+    }
+};
+
+/* out of class definitions for C++11, redundant but allowed since C++17 */
+template <bool L, bool S, uint8_t A> constexpr uint8_t Shtc1<L, S, A>::address;
+template <bool L, bool S, uint8_t A>
+constexpr uint16_t Shtc1<L, S, A>::cmd_measure;
+template <bool L, bool S, uint8_t A>
+constexpr uint32_t Shtc1<L, S, A>::measurement_duration_usec;
+
+}  // namespace sht
+
+#endif /* SHTC1_HPP */
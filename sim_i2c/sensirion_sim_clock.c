@@ -0,0 +1,118 @@
+/*
+ * Copyright (c) 2026, Sensirion AG
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * * Redistributions of source code must retain the above copyright notice, this
+ *   list of conditions and the following disclaimer.
+ *
+ * * Redistributions in binary form must reproduce the above copyright notice,
+ *   this list of conditions and the following disclaimer in the documentation
+ *   and/or other materials provided with the distribution.
+ *
+ * * Neither the name of Sensirion AG nor the names of its
+ *   contributors may be used to endorse or promote products derived from
+ *   this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * \file
+ *
+ * \brief Sensirion simulated I2C bus clock
+ *
+ * In virtual time (the default) the simulation clock only advances when the
+ * code under test sleeps, when a read is clock stretched and by the duration
+ * of every transfer on the bus. Sampling schedules over days of simulated time
+ * run in seconds and all timing numbers are reproducible. In real time the
+ * clock follows CLOCK_MONOTONIC and sleeps block.
+ *
+ * Every bus has its own virtual clock, which is advanced by the thread that
+ * selected the bus, so that transfers on different buses overlap in time.
+ */
+
+#define _POSIX_C_SOURCE 200809L
+
+#include <time.h>
+
+#include "sensirion_i2c.h"
+#include "sensirion_sim_device.h"
+#include "sensirion_sim_i2c.h"
+#include "sht_time.h"
+
+/* start, address byte with ACK and stop condition */
+#define SENSIRION_SIM_TRANSFER_OVERHEAD_BITS 11
+#define SENSIRION_SIM_BITS_PER_BYTE 9
+#define SENSIRION_SIM_DEFAULT_BUS_FREQUENCY 100000
+
+static uint8_t sim_virtual_time = 1;
+/* each bus has its own clock, the buses run in parallel */
+static uint64_t sim_virtual_now[SENSIRION_SIM_MAX_BUSES];
+static uint32_t sim_bus_frequency = SENSIRION_SIM_DEFAULT_BUS_FREQUENCY;
+
+static uint64_t sim_real_now(void) {
+    struct timespec ts;
+
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint64_t)ts.tv_sec * 1000000U + (uint64_t)ts.tv_nsec / 1000U;
+}
+
+void sensirion_sim_use_virtual_time(uint8_t enable) {
+    sim_virtual_time = enable;
+}
+
+void sensirion_sim_set_bus_frequency(uint32_t frequency_hz) {
+    sim_bus_frequency = frequency_hz;
+}
+
+uint64_t sensirion_sim_now_usec(void) {
+    return sim_virtual_time ? sim_virtual_now[sensirion_sim_current_bus()]
+                            : sim_real_now();
+}
+
+void sensirion_sim_advance_usec(uint64_t useconds) {
+    struct timespec ts;
+
+    if (sim_virtual_time) {
+        sim_virtual_now[sensirion_sim_current_bus()] += useconds;
+    } else {
+        ts.tv_sec = (time_t)(useconds / 1000000U);
+        ts.tv_nsec = (long)(useconds % 1000000U) * 1000L;
+        while (nanosleep(&ts, &ts) != 0) {
+        }
+    }
+    sensirion_sim_update_devices();
+}
+
+void sensirion_sim_clock_transfer(uint16_t count) {
+    uint64_t bits;
+
+    if (sim_virtual_time && sim_bus_frequency != 0) {
+        bits = SENSIRION_SIM_TRANSFER_OVERHEAD_BITS +
+               (uint64_t)count * SENSIRION_SIM_BITS_PER_BYTE;
+        sim_virtual_now[sensirion_sim_current_bus()] +=
+            (bits * 1000000U + sim_bus_frequency - 1) / sim_bus_frequency;
+    }
+    sensirion_sim_update_devices();
+}
+
+void sensirion_sleep_usec(uint32_t useconds) {
+    sensirion_sim_advance_usec(useconds);
+}
+
+uint32_t sht_time_now_usec(void) {
+    return (uint32_t)sensirion_sim_now_usec();
+}
@@ -0,0 +1,177 @@
+/*
+ * Copyright (c) 2026, Sensirion AG
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * * Redistributions of source code must retain the above copyright notice, this
+ *   list of conditions and the following disclaimer.
+ *
+ * * Redistributions in binary form must reproduce the above copyright notice,
+ *   this list of conditions and the following disclaimer in the documentation
+ *   and/or other materials provided with the distribution.
+ *
+ * * Neither the name of Sensirion AG nor the names of its
+ *   contributors may be used to endorse or promote products derived from
+ *   this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * \file
+ *
+ * \brief Sensirion simulated I2C bus, device model interface
+ *
+ * Internal interface between the simulated bus and the device models. Not
+ * meant to be included by applications.
+ */
+
+#ifndef SENSIRION_SIM_DEVICE_H
+#define SENSIRION_SIM_DEVICE_H
+
+#include "sensirion_sim_i2c.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#define SENSIRION_SIM_MAX_RESPONSE 18
+
+/**
+ * Behavior of a device type. The bus only dispatches transfers that are
+ * addressed to the device and visible through the mux configuration.
+ */
+typedef struct sensirion_sim_model {
+    int8_t (*write)(sensirion_sim_device_t* device, const uint8_t* data,
+                    uint16_t count);
+    int8_t (*read)(sensirion_sim_device_t* device, uint8_t* data,
+                   uint16_t count);
+    /* power-on reset, also triggered by a general call reset */
+    void (*reset)(sensirion_sim_device_t* device);
+    /* catch up with the simulation clock, e.g. evaluate samples taken since
+     * the last call; optional */
+    void (*update)(sensirion_sim_device_t* device);
+} sensirion_sim_model_t;
+
+struct sensirion_sim_device {
+    const sensirion_sim_model_t* model;
+    uint8_t bus;
+    uint8_t address;
+    uint8_t mux_address;
+    uint8_t mux_channel;
+    uint8_t variant;
+
+    /* environment and identity */
+    int32_t temperature;
+    int32_t humidity;
+    uint32_t serial;
+
+    /* model state */
+    uint16_t status;
+    uint16_t alert_limits[4];
+    uint16_t pointer;
+    uint8_t control;
+    uint8_t sleeping;
+    uint8_t stretch;
+    uint64_t busy_until;
+    /* periodic acquisition, period_usec is 0 in single shot mode */
+    uint32_t period_usec;
+    uint32_t conversion_usec;
+    uint64_t period_start;
+    uint64_t samples_fetched;
+    /* alert tracking of the periodic samples */
+    uint64_t samples_tracked;
+    uint8_t alert_state;
+    sensirion_sim_alert_callback_t alert_callback;
+    void* alert_user_data;
+    uint8_t response[SENSIRION_SIM_MAX_RESPONSE];
+    uint8_t response_len;
+};
+
+extern const sensirion_sim_model_t sensirion_sim_sht3x_model;
+extern const sensirion_sim_model_t sensirion_sim_sht4x_model;
+extern const sensirion_sim_model_t sensirion_sim_shtc1_model;
+
+/**
+ * Let the device models of the current bus catch up with the simulation
+ * clock, called whenever the clock advances
+ */
+void sensirion_sim_update_devices(void);
+
+/**
+ * Return the bus selected by the calling thread
+ */
+uint8_t sensirion_sim_current_bus(void);
+
+/**
+ * Advance the virtual clock by the duration of a transfer of count bytes
+ */
+void sensirion_sim_clock_transfer(uint16_t count);
+
+/**
+ * Return 1 while a conversion or reset is in progress
+ */
+uint8_t sensirion_sim_is_busy(const sensirion_sim_device_t* device);
+
+/**
+ * Start a conversion or any other busy period. A response that was queued
+ * with sensirion_sim_queue_word() before or after this call only becomes
+ * readable once the busy period is over.
+ */
+void sensirion_sim_start_busy(sensirion_sim_device_t* device,
+                              uint32_t duration_usec, uint8_t stretch);
+
+/**
+ * Discard the queued response
+ */
+void sensirion_sim_clear_response(sensirion_sim_device_t* device);
+
+/**
+ * Append a data word followed by its CRC to the response
+ */
+void sensirion_sim_queue_word(sensirion_sim_device_t* device, uint16_t word);
+
+/**
+ * Common read behavior: NACK (or stretch) while busy, NACK without data,
+ * otherwise return the response, pad with 0xFF and discard it.
+ */
+int8_t sensirion_sim_read_response(sensirion_sim_device_t* device,
+                                   uint8_t* data, uint16_t count);
+
+/**
+ * Check the CRC of a data word that was written to the device
+ *
+ * @return 0 if the CRC matches
+ */
+int8_t sensirion_sim_check_word(const uint8_t* data);
+
+/**
+ * Convert temperature in milli degree Celsius to ticks using
+ * T = offset + 175 * S_T / 2^16
+ */
+uint16_t sensirion_sim_temperature_to_tick(int32_t temperature);
+
+/**
+ * Convert relative humidity in milli percent to ticks using
+ * RH = offset + scale * S_RH / 2^16, with offset and scale in milli percent
+ */
+uint16_t sensirion_sim_humidity_to_tick(int32_t humidity, int32_t offset,
+                                        int32_t scale);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* SENSIRION_SIM_DEVICE_H */
@@ -0,0 +1,404 @@
+/*
+ * Copyright (c) 2026, Sensirion AG
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * * Redistributions of source code must retain the above copyright notice, this
+ *   list of conditions and the following disclaimer.
+ *
+ * * Redistributions in binary form must reproduce the above copyright notice,
+ *   this list of conditions and the following disclaimer in the documentation
+ *   and/or other materials provided with the distribution.
+ *
+ * * Neither the name of Sensirion AG nor the names of its
+ *   contributors may be used to endorse or promote products derived from
+ *   this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * \file
+ *
+ * \brief Sensirion simulated I2C bus implementation
+ *
+ * Implements sensirion_i2c.h against the device models. Devices are either
+ * connected to the root bus or to a channel of a mux on the root bus.
+ *
+ * The bus selection is kept per thread, so that every bus can be driven by
+ * its own thread. A thread only sees the devices of its bus; devices must not
+ * be added while other threads access the simulation.
+ */
+
+#include <string.h>
+
+#include "sensirion_arch_config.h"
+#include "sensirion_common.h"
+#include "sensirion_i2c.h"
+#include "sensirion_sim_device.h"
+#include "sensirion_sim_i2c.h"
+
+#define SENSIRION_SIM_GENERAL_CALL_ADDRESS 0x00
+#define SENSIRION_SIM_GENERAL_CALL_RESET 0x06
+#define SENSIRION_SIM_DEFAULT_TEMPERATURE 25000
+#define SENSIRION_SIM_DEFAULT_HUMIDITY 50000
+#define SENSIRION_SIM_SERIAL_BASE 0x5E000000U
+/* longest write transfer sensirion_sim_corrupt_write() can corrupt */
+#define SENSIRION_SIM_MAX_WRITE_LEN 16
+
+static int8_t mux_write(sensirion_sim_device_t* device, const uint8_t* data,
+                        uint16_t count);
+static int8_t mux_read(sensirion_sim_device_t* device, uint8_t* data,
+                       uint16_t count);
+
+static const sensirion_sim_model_t sensirion_sim_mux_model = {
+    mux_write, mux_read, NULL, NULL};
+
+static sensirion_sim_device_t sim_devices[SENSIRION_SIM_MAX_DEVICES];
+static uint16_t sim_num_devices;
+static uint32_t sim_next_serial = SENSIRION_SIM_SERIAL_BASE;
+static sensirion_sim_stats_t sim_stats[SENSIRION_SIM_MAX_BUSES];
+/* write transfers until the one to corrupt, 0 if none */
+static uint32_t sim_corrupt_countdown[SENSIRION_SIM_MAX_BUSES];
+static __thread uint8_t sim_bus;
+
+static int8_t mux_write(sensirion_sim_device_t* device, const uint8_t* data,
+                        uint16_t count) {
+    if (count > 0)
+        device->control = data[count - 1];
+    return NO_ERROR;
+}
+
+static int8_t mux_read(sensirion_sim_device_t* device, uint8_t* data,
+                       uint16_t count) {
+    uint16_t i;
+
+    for (i = 0; i < count; ++i)
+        data[i] = device->control;
+    return NO_ERROR;
+}
+
+static uint8_t sim_is_visible(const sensirion_sim_device_t* device) {
+    uint16_t i;
+
+    if (device->mux_address == SENSIRION_SIM_ROOT)
+        return 1;
+
+    for (i = 0; i < sim_num_devices; ++i) {
+        const sensirion_sim_device_t* mux = &sim_devices[i];
+        if (mux->model == &sensirion_sim_mux_model && mux->bus == device->bus &&
+            mux->address == device->mux_address)
+            return (mux->control & (1U << device->mux_channel)) != 0;
+    }
+    return 0;
+}
+
+/**
+ * Find the single visible device with the given address. Returns NULL if no
+ * device or more than one device (bus collision) answers.
+ */
+static sensirion_sim_device_t* sim_find(uint8_t address) {
+    sensirion_sim_device_t* found = NULL;
+    uint16_t i;
+
+    for (i = 0; i < sim_num_devices; ++i) {
+        sensirion_sim_device_t* device = &sim_devices[i];
+        if (device->bus != sim_bus || device->address != address ||
+            !sim_is_visible(device))
+            continue;
+        if (found)
+            return NULL;
+        found = device;
+    }
+    return found;
+}
+
+static sensirion_sim_device_t* sim_add(const sensirion_sim_model_t* model,
+                                       uint8_t mux_address,
+                                       uint8_t mux_channel, uint8_t address,
+                                       uint8_t variant) {
+    sensirion_sim_device_t* device;
+
+    if (sim_num_devices >= SENSIRION_SIM_MAX_DEVICES || mux_channel > 7)
+        return NULL;
+
+    device = &sim_devices[sim_num_devices++];
+    memset(device, 0, sizeof(*device));
+    device->model = model;
+    device->bus = sim_bus;
+    device->address = address;
+    device->mux_address = mux_address;
+    device->mux_channel = mux_channel;
+    device->variant = variant;
+    device->temperature = SENSIRION_SIM_DEFAULT_TEMPERATURE;
+    device->humidity = SENSIRION_SIM_DEFAULT_HUMIDITY;
+    device->serial = sim_next_serial++;
+    if (model->reset)
+        model->reset(device);
+    return device;
+}
+
+__attribute__((weak)) void sensirion_sim_board_init(void) {
+}
+
+/* let a device catch up with the clock of its bus, which need not be the
+ * bus of the calling thread */
+static void sim_update(sensirion_sim_device_t* device) {
+    uint8_t bus = sim_bus;
+
+    if (!device->model->update)
+        return;
+    sim_bus = device->bus;
+    device->model->update(device);
+    sim_bus = bus;
+}
+
+void sensirion_sim_reset(void) {
+    sim_num_devices = 0;
+    sim_next_serial = SENSIRION_SIM_SERIAL_BASE;
+    memset(sim_stats, 0, sizeof(sim_stats));
+    memset(sim_corrupt_countdown, 0, sizeof(sim_corrupt_countdown));
+}
+
+sensirion_sim_device_t* sensirion_sim_add_mux(uint8_t address) {
+    return sim_add(&sensirion_sim_mux_model, SENSIRION_SIM_ROOT, 0, address,
+                   0);
+}
+
+sensirion_sim_device_t* sensirion_sim_add_sht3x(uint8_t mux_address,
+                                                uint8_t mux_channel,
+                                                uint8_t address) {
+    return sim_add(&sensirion_sim_sht3x_model, mux_address, mux_channel,
+                   address, 0);
+}
+
+sensirion_sim_device_t* sensirion_sim_add_sht4x(uint8_t mux_address,
+                                                uint8_t mux_channel,
+                                                uint8_t address) {
+    return sim_add(&sensirion_sim_sht4x_model, mux_address, mux_channel,
+                   address, 0);
+}
+
+sensirion_sim_device_t*
+sensirion_sim_add_shtc1(uint8_t mux_address, uint8_t mux_channel,
+                        sensirion_sim_shtc1_variant_t variant) {
+    return sim_add(&sensirion_sim_shtc1_model, mux_address, mux_channel, 0x70,
+                   (uint8_t)variant);
+}
+
+void sensirion_sim_set_environment(sensirion_sim_device_t* device,
+                                   int32_t temperature, int32_t humidity) {
+    /* the samples until now were taken in the previous environment */
+    sim_update(device);
+    device->temperature = temperature;
+    device->humidity = humidity;
+}
+
+void sensirion_sim_set_serial(sensirion_sim_device_t* device, uint32_t serial) {
+    device->serial = serial;
+}
+
+void sensirion_sim_set_alert_callback(sensirion_sim_device_t* device,
+                                      sensirion_sim_alert_callback_t callback,
+                                      void* user_data) {
+    device->alert_callback = callback;
+    device->alert_user_data = user_data;
+}
+
+uint8_t sensirion_sim_get_alert_pin(sensirion_sim_device_t* device) {
+    sim_update(device);
+    return device->alert_state != 0;
+}
+
+void sensirion_sim_update_devices(void) {
+    uint16_t i;
+
+    for (i = 0; i < sim_num_devices; ++i) {
+        if (sim_devices[i].bus == sim_bus && sim_devices[i].model->update)
+            sim_devices[i].model->update(&sim_devices[i]);
+    }
+}
+
+uint8_t sensirion_sim_current_bus(void) {
+    return sim_bus;
+}
+
+void sensirion_sim_get_stats(sensirion_sim_stats_t* stats) {
+    *stats = sim_stats[sim_bus];
+}
+
+void sensirion_sim_clear_stats(void) {
+    memset(&sim_stats[sim_bus], 0, sizeof(sim_stats[sim_bus]));
+}
+
+void sensirion_sim_corrupt_write(uint32_t nth) {
+    sim_corrupt_countdown[sim_bus] = nth;
+}
+
+/* the data a device receives, corrupted if requested */
+static const uint8_t* sim_write_data(const uint8_t* data, uint16_t count,
+                                     uint8_t* buf, uint16_t buf_size) {
+    uint32_t* countdown = &sim_corrupt_countdown[sim_bus];
+
+    if (!*countdown || --*countdown || !count || count > buf_size)
+        return data;
+    memcpy(buf, data, count);
+    buf[count - 1] ^= 0x01;
+    return buf;
+}
+
+uint8_t sensirion_sim_is_busy(const sensirion_sim_device_t* device) {
+    return sensirion_sim_now_usec() < device->busy_until;
+}
+
+void sensirion_sim_start_busy(sensirion_sim_device_t* device,
+                              uint32_t duration_usec, uint8_t stretch) {
+    device->busy_until = sensirion_sim_now_usec() + duration_usec;
+    device->stretch = stretch;
+}
+
+void sensirion_sim_clear_response(sensirion_sim_device_t* device) {
+    device->response_len = 0;
+}
+
+void sensirion_sim_queue_word(sensirion_sim_device_t* device, uint16_t word) {
+    uint8_t* buf = &device->response[device->response_len];
+
+    if (device->response_len + 3 > SENSIRION_SIM_MAX_RESPONSE)
+        return;
+
+    buf[0] = (uint8_t)(word >> 8);
+    buf[1] = (uint8_t)(word & 0xFF);
+    buf[2] = sensirion_common_generate_crc(buf, 2);
+    device->response_len += 3;
+}
+
+int8_t sensirion_sim_read_response(sensirion_sim_device_t* device,
+                                   uint8_t* data, uint16_t count) {
+    uint64_t now = sensirion_sim_now_usec();
+    uint16_t i;
+
+    if (now < device->busy_until) {
+        if (!device->stretch)
+            return SENSIRION_SIM_NACK;
+        /* clock stretching: hold the bus until the conversion is done */
+        sensirion_sim_advance_usec(device->busy_until - now);
+    }
+
+    if (device->response_len == 0)
+        return SENSIRION_SIM_NACK;
+
+    for (i = 0; i < count; ++i)
+        data[i] = i < device->response_len ? device->response[i] : 0xFF;
+    device->response_len = 0;
+    return NO_ERROR;
+}
+
+int8_t sensirion_sim_check_word(const uint8_t* data) {
+    return sensirion_common_check_crc(data, 2, data[2]);
+}
+
+uint16_t sensirion_sim_temperature_to_tick(int32_t temperature) {
+    int64_t tick = ((int64_t)(temperature + 45000) * 65536 + 87500) / 175000;
+
+    if (tick < 0)
+        return 0;
+    if (tick > 0xFFFF)
+        return 0xFFFF;
+    return (uint16_t)tick;
+}
+
+uint16_t sensirion_sim_humidity_to_tick(int32_t humidity, int32_t offset,
+                                        int32_t scale) {
+    int64_t tick =
+        ((int64_t)(humidity - offset) * 65536 + scale / 2) / (int64_t)scale;
+
+    if (tick < 0)
+        return 0;
+    if (tick > 0xFFFF)
+        return 0xFFFF;
+    return (uint16_t)tick;
+}
+
+int16_t sensirion_i2c_select_bus(uint8_t bus_idx) {
+    if (bus_idx >= SENSIRION_SIM_MAX_BUSES)
+        return SENSIRION_SIM_NACK;
+    sim_bus = bus_idx;
+    return NO_ERROR;
+}
+
+void sensirion_i2c_init(void) {
+    uint8_t bus = sim_bus;
+
+    sensirion_sim_reset();
+    sim_bus = 0;
+    sensirion_sim_board_init();
+    sim_bus = bus;
+}
+
+void sensirion_i2c_release(void) {
+}
+
+int8_t sensirion_i2c_read(uint8_t address, uint8_t* data, uint16_t count) {
+    sensirion_sim_device_t* device = sim_find(address);
+    int8_t ret = SENSIRION_SIM_NACK;
+
+    sim_stats[sim_bus].reads++;
+    if (device && device->model->read)
+        ret = device->model->read(device, data, count);
+    /* a NACKed read ends after the address byte */
+    sensirion_sim_clock_transfer(ret == NO_ERROR ? count : 0);
+    if (ret != NO_ERROR)
+        sim_stats[sim_bus].nacks++;
+    else
+        sim_stats[sim_bus].bytes += count;
+    return ret;
+}
+
+int8_t sensirion_i2c_write(uint8_t address, const uint8_t* data,
+                           uint16_t count) {
+    sensirion_sim_device_t* device;
+    uint8_t buf[SENSIRION_SIM_MAX_WRITE_LEN];
+    int8_t ret = SENSIRION_SIM_NACK;
+    uint16_t i;
+
+    sim_stats[sim_bus].writes++;
+    if (address == SENSIRION_SIM_GENERAL_CALL_ADDRESS) {
+        sensirion_sim_clock_transfer(count);
+        if (count == 1 && data[0] == SENSIRION_SIM_GENERAL_CALL_RESET) {
+            for (i = 0; i < sim_num_devices; ++i) {
+                device = &sim_devices[i];
+                if (device->bus == sim_bus && device->model->reset &&
+                    sim_is_visible(device)) {
+                    device->model->reset(device);
+                    ret = NO_ERROR;
+                }
+            }
+        }
+    } else {
+        device = sim_find(address);
+        /* without a device the transfer ends at the NACKed address byte */
+        sensirion_sim_clock_transfer(device ? count : 0);
+        if (device && device->model->write)
+            ret = device->model->write(
+                device, sim_write_data(data, count, buf, sizeof(buf)), count);
+    }
+
+    if (ret != NO_ERROR)
+        sim_stats[sim_bus].nacks++;
+    else
+        sim_stats[sim_bus].bytes += count;
+    return ret;
+}
@@ -0,0 +1,285 @@
+/*
+ * Copyright (c) 2026, Sensirion AG
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * * Redistributions of source code must retain the above copyright notice, this
+ *   list of conditions and the following disclaimer.
+ *
+ * * Redistributions in binary form must reproduce the above copyright notice,
+ *   this list of conditions and the following disclaimer in the documentation
+ *   and/or other materials provided with the distribution.
+ *
+ * * Neither the name of Sensirion AG nor the names of its
+ *   contributors may be used to endorse or promote products derived from
+ *   this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * \file
+ *
+ * \brief Sensirion simulated I2C bus
+ *
+ * This module implements the sensirion_i2c.h interface against in-process
+ * behavioral models of SHT3x, SHT4x and SHTC1 (and compatible) sensors as well
+ * as 8-channel I2C multiplexers. Select it with CONFIG_I2C_TYPE = sim_i2c to
+ * run the drivers on a host without any hardware attached.
+ *
+ * The sensor models decode the commands used by the drivers, answer with CRC
+ * protected data words, NACK while a conversion is in progress, emulate clock
+ * stretching and take the typical conversion time of the selected mode.
+ *
+ * The simulation runs in virtual time by default: sensirion_sleep_usec()
+ * returns immediately after advancing the simulation clock, which is shared
+ * with the drivers through sht_time_now_usec().
+ *
+ * Up to SENSIRION_SIM_MAX_BUSES independent buses are simulated.
+ * sensirion_i2c_select_bus() selects the bus of the calling thread (bus 0 by
+ * default): devices are added to it, transfers, traffic counters and the
+ * virtual clock refer to it. Each bus can thus be driven by its own thread.
+ */
+
+#ifndef SENSIRION_SIM_I2C_H
+#define SENSIRION_SIM_I2C_H
+
+#include "sensirion_arch_config.h"
+#include "sensirion_i2c.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * Mux address to use for devices that are connected directly to the bus
+ */
+#define SENSIRION_SIM_ROOT 0x00
+
+/**
+ * Return value of sensirion_i2c_read() and sensirion_i2c_write() if no device
+ * acknowledged the transfer
+ */
+#define SENSIRION_SIM_NACK (-1)
+
+#ifndef SENSIRION_SIM_MAX_DEVICES
+#define SENSIRION_SIM_MAX_DEVICES 64
+#endif /* SENSIRION_SIM_MAX_DEVICES */
+
+#ifndef SENSIRION_SIM_MAX_BUSES
+#define SENSIRION_SIM_MAX_BUSES 8
+#endif /* SENSIRION_SIM_MAX_BUSES */
+
+typedef struct sensirion_sim_device sensirion_sim_device_t;
+
+/**
+ * @brief Variants of the SHTC1 family. Only the SHTC3 supports sleep mode.
+ */
+typedef enum _sensirion_sim_shtc1_variant {
+    SENSIRION_SIM_SHTC1,
+    SENSIRION_SIM_SHTW2,
+    SENSIRION_SIM_SHTC3
+} sensirion_sim_shtc1_variant_t;
+
+/**
+ * Called when the level of a sensor's ALERT pin changes
+ *
+ * @param device    the sensor
+ * @param level     the new pin level, 1 while an alert is active
+ * @param user_data the pointer passed to sensirion_sim_set_alert_callback()
+ */
+typedef void (*sensirion_sim_alert_callback_t)(sensirion_sim_device_t* device,
+                                               uint8_t level, void* user_data);
+
+/**
+ * @brief Bus traffic counters
+ */
+typedef struct _sensirion_sim_stats {
+    uint32_t writes; /* write transfers */
+    uint32_t reads;  /* read transfers */
+    uint32_t nacks;  /* transfers that were not acknowledged */
+    uint32_t bytes;  /* payload bytes transferred */
+} sensirion_sim_stats_t;
+
+/**
+ * Board setup hook, called by sensirion_i2c_init() after all devices were
+ * removed. Override it to describe the simulated bus topology; the default
+ * implementation leaves the bus empty. It starts on bus 0, select another bus
+ * with sensirion_i2c_select_bus() to add devices to it. The bus selection of
+ * the caller of sensirion_i2c_init() is restored afterwards.
+ */
+void sensirion_sim_board_init(void);
+
+/**
+ * Remove all devices from all buses and clear the traffic counters
+ */
+void sensirion_sim_reset(void);
+
+/**
+ * Add an 8-channel I2C multiplexer (e.g. TCA9548A) to the root of the
+ * current bus. All channels are disabled after the mux was added.
+ *
+ * @param address   the 7-bit mux address
+ *
+ * @return          the device or NULL if the device table is full
+ */
+sensirion_sim_device_t* sensirion_sim_add_mux(uint8_t address);
+
+/**
+ * Add a SHT3x sensor
+ *
+ * @param mux_address   the address of the mux the sensor is connected to or
+ *                      SENSIRION_SIM_ROOT
+ * @param mux_channel   the mux channel (0-7), ignored on the root bus
+ * @param address       the 7-bit sensor address (0x44 or 0x45)
+ *
+ * @return              the device or NULL if the device table is full
+ */
+sensirion_sim_device_t* sensirion_sim_add_sht3x(uint8_t mux_address,
+                                                uint8_t mux_channel,
+                                                uint8_t address);
+
+/**
+ * Add a SHT4x sensor
+ *
+ * @param mux_address   the address of the mux the sensor is connected to or
+ *                      SENSIRION_SIM_ROOT
+ * @param mux_channel   the mux channel (0-7), ignored on the root bus
+ * @param address       the 7-bit sensor address (0x44 for the SHT40-AD1B)
+ *
+ * @return              the device or NULL if the device table is full
+ */
+sensirion_sim_device_t* sensirion_sim_add_sht4x(uint8_t mux_address,
+                                                uint8_t mux_channel,
+                                                uint8_t address);
+
+/**
+ * Add a SHTC1 family sensor at address 0x70
+ *
+ * @param mux_address   the address of the mux the sensor is connected to or
+ *                      SENSIRION_SIM_ROOT
+ * @param mux_channel   the mux channel (0-7), ignored on the root bus
+ * @param variant       the sensor variant
+ *
+ * @return              the device or NULL if the device table is full
+ */
+sensirion_sim_device_t*
+sensirion_sim_add_shtc1(uint8_t mux_address, uint8_t mux_channel,
+                        sensirion_sim_shtc1_variant_t variant);
+
+/**
+ * Set the ambient conditions a sensor measures. Defaults to 25 degree Celsius
+ * and 50 percent relative humidity.
+ *
+ * @param device        the sensor
+ * @param temperature   temperature in degree Celsius, multiplied by 1000
+ * @param humidity      relative humidity in percent, multiplied by 1000
+ */
+void sensirion_sim_set_environment(sensirion_sim_device_t* device,
+                                   int32_t temperature, int32_t humidity);
+
+/**
+ * Set the serial number a sensor reports. Every sensor gets a unique serial
+ * number when it is added.
+ *
+ * @param device    the sensor
+ * @param serial    the serial number
+ */
+void sensirion_sim_set_serial(sensirion_sim_device_t* device, uint32_t serial);
+
+/**
+ * Connect the ALERT pin of a sensor, only the SHT3x has one. The SHT3x model
+ * evaluates its alert limits on every sample of the periodic acquisition: the
+ * pin is high while a tracking alert is active, the callback is called on
+ * every change. It runs when the simulation clock passes the sample, i.e.
+ * within a sleep or a transfer.
+ *
+ * @param device    the sensor
+ * @param callback  the function to call, NULL to disconnect the pin
+ * @param user_data passed to the callback
+ */
+void sensirion_sim_set_alert_callback(sensirion_sim_device_t* device,
+                                      sensirion_sim_alert_callback_t callback,
+                                      void* user_data);
+
+/**
+ * Return the level of the ALERT pin of a sensor
+ *
+ * @param device    the sensor
+ * @return          1 while an alert is active, else 0
+ */
+uint8_t sensirion_sim_get_alert_pin(sensirion_sim_device_t* device);
+
+/**
+ * Read out the traffic counters of the current bus
+ *
+ * @param stats     the address for the result
+ */
+void sensirion_sim_get_stats(sensirion_sim_stats_t* stats);
+
+/**
+ * Reset the traffic counters of the current bus
+ */
+void sensirion_sim_clear_stats(void);
+
+/**
+ * Flip the lowest bit of the last byte of a write transfer to a device on the
+ * current bus, e.g. to corrupt the CRC of a command argument. The device
+ * receives the corrupted data, the caller's buffer is not changed.
+ *
+ * @param nth   the write transfer to corrupt, 1 for the next one, 0 to cancel
+ */
+void sensirion_sim_corrupt_write(uint32_t nth);
+
+/**
+ * Select virtual (default) or real time. In virtual time sleeping and clock
+ * stretching advance the simulation clock instantly and each transfer
+ * advances it by its duration on the bus. In real time the simulation clock
+ * follows CLOCK_MONOTONIC and sleeping blocks.
+ *
+ * @param enable    1 for virtual time, 0 for real time
+ */
+void sensirion_sim_use_virtual_time(uint8_t enable);
+
+/**
+ * Set the bus clock used to account for transfer durations in virtual time.
+ * Defaults to 100 kHz, 0 makes transfers take no time.
+ *
+ * @param frequency_hz  the SCL frequency in Hz
+ */
+void sensirion_sim_set_bus_frequency(uint32_t frequency_hz);
+
+/**
+ * Return the simulation time of the current bus. Unlike sht_time_now_usec()
+ * this does not wrap around.
+ *
+ * @return monotonic time in microseconds
+ */
+uint64_t sensirion_sim_now_usec(void);
+
+/**
+ * Advance the simulation clock of the current bus, e.g. to skip over idle
+ * periods of a schedule.
+ * Same as sensirion_sleep_usec() without the 32 bit limit.
+ *
+ * @param useconds  the time to advance in microseconds
+ */
+void sensirion_sim_advance_usec(uint64_t useconds);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* SENSIRION_SIM_I2C_H */
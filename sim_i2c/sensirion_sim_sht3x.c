@@ -0,0 +1,360 @@
+/*
+ * Copyright (c) 2026, Sensirion AG
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * * Redistributions of source code must retain the above copyright notice, this
+ *   list of conditions and the following disclaimer.
+ *
+ * * Redistributions in binary form must reproduce the above copyright notice,
+ *   this list of conditions and the following disclaimer in the documentation
+ *   and/or other materials provided with the distribution.
+ *
+ * * Neither the name of Sensirion AG nor the names of its
+ *   contributors may be used to endorse or promote products derived from
+ *   this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * \file
+ *
+ * \brief Sensirion simulated SHT3x
+ *
+ * Behavioral model of the SHT3x: single shot measurements with and without
+ * clock stretching, periodic acquisition, ART mode, status register, serial
+ * number, alert limits and the ALERT pin.
+ */
+
+#include "sensirion_common.h"
+#include "sensirion_sim_device.h"
+
+/* typical conversion times */
+#define SHT3X_SIM_DURATION_HPM_USEC 12500
+#define SHT3X_SIM_DURATION_MPM_USEC 4500
+#define SHT3X_SIM_DURATION_LPM_USEC 2500
+
+#define SHT3X_SIM_STATUS_DEFAULT 0x8010U
+#define SHT3X_SIM_STATUS_CLEAR_MSK 0x8C10U
+#define SHT3X_SIM_STATUS_ALERT_PENDING 0x8000U
+#define SHT3X_SIM_STATUS_RH_ALERT 0x0800U
+#define SHT3X_SIM_STATUS_T_ALERT 0x0400U
+#define SHT3X_SIM_STATUS_CMD_FAIL 0x0002U
+#define SHT3X_SIM_STATUS_CRC_FAIL 0x0001U
+
+/* alert limit indices, same order as sht3x_alert_thd_t */
+#define SHT3X_SIM_HIALRT_SET 0
+#define SHT3X_SIM_HIALRT_CLR 1
+#define SHT3X_SIM_LOALRT_CLR 2
+#define SHT3X_SIM_LOALRT_SET 3
+
+/* alert_state flags, the tracking state of each limit */
+#define SHT3X_SIM_ALERT_T_HIGH 0x01U
+#define SHT3X_SIM_ALERT_T_LOW 0x02U
+#define SHT3X_SIM_ALERT_RH_HIGH 0x04U
+#define SHT3X_SIM_ALERT_RH_LOW 0x08U
+
+static const uint16_t SHT3X_SIM_DEFAULT_LIMITS[] = {0xCD33, 0xC92D, 0x3869,
+                                                    0x3466};
+
+/* periodic acquisition commands by rate and repeatability (low..high) */
+static const uint16_t SHT3X_SIM_CMD_PERIODIC[][3] = {
+    {0x202F, 0x2024, 0x2032}, {0x212D, 0x2126, 0x2130},
+    {0x222B, 0x2220, 0x2236}, {0x2329, 0x2322, 0x2334},
+    {0x272A, 0x2721, 0x2737},
+};
+static const uint32_t SHT3X_SIM_PERIOD_USEC[] = {2000000, 1000000, 500000,
+                                                 250000, 100000};
+static const uint32_t SHT3X_SIM_REPEATABILITY_USEC[] = {
+    SHT3X_SIM_DURATION_LPM_USEC, SHT3X_SIM_DURATION_MPM_USEC,
+    SHT3X_SIM_DURATION_HPM_USEC};
+
+static void sht3x_sim_queue_measurement(sensirion_sim_device_t* device) {
+    sensirion_sim_queue_word(
+        device, sensirion_sim_temperature_to_tick(device->temperature));
+    sensirion_sim_queue_word(
+        device, sensirion_sim_humidity_to_tick(device->humidity, 0, 100000));
+}
+
+static int8_t sht3x_sim_start_measurement(sensirion_sim_device_t* device,
+                                          uint32_t duration_usec,
+                                          uint8_t stretch) {
+    sensirion_sim_start_busy(device, duration_usec, stretch);
+    sht3x_sim_queue_measurement(device);
+    return NO_ERROR;
+}
+
+static uint8_t sht3x_sim_start_periodic(sensirion_sim_device_t* device,
+                                        uint16_t cmd) {
+    uint8_t rate;
+    uint8_t rep;
+
+    if (cmd == 0x2B32) { /* ART, 4Hz */
+        device->period_usec = 250000;
+        device->conversion_usec = SHT3X_SIM_DURATION_HPM_USEC;
+        device->period_start = sensirion_sim_now_usec();
+        device->samples_fetched = 0;
+        device->samples_tracked = 0;
+        return 1;
+    }
+
+    for (rate = 0; rate < 5; ++rate) {
+        for (rep = 0; rep < 3; ++rep) {
+            if (SHT3X_SIM_CMD_PERIODIC[rate][rep] != cmd)
+                continue;
+            device->period_usec = SHT3X_SIM_PERIOD_USEC[rate];
+            device->conversion_usec = SHT3X_SIM_REPEATABILITY_USEC[rep];
+            device->period_start = sensirion_sim_now_usec();
+            device->samples_fetched = 0;
+            device->samples_tracked = 0;
+            return 1;
+        }
+    }
+    return 0;
+}
+
+/* number of samples the periodic acquisition completed so far */
+static uint64_t sht3x_sim_samples(const sensirion_sim_device_t* device) {
+    uint64_t elapsed = sensirion_sim_now_usec() - device->period_start;
+
+    if (elapsed < device->conversion_usec)
+        return 0;
+    return (elapsed - device->conversion_usec) / device->period_usec + 1;
+}
+
+/* queue the latest sample if it has not been fetched yet */
+static void sht3x_sim_fetch(sensirion_sim_device_t* device) {
+    uint64_t samples = sht3x_sim_samples(device);
+
+    if (samples <= device->samples_fetched)
+        return; /* no new data, the read header is not acknowledged */
+    device->samples_fetched = samples;
+    sht3x_sim_queue_measurement(device);
+}
+
+/* hysteresis of one channel, value and limits are the compared MSBs */
+static uint8_t sht3x_sim_track(uint8_t state, uint16_t value, uint16_t high_set,
+                               uint16_t high_clr, uint16_t low_clr,
+                               uint16_t low_set, uint8_t high, uint8_t low) {
+    if (value > high_set)
+        state |= high;
+    else if (value < high_clr)
+        state &= (uint8_t)~high;
+    if (value < low_set)
+        state |= low;
+    else if (value > low_clr)
+        state &= (uint8_t)~low;
+    return state;
+}
+
+static void sht3x_sim_set_alert_state(sensirion_sim_device_t* device,
+                                      uint8_t state) {
+    uint8_t pin = state != 0;
+    uint8_t previous_pin = device->alert_state != 0;
+
+    device->status &=
+        (uint16_t)~(SHT3X_SIM_STATUS_RH_ALERT | SHT3X_SIM_STATUS_T_ALERT);
+    if (state & (SHT3X_SIM_ALERT_T_HIGH | SHT3X_SIM_ALERT_T_LOW))
+        device->status |= SHT3X_SIM_STATUS_T_ALERT;
+    if (state & (SHT3X_SIM_ALERT_RH_HIGH | SHT3X_SIM_ALERT_RH_LOW))
+        device->status |= SHT3X_SIM_STATUS_RH_ALERT;
+    if (state != device->alert_state)
+        device->status |= SHT3X_SIM_STATUS_ALERT_PENDING;
+
+    device->alert_state = state;
+    if (pin != previous_pin && device->alert_callback)
+        device->alert_callback(device, pin, device->alert_user_data);
+}
+
+/* the sensor compares the 9 MSBs of the temperature and the 7 MSBs of the
+ * humidity with the limits after each sample of the periodic acquisition */
+static void sht3x_sim_update(sensirion_sim_device_t* device) {
+    const uint16_t* lim = device->alert_limits;
+    uint64_t samples;
+    uint16_t t, rh;
+    uint8_t state;
+
+    if (!device->period_usec)
+        return;
+    samples = sht3x_sim_samples(device);
+    if (samples <= device->samples_tracked)
+        return;
+    device->samples_tracked = samples;
+
+    t = (uint16_t)(sensirion_sim_temperature_to_tick(device->temperature) >>
+                   7);
+    rh = (uint16_t)(sensirion_sim_humidity_to_tick(device->humidity, 0,
+                                                   100000) >>
+                    9);
+    state = sht3x_sim_track(
+        device->alert_state, t, lim[SHT3X_SIM_HIALRT_SET] & 0x1FFU,
+        lim[SHT3X_SIM_HIALRT_CLR] & 0x1FFU, lim[SHT3X_SIM_LOALRT_CLR] & 0x1FFU,
+        lim[SHT3X_SIM_LOALRT_SET] & 0x1FFU, SHT3X_SIM_ALERT_T_HIGH,
+        SHT3X_SIM_ALERT_T_LOW);
+    state = sht3x_sim_track(
+        state, rh, lim[SHT3X_SIM_HIALRT_SET] >> 9,
+        lim[SHT3X_SIM_HIALRT_CLR] >> 9, lim[SHT3X_SIM_LOALRT_CLR] >> 9,
+        lim[SHT3X_SIM_LOALRT_SET] >> 9, SHT3X_SIM_ALERT_RH_HIGH,
+        SHT3X_SIM_ALERT_RH_LOW);
+    sht3x_sim_set_alert_state(device, state);
+}
+
+static int8_t sht3x_sim_write_limit(sensirion_sim_device_t* device,
+                                    uint8_t idx, const uint8_t* data,
+                                    uint16_t count) {
+    if (count != 5 || sensirion_sim_check_word(&data[2]) != NO_ERROR) {
+        device->status |= SHT3X_SIM_STATUS_CMD_FAIL | SHT3X_SIM_STATUS_CRC_FAIL;
+        return NO_ERROR;
+    }
+    device->alert_limits[idx] = (uint16_t)(data[2] << 8 | data[3]);
+    return NO_ERROR;
+}
+
+static int8_t sht3x_sim_write(sensirion_sim_device_t* device,
+                              const uint8_t* data, uint16_t count) {
+    uint16_t cmd;
+    uint16_t status = device->status;
+
+    if (sensirion_sim_is_busy(device))
+        return SENSIRION_SIM_NACK;
+
+    if (count < 2)
+        return NO_ERROR; /* incomplete command, ignored */
+
+    cmd = (uint16_t)(data[0] << 8 | data[1]);
+    sensirion_sim_clear_response(device);
+    device->status &= (uint16_t)~(SHT3X_SIM_STATUS_CMD_FAIL |
+                                  SHT3X_SIM_STATUS_CRC_FAIL);
+
+    if (device->period_usec) {
+        switch (cmd) {
+            case 0xE000: /* fetch data */
+                sht3x_sim_fetch(device);
+                return NO_ERROR;
+            case 0x3093: /* break */
+                device->period_usec = 0;
+                sensirion_sim_start_busy(device, 1000, 0);
+                return NO_ERROR;
+            case 0xF32D:
+            case 0x3041:
+            case 0x30A2:
+            case 0x306D:
+            case 0x3066:
+                break; /* handled below */
+            default:
+                /* measurement and serial commands need single shot mode */
+                if ((cmd & 0xF000) != 0xE000 && (cmd & 0xF000) != 0x6000) {
+                    device->status |= SHT3X_SIM_STATUS_CMD_FAIL;
+                    return SENSIRION_SIM_NACK;
+                }
+                break;
+        }
+    } else if (sht3x_sim_start_periodic(device, cmd)) {
+        return NO_ERROR;
+    }
+
+    switch (cmd) {
+        case 0x2C06:
+            return sht3x_sim_start_measurement(
+                device, SHT3X_SIM_DURATION_HPM_USEC, 1);
+        case 0x2C0D:
+            return sht3x_sim_start_measurement(
+                device, SHT3X_SIM_DURATION_MPM_USEC, 1);
+        case 0x2C10:
+            return sht3x_sim_start_measurement(
+                device, SHT3X_SIM_DURATION_LPM_USEC, 1);
+        case 0x2400:
+            return sht3x_sim_start_measurement(
+                device, SHT3X_SIM_DURATION_HPM_USEC, 0);
+        case 0x240B:
+            return sht3x_sim_start_measurement(
+                device, SHT3X_SIM_DURATION_MPM_USEC, 0);
+        case 0x2416:
+            return sht3x_sim_start_measurement(
+                device, SHT3X_SIM_DURATION_LPM_USEC, 0);
+        case 0xF32D: /* read status, reports the previous command */
+            sensirion_sim_queue_word(device, status);
+            return NO_ERROR;
+        case 0x3041: /* clear status */
+            device->status &= (uint16_t)~SHT3X_SIM_STATUS_CLEAR_MSK;
+            return NO_ERROR;
+        case 0x3780: /* read serial */
+        case 0x3682:
+            sensirion_sim_queue_word(device, (uint16_t)(device->serial >> 16));
+            sensirion_sim_queue_word(device, (uint16_t)device->serial);
+            return NO_ERROR;
+        case 0x30A2: /* soft reset */
+            device->model->reset(device);
+            return NO_ERROR;
+        case 0x306D: /* heater on */
+            device->status |= 0x2000U;
+            return NO_ERROR;
+        case 0x3066: /* heater off */
+            device->status &= (uint16_t)~0x2000U;
+            return NO_ERROR;
+        case 0xE11F:
+            sensirion_sim_queue_word(
+                device, device->alert_limits[SHT3X_SIM_HIALRT_SET]);
+            return NO_ERROR;
+        case 0xE114:
+            sensirion_sim_queue_word(
+                device, device->alert_limits[SHT3X_SIM_HIALRT_CLR]);
+            return NO_ERROR;
+        case 0xE109:
+            sensirion_sim_queue_word(
+                device, device->alert_limits[SHT3X_SIM_LOALRT_CLR]);
+            return NO_ERROR;
+        case 0xE102:
+            sensirion_sim_queue_word(
+                device, device->alert_limits[SHT3X_SIM_LOALRT_SET]);
+            return NO_ERROR;
+        case 0x611D:
+            return sht3x_sim_write_limit(device, SHT3X_SIM_HIALRT_SET, data,
+                                         count);
+        case 0x6116:
+            return sht3x_sim_write_limit(device, SHT3X_SIM_HIALRT_CLR, data,
+                                         count);
+        case 0x610B:
+            return sht3x_sim_write_limit(device, SHT3X_SIM_LOALRT_CLR, data,
+                                         count);
+        case 0x6100:
+            return sht3x_sim_write_limit(device, SHT3X_SIM_LOALRT_SET, data,
+                                         count);
+        default:
+            device->status |= SHT3X_SIM_STATUS_CMD_FAIL;
+            return SENSIRION_SIM_NACK;
+    }
+}
+
+static int8_t sht3x_sim_read(sensirion_sim_device_t* device, uint8_t* data,
+                             uint16_t count) {
+    return sensirion_sim_read_response(device, data, count);
+}
+
+static void sht3x_sim_reset(sensirion_sim_device_t* device) {
+    uint8_t i;
+
+    sensirion_sim_clear_response(device);
+    device->busy_until = 0;
+    device->period_usec = 0;
+    for (i = 0; i < 4; ++i)
+        device->alert_limits[i] = SHT3X_SIM_DEFAULT_LIMITS[i];
+    sht3x_sim_set_alert_state(device, 0);
+    device->status = SHT3X_SIM_STATUS_DEFAULT;
+}
+
+const sensirion_sim_model_t sensirion_sim_sht3x_model = {
+    sht3x_sim_write, sht3x_sim_read, sht3x_sim_reset, sht3x_sim_update};
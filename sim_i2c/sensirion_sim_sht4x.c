@@ -0,0 +1,112 @@
+/*
+ * Copyright (c) 2026, Sensirion AG
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * * Redistributions of source code must retain the above copyright notice, this
+ *   list of conditions and the following disclaimer.
+ *
+ * * Redistributions in binary form must reproduce the above copyright notice,
+ *   this list of conditions and the following disclaimer in the documentation
+ *   and/or other materials provided with the distribution.
+ *
+ * * Neither the name of Sensirion AG nor the names of its
+ *   contributors may be used to endorse or promote products derived from
+ *   this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * \file
+ *
+ * \brief Sensirion simulated SHT4x
+ *
+ * Behavioral model of the SHT4x: measurements in all three precision modes,
+ * heater measurements, serial number and soft reset. The SHT4x does not
+ * support clock stretching.
+ */
+
+#include "sensirion_common.h"
+#include "sensirion_sim_device.h"
+
+/* typical conversion times */
+#define SHT4X_SIM_DURATION_HPM_USEC 6900
+#define SHT4X_SIM_DURATION_MPM_USEC 3700
+#define SHT4X_SIM_DURATION_LPM_USEC 1300
+#define SHT4X_SIM_DURATION_HEATER_LONG_USEC 1100000
+#define SHT4X_SIM_DURATION_HEATER_SHORT_USEC 110000
+
+static int8_t sht4x_sim_start_measurement(sensirion_sim_device_t* device,
+                                          uint32_t duration_usec) {
+    sensirion_sim_start_busy(device, duration_usec, 0);
+    sensirion_sim_queue_word(
+        device, sensirion_sim_temperature_to_tick(device->temperature));
+    sensirion_sim_queue_word(device, sensirion_sim_humidity_to_tick(
+                                         device->humidity, -6000, 125000));
+    return NO_ERROR;
+}
+
+static int8_t sht4x_sim_write(sensirion_sim_device_t* device,
+                              const uint8_t* data, uint16_t count) {
+    if (sensirion_sim_is_busy(device) || count != 1)
+        return SENSIRION_SIM_NACK;
+
+    sensirion_sim_clear_response(device);
+
+    switch (data[0]) {
+        case 0xFD:
+            return sht4x_sim_start_measurement(device,
+                                               SHT4X_SIM_DURATION_HPM_USEC);
+        case 0xF6:
+            return sht4x_sim_start_measurement(device,
+                                               SHT4X_SIM_DURATION_MPM_USEC);
+        case 0xE0:
+            return sht4x_sim_start_measurement(device,
+                                               SHT4X_SIM_DURATION_LPM_USEC);
+        case 0x39:
+        case 0x2F:
+        case 0x1E:
+            return sht4x_sim_start_measurement(
+                device, SHT4X_SIM_DURATION_HEATER_LONG_USEC);
+        case 0x32:
+        case 0x24:
+        case 0x15:
+            return sht4x_sim_start_measurement(
+                device, SHT4X_SIM_DURATION_HEATER_SHORT_USEC);
+        case 0x89: /* read serial */
+            sensirion_sim_queue_word(device, (uint16_t)(device->serial >> 16));
+            sensirion_sim_queue_word(device, (uint16_t)device->serial);
+            return NO_ERROR;
+        case 0x94: /* soft reset */
+            device->model->reset(device);
+            return NO_ERROR;
+        default:
+            return SENSIRION_SIM_NACK;
+    }
+}
+
+static int8_t sht4x_sim_read(sensirion_sim_device_t* device, uint8_t* data,
+                             uint16_t count) {
+    return sensirion_sim_read_response(device, data, count);
+}
+
+static void sht4x_sim_reset(sensirion_sim_device_t* device) {
+    sensirion_sim_clear_response(device);
+    device->busy_until = 0;
+}
+
+const sensirion_sim_model_t sensirion_sim_sht4x_model = {
+    sht4x_sim_write, sht4x_sim_read, sht4x_sim_reset, NULL};
@@ -0,0 +1,152 @@
+/*
+ * Copyright (c) 2026, Sensirion AG
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * * Redistributions of source code must retain the above copyright notice, this
+ *   list of conditions and the following disclaimer.
+ *
+ * * Redistributions in binary form must reproduce the above copyright notice,
+ *   this list of conditions and the following disclaimer in the documentation
+ *   and/or other materials provided with the distribution.
+ *
+ * * Neither the name of Sensirion AG nor the names of its
+ *   contributors may be used to endorse or promote products derived from
+ *   this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * \file
+ *
+ * \brief Sensirion simulated SHTC1 (and compatible)
+ *
+ * Behavioral model of the SHTC1 family: measurements in normal and low power
+ * mode with and without clock stretching, ID register, serial number and the
+ * SHTC3 sleep mode.
+ */
+
+#include "sensirion_common.h"
+#include "sensirion_sim_device.h"
+
+/* typical conversion times */
+#define SHTC1_SIM_DURATION_NORMAL_USEC 10800
+#define SHTC1_SIM_DURATION_LPM_USEC 700
+
+#define SHTC1_SIM_SERIAL_POINTER 0x007B
+
+static const uint16_t SHTC1_SIM_IDS[] = {0x0007, 0x0047, 0x0807};
+
+static int8_t shtc1_sim_start_measurement(sensirion_sim_device_t* device,
+                                          uint8_t low_power, uint8_t stretch,
+                                          uint8_t humidity_first) {
+    uint16_t t_tick = sensirion_sim_temperature_to_tick(device->temperature);
+    uint16_t rh_tick =
+        sensirion_sim_humidity_to_tick(device->humidity, 0, 100000);
+
+    sensirion_sim_start_busy(device,
+                             low_power ? SHTC1_SIM_DURATION_LPM_USEC
+                                       : SHTC1_SIM_DURATION_NORMAL_USEC,
+                             stretch);
+    sensirion_sim_queue_word(device, humidity_first ? rh_tick : t_tick);
+    sensirion_sim_queue_word(device, humidity_first ? t_tick : rh_tick);
+    return NO_ERROR;
+}
+
+static int8_t shtc1_sim_write(sensirion_sim_device_t* device,
+                              const uint8_t* data, uint16_t count) {
+    uint16_t cmd;
+    uint8_t is_shtc3 = device->variant == SENSIRION_SIM_SHTC3;
+
+    if (sensirion_sim_is_busy(device) || count < 2)
+        return SENSIRION_SIM_NACK;
+
+    cmd = (uint16_t)(data[0] << 8 | data[1]);
+    if (device->sleeping) {
+        if (cmd != 0x3517)
+            return SENSIRION_SIM_NACK;
+        device->sleeping = 0;
+        return NO_ERROR;
+    }
+
+    sensirion_sim_clear_response(device);
+
+    switch (cmd) {
+        case 0x7CA2:
+            return shtc1_sim_start_measurement(device, 0, 1, 0);
+        case 0x5C24:
+            return shtc1_sim_start_measurement(device, 0, 1, 1);
+        case 0x7866:
+            return shtc1_sim_start_measurement(device, 0, 0, 0);
+        case 0x58E0:
+            return shtc1_sim_start_measurement(device, 0, 0, 1);
+        case 0x6458:
+            return shtc1_sim_start_measurement(device, 1, 1, 0);
+        case 0x44DE:
+            return shtc1_sim_start_measurement(device, 1, 1, 1);
+        case 0x609C:
+            return shtc1_sim_start_measurement(device, 1, 0, 0);
+        case 0x401A:
+            return shtc1_sim_start_measurement(device, 1, 0, 1);
+        case 0xEFC8: /* read ID register */
+            sensirion_sim_queue_word(device, SHTC1_SIM_IDS[device->variant]);
+            return NO_ERROR;
+        case 0xC595: /* set OTP pointer */
+            if (count != 5 || sensirion_sim_check_word(&data[2]) != NO_ERROR)
+                return SENSIRION_SIM_NACK;
+            device->pointer = (uint16_t)(data[2] << 8 | data[3]);
+            return NO_ERROR;
+        case 0xC7F7: /* read OTP word, auto-increments the pointer */
+            if (device->pointer == SHTC1_SIM_SERIAL_POINTER)
+                sensirion_sim_queue_word(device,
+                                         (uint16_t)(device->serial >> 16));
+            else if (device->pointer == SHTC1_SIM_SERIAL_POINTER + 1)
+                sensirion_sim_queue_word(device, (uint16_t)device->serial);
+            else
+                sensirion_sim_queue_word(device, 0);
+            device->pointer++;
+            return NO_ERROR;
+        case 0x805D: /* soft reset */
+            device->model->reset(device);
+            return NO_ERROR;
+        case 0xB098: /* sleep */
+            if (!is_shtc3)
+                return SENSIRION_SIM_NACK;
+            device->sleeping = 1;
+            return NO_ERROR;
+        case 0x3517: /* wake up, only acknowledged by the SHTC3 */
+            return is_shtc3 ? NO_ERROR : SENSIRION_SIM_NACK;
+        default:
+            return SENSIRION_SIM_NACK;
+    }
+}
+
+static int8_t shtc1_sim_read(sensirion_sim_device_t* device, uint8_t* data,
+                             uint16_t count) {
+    if (device->sleeping)
+        return SENSIRION_SIM_NACK;
+    return sensirion_sim_read_response(device, data, count);
+}
+
+static void shtc1_sim_reset(sensirion_sim_device_t* device) {
+    sensirion_sim_clear_response(device);
+    device->busy_until = 0;
+    device->sleeping = 0;
+    device->pointer = 0;
+}
+
+const sensirion_sim_model_t sensirion_sim_shtc1_model = {
+    shtc1_sim_write, shtc1_sim_read, shtc1_sim_reset, NULL};
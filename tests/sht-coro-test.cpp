@@ -0,0 +1,238 @@
+#include <stdio.h>
+
+#include "sensirion_common.h"
+#include "sensirion_test_setup.h"
+#include "sht_coro.hpp"
+#include "sht_fleet.h"
+#include "sht_time.h"
+
+/* Sensors of the mux testbed, grouped by multiplexer and channel */
+#define NUM_SENSORS 5
+#define MEASUREMENTS 10
+
+static sht_fleet_sensor_t sensors[NUM_SENSORS];
+static sht_mux_state_t mux;
+
+struct wakeup {
+    uint16_t id;
+    uint32_t usec;
+};
+
+static sht::coro::Task<uint32_t> sleep_and_report(sht::coro::Scheduler& sched,
+                                                  uint32_t usec) {
+    co_await sched.sleep(usec);
+    co_return sched.now();
+}
+
+static sht::coro::Task<void> sleeper(sht::coro::Scheduler& sched, uint16_t id,
+                                     uint32_t usec, wakeup* log,
+                                     uint16_t* count) {
+    uint32_t now = co_await sleep_and_report(sched, usec);
+    log[*count].id = id;
+    log[*count].usec = now;
+    ++*count;
+}
+
+static sht::coro::Task<void> measure_loop(sht::coro::FleetSensor sensor,
+                                          uint16_t* failures) {
+    for (uint16_t i = 0; i < MEASUREMENTS; ++i) {
+        sht::coro::Measurement m = co_await sensor.measure();
+        if (m.status != STATUS_OK || m.temperature < 5000 ||
+            m.temperature > 45000 || m.humidity < 0 || m.humidity > 100000)
+            ++*failures;
+    }
+}
+
+static sht::coro::Task<void> sht4x_loop(sht::coro::Sht4x sht4x,
+                                        uint16_t* failures) {
+    for (uint16_t i = 0; i < MEASUREMENTS; ++i) {
+        auto s = co_await sht4x.measure();
+        if (s.status != STATUS_OK)
+            ++*failures;
+    }
+}
+
+static sht::coro::Task<void> sht3x_loop(sht::coro::Scheduler& sched,
+                                        sht::coro::Sht3x sht3x,
+                                        uint32_t interval_usec,
+                                        uint16_t* failures) {
+    for (uint16_t i = 0; i < MEASUREMENTS; ++i) {
+        auto s = co_await sht3x.measure();
+        if (s.status != STATUS_OK || s.temperature < 5000 ||
+            s.temperature > 45000)
+            ++*failures;
+        co_await sched.sleep(interval_usec);
+    }
+}
+
+TEST_GROUP (SHT_Coro_Tests) {
+    void setup() {
+        sensirion_i2c_init();
+        sht_mux_init(&mux, SHT_BUS_DEFAULT);
+        sht_fleet_sensor_init(&sensors[0], SHT_FAMILY_SHTC1, 0x70,
+                              SHT_BUS_DEFAULT, 0x71, 0);
+        sht_fleet_sensor_init(&sensors[1], SHT_FAMILY_SHTC1, 0x70,
+                              SHT_BUS_DEFAULT, 0x71, 6);
+        sht_fleet_sensor_init(&sensors[2], SHT_FAMILY_SHT4X, 0x44,
+                              SHT_BUS_DEFAULT, 0x71, 7);
+        sht_fleet_sensor_init(&sensors[3], SHT_FAMILY_SHTC1, 0x70,
+                              SHT_BUS_DEFAULT, 0x72, 0);
+        sht_fleet_sensor_init(&sensors[4], SHT_FAMILY_SHT3X, 0x44,
+                              SHT_BUS_DEFAULT, 0x72, 1);
+    }
+
+    void teardown() {
+        sht_mux_release(&mux);
+        sensirion_i2c_release();
+    }
+};
+
+TEST (SHT_Coro_Tests, SHTCoroTestTimerWheel) {
+    /* the last one needs more than one revolution of the wheel */
+    const uint32_t sleeps[] = {5000, 1000, 0, 1500, 200000, 64000};
+    const uint16_t order[] = {2, 1, 3, 0, 5, 4};
+    const uint16_t num_sleeps = sizeof(sleeps) / sizeof(sleeps[0]);
+    sht::coro::Scheduler sched(true);
+    wakeup log[num_sleeps];
+    uint16_t count = 0;
+
+    for (uint16_t i = 0; i < num_sleeps; ++i)
+        sched.spawn(sleeper(sched, i, sleeps[i], log, &count));
+    sched.run();
+
+    CHECK_EQUAL_TEXT(num_sleeps, count, "all coroutines done");
+    CHECK_EQUAL_TEXT(0, sched.live(), "Scheduler::live");
+    for (uint16_t i = 0; i < num_sleeps; ++i) {
+        uint32_t requested = sleeps[log[i].id];
+        CHECK_EQUAL_TEXT(order[i], log[i].id, "wakeup order");
+        CHECK_TRUE_TEXT(log[i].usec >= requested &&
+                            log[i].usec < requested +
+                                              sht::coro::Scheduler::TickUsec,
+                        "wakeup time");
+    }
+    CHECK_EQUAL_TEXT(200000, sched.now(), "virtual time");
+}
+
+TEST (SHT_Coro_Tests, SHTCoroTestTimerWheelWrap) {
+    /* sht_time_now_usec() wraps during the sleeps */
+    const uint32_t start = UINT32_MAX - 2500;
+    const uint32_t sleeps[] = {5000000, 1000, 3000, 0};
+    const uint16_t order[] = {3, 1, 2, 0};
+    const uint16_t num_sleeps = sizeof(sleeps) / sizeof(sleeps[0]);
+    sht::coro::Scheduler sched(true, start);
+    wakeup log[num_sleeps];
+    uint16_t count = 0;
+
+    for (uint16_t i = 0; i < num_sleeps; ++i)
+        sched.spawn(sleeper(sched, i, sleeps[i], log, &count));
+    sched.run();
+
+    CHECK_EQUAL_TEXT(num_sleeps, count, "all coroutines done");
+    for (uint16_t i = 0; i < num_sleeps; ++i) {
+        uint32_t requested = sleeps[log[i].id];
+        uint32_t slept = log[i].usec - start;
+        CHECK_EQUAL_TEXT(order[i], log[i].id, "wakeup order");
+        CHECK_TRUE_TEXT(slept >= requested &&
+                            slept < requested + sht::coro::Scheduler::TickUsec,
+                        "wakeup time");
+    }
+    CHECK_EQUAL_TEXT(5000000, sched.elapsed(), "elapsed time");
+}
+
+TEST (SHT_Coro_Tests, SHTCoroTestFleet) {
+    const uint8_t muxes[] = {0x71, 0x72};
+    sht::coro::Scheduler sched;
+    uint32_t sequential_usec = 0;
+    uint16_t failures = 0;
+
+    for (uint16_t i = 0; i < NUM_SENSORS; ++i) {
+        sequential_usec +=
+            MEASUREMENTS * sht_fleet_sensor_wait_usec(&sensors[i]);
+        sched.spawn(measure_loop(
+            sht::coro::FleetSensor(sched, &sensors[i], &mux, muxes, 2),
+            &failures));
+    }
+
+    uint32_t start = sht_time_now_usec();
+    sched.run();
+    uint32_t duration = sht_time_now_usec() - start;
+
+    printf("Coroutines: %u measurements in %u us, sequential %u us\n",
+           NUM_SENSORS * MEASUREMENTS, duration, sequential_usec);
+    CHECK_ZERO_TEXT(failures, "coroutine measurements");
+    CHECK_TRUE_TEXT(duration < sequential_usec, "interleaved measurements");
+}
+
+TEST (SHT_Coro_Tests, SHTCoroTestFleetMuxRecovery) {
+    const uint8_t muxes[] = {0x71, 0x72};
+    sht::coro::Scheduler sched;
+    sht_fleet_sensor_t missing;
+    uint16_t failures = 0;
+
+    /* behind a multiplexer that isn't on the bus */
+    sht_fleet_sensor_init(&missing, SHT_FAMILY_SHTC1, 0x70, SHT_BUS_DEFAULT,
+                          0x73, 0);
+    sched.spawn(measure_loop(
+        sht::coro::FleetSensor(sched, &missing, &mux, muxes, 2), &failures));
+    sched.run();
+    CHECK_EQUAL_TEXT(MEASUREMENTS, failures, "missing multiplexer");
+    CHECK_FALSE_TEXT(mux.valid, "routing state after failed route");
+
+    failures = 0;
+    for (uint16_t i = 0; i < NUM_SENSORS; ++i)
+        sched.spawn(measure_loop(
+            sht::coro::FleetSensor(sched, &sensors[i], &mux, muxes, 2),
+            &failures));
+    sched.run();
+    CHECK_ZERO_TEXT(failures, "coroutine measurements after failed route");
+    CHECK_TRUE_TEXT(mux.valid, "multiplexers reset after failed route");
+}
+
+TEST (SHT_Coro_Tests, SHTCoroTestSht4x) {
+    sht::coro::Scheduler sched;
+    uint16_t failures = 0;
+
+    int16_t ret = sht_mux_route(&mux, 0x71, 7);
+    CHECK_ZERO_TEXT(ret, "sht_mux_route");
+    sched.spawn(
+        sht4x_loop(sht::coro::Sht4x(sched, &sensors[2].dev.sht4x), &failures));
+    sched.run();
+    CHECK_ZERO_TEXT(failures, "sht4x coroutine measurements");
+}
+
+TEST (SHT_Coro_Tests, SHTCoroTestSht3xArt) {
+    sht3x_dev_t* dev = &sensors[4].dev.sht3x;
+    sht::coro::Scheduler sched;
+    uint16_t failures = 0;
+
+    int16_t ret = sht_mux_route(&mux, 0x72, 1);
+    CHECK_ZERO_TEXT(ret, "sht_mux_route");
+    /* the first measurement starts ART mode */
+    sht3x_dev_set_power_mode(dev, SHT3X_MEAS_MODE_ART);
+    sched.spawn(sht3x_loop(sched, sht::coro::Sht3x(sched, dev), 0, &failures));
+    sched.run();
+    CHECK_ZERO_TEXT(failures, "sht3x ART coroutine measurements");
+    CHECK_TRUE_TEXT(SHT3X_IS_ART_ACTIVE(sht3x_dev_get_acquisition_state(dev)),
+                    "sht3x ART mode");
+    ret = sht3x_dev_stop_periodic(dev);
+    CHECK_ZERO_TEXT(ret, "sht3x_dev_stop_periodic");
+}
+
+TEST (SHT_Coro_Tests, SHTCoroTestSht3xPeriodic) {
+    sht3x_dev_t* dev = &sensors[4].dev.sht3x;
+    sht::coro::Scheduler sched;
+    uint16_t failures = 0;
+
+    int16_t ret = sht_mux_route(&mux, 0x72, 1);
+    CHECK_ZERO_TEXT(ret, "sht_mux_route");
+    ret = sht3x_dev_start_periodic(dev, SHT3X_PERIODIC_MPS_10,
+                                   SHT3X_MEAS_MODE_HPM);
+    CHECK_ZERO_TEXT(ret, "sht3x_dev_start_periodic");
+    /* one fetch per period of 100ms */
+    sched.spawn(
+        sht3x_loop(sched, sht::coro::Sht3x(sched, dev), 100000, &failures));
+    sched.run();
+    CHECK_ZERO_TEXT(failures, "sht3x periodic coroutine measurements");
+    ret = sht3x_dev_stop_periodic(dev);
+    CHECK_ZERO_TEXT(ret, "sht3x_dev_stop_periodic");
+}
@@ -0,0 +1,597 @@
+#include <stdio.h>
+
+#include "sensirion_common.h"
+#include "sensirion_test_setup.h"
+#include "sht_executor.h"
+#include "sht_fleet.h"
+#include "sht_inventory.h"
+#include "sht_scheduler.h"
+#include "sht_time.h"
+#include "sht_topology.h"
+
+/* Sensors of the mux testbed, grouped by multiplexer and channel */
+#define NUM_SENSORS 5
+
+static sht_fleet_sensor_t sensors[NUM_SENSORS];
+static sht_mux_state_t mux;
+
+static void init_sensors(sht_fleet_sensor_t* testbed, uint8_t bus) {
+    sht_fleet_sensor_init(&testbed[0], SHT_FAMILY_SHTC1, 0x70, bus, 0x71, 0);
+    sht_fleet_sensor_init(&testbed[1], SHT_FAMILY_SHTC1, 0x70, bus, 0x71, 6);
+    sht_fleet_sensor_init(&testbed[2], SHT_FAMILY_SHT4X, 0x44, bus, 0x71, 7);
+    sht_fleet_sensor_init(&testbed[3], SHT_FAMILY_SHTC1, 0x70, bus, 0x72, 0);
+    sht_fleet_sensor_init(&testbed[4], SHT_FAMILY_SHT3X, 0x44, bus, 0x72, 1);
+}
+
+static void check_results(const sht_fleet_result_t* results) {
+    for (uint16_t i = 0; i < NUM_SENSORS; ++i) {
+        CHECK_ZERO_TEXT(results[i].status, "sht_fleet_sweep sensor status");
+        CHECK_TRUE_TEXT(results[i].temperature >= 5000 &&
+                            results[i].temperature <= 45000,
+                        "sht_fleet_sweep temperature");
+        CHECK_TRUE_TEXT(results[i].humidity >= 0 &&
+                            results[i].humidity <= 100000,
+                        "sht_fleet_sweep humidity");
+    }
+}
+
+TEST_GROUP (SHT_Fleet_Tests) {
+    void setup() {
+        sensirion_i2c_init();
+        sht_mux_init(&mux, SHT_BUS_DEFAULT);
+        init_sensors(sensors, SHT_BUS_DEFAULT);
+    }
+
+    void teardown() {
+        sht_mux_release(&mux);
+        sensirion_i2c_release();
+    }
+};
+
+TEST (SHT_Fleet_Tests, SHTFleetTestSweep) {
+    sht_fleet_result_t results[NUM_SENSORS];
+    uint32_t sequential_usec = 0;
+
+    for (uint16_t i = 0; i < NUM_SENSORS; ++i)
+        sequential_usec += sht_fleet_sensor_wait_usec(&sensors[i]);
+
+    uint32_t start = sht_time_now_usec();
+    int16_t ret = sht_fleet_sweep(sensors, NUM_SENSORS, &mux, results);
+    uint32_t duration = sht_time_now_usec() - start;
+    CHECK_ZERO_TEXT(ret, "sht_fleet_sweep");
+    check_results(results);
+    printf("Fleet sweep of %u sensors: %u us\n", NUM_SENSORS, duration);
+    CHECK_TRUE_TEXT(duration < sequential_usec, "sht_fleet_sweep duration");
+
+    /* the routing state is kept, the second sweep skips the mux reset */
+    uint32_t switches = mux.switches;
+    ret = sht_fleet_sweep(sensors, NUM_SENSORS, &mux, results);
+    CHECK_ZERO_TEXT(ret, "sht_fleet_sweep again");
+    check_results(results);
+    printf("Multiplexer writes: %u, %u\n", switches, mux.switches - switches);
+}
+
+TEST (SHT_Fleet_Tests, SHTFleetTestSweepArt) {
+    sht_fleet_result_t result;
+
+    /* the first sweep starts ART mode and waits for its first sample */
+    sht_fleet_sensor_set_mode(&sensors[4], SHT3X_MEAS_MODE_ART);
+    int16_t ret = sht_fleet_sweep(&sensors[4], 1, &mux, &result);
+    CHECK_ZERO_TEXT(ret, "sht_fleet_sweep starting ART mode");
+    CHECK_TRUE_TEXT(result.temperature >= 5000 && result.temperature <= 45000,
+                    "sht_fleet_sweep temperature");
+    CHECK_TRUE_TEXT(SHT3X_IS_ART_ACTIVE(sensors[4].dev.sht3x.acq_state),
+                    "ART mode");
+
+    ret = sht_mux_route(&mux, sensors[4].mux_addr, sensors[4].mux_channel);
+    CHECK_ZERO_TEXT(ret, "sht_mux_route");
+    ret = sht3x_dev_stop_periodic(&sensors[4].dev.sht3x);
+    CHECK_ZERO_TEXT(ret, "sht3x_dev_stop_periodic");
+}
+
+TEST (SHT_Fleet_Tests, SHTFleetTestPeriodic) {
+    sht_fleet_result_t results[NUM_SENSORS];
+
+    int16_t ret = sht_mux_route(&mux, 0x72, 1);
+    CHECK_ZERO_TEXT(ret, "sht_mux_route");
+    ret = sht3x_dev_start_periodic(&sensors[4].dev.sht3x, SHT3X_PERIODIC_MPS_10,
+                                   SHT3X_MEAS_MODE_HPM);
+    CHECK_ZERO_TEXT(ret, "sht3x_dev_start_periodic");
+    CHECK_ZERO_TEXT(sht_fleet_sensor_wait_usec(&sensors[4]),
+                    "sht_fleet_sensor_wait_usec periodic");
+    sensirion_sleep_usec(100000);
+
+    ret = sht_fleet_sweep(sensors, NUM_SENSORS, &mux, results);
+    CHECK_ZERO_TEXT(ret, "sht_fleet_sweep with periodic SHT3x");
+    check_results(results);
+
+    ret = sht_mux_route(&mux, 0x72, 1);
+    CHECK_ZERO_TEXT(ret, "sht_mux_route");
+    ret = sht3x_dev_stop_periodic(&sensors[4].dev.sht3x);
+    CHECK_ZERO_TEXT(ret, "sht3x_dev_stop_periodic");
+}
+
+TEST (SHT_Fleet_Tests, SHTFleetTestAlertWords) {
+    static const uint16_t words[] = {
+        SHT3X_ALERT_LIMIT_WORD(80000, 60000),
+        SHT3X_ALERT_LIMIT_WORD(79000, 58000),
+        SHT3X_ALERT_LIMIT_WORD(22000, -9000),
+        SHT3X_ALERT_LIMIT_WORD(20000, -10000),
+    };
+    int16_t results[NUM_SENSORS];
+
+    int16_t ret = sht_fleet_set_alert_words(sensors, NUM_SENSORS, &mux, words,
+                                            SHT3X_VERIFY_READ_BACK, results);
+    CHECK_ZERO_TEXT(ret, "sht_fleet_set_alert_words");
+    for (uint16_t i = 0; i < NUM_SENSORS; ++i)
+        CHECK_ZERO_TEXT(results[i], "sht_fleet_set_alert_words sensor status");
+    for (uint16_t i = 0; i < 4; ++i)
+        CHECK_EQUAL_TEXT(words[i], sensors[4].dev.sht3x.alert_words[i],
+                         "cached limit word");
+}
+
+TEST (SHT_Fleet_Tests, SHTFleetTestWrongBus) {
+    sht_fleet_result_t results[NUM_SENSORS];
+
+    sht_fleet_sensor_init(&sensors[0], SHT_FAMILY_SHT4X, 0x44, 1, 0x71, 7);
+    int16_t ret = sht_fleet_sweep(sensors, NUM_SENSORS, &mux, results);
+    CHECK_EQUAL_TEXT(STATUS_ERR_INVALID_PARAMS, ret,
+                     "sht_fleet_sweep with sensor on other bus");
+}
+
+TEST (SHT_Fleet_Tests, SHTFleetTestDiscover) {
+    static sht_topology_t topology;
+    const uint8_t muxes[] = {0x71, 0x72};
+    sht_fleet_result_t results[SHT_TOPOLOGY_MAX_SENSORS];
+
+    sht_topology_init(&topology, SHT_BUS_DEFAULT, muxes, 2);
+    uint32_t start = sht_time_now_usec();
+    int16_t ret = sht_topology_discover(&topology);
+    uint32_t duration = sht_time_now_usec() - start;
+    printf("Discovered %d sensors in %u us\n", ret, duration);
+    CHECK_EQUAL_TEXT(NUM_SENSORS, ret, "sht_topology_discover");
+
+    for (uint16_t i = 0; i < NUM_SENSORS; ++i) {
+        const sht_fleet_sensor_t* found = &topology.sensors[i];
+        const sht_fleet_sensor_t* expected = &sensors[i];
+        CHECK_EQUAL_TEXT(expected->family, found->family,
+                         "sht_topology_discover family");
+        CHECK_EQUAL_TEXT(expected->mux_addr, found->mux_addr,
+                         "sht_topology_discover multiplexer");
+        CHECK_EQUAL_TEXT(expected->mux_channel, found->mux_channel,
+                         "sht_topology_discover channel");
+        CHECK_TRUE_TEXT(topology.serials[i] != 0,
+                        "sht_topology_discover serial");
+        for (uint16_t j = 0; j < i; ++j)
+            CHECK_TRUE_TEXT(topology.serials[i] != topology.serials[j],
+                            "sht_topology_discover unique serials");
+    }
+
+    ret = sht_topology_sweep(&topology, results);
+    CHECK_ZERO_TEXT(ret, "sht_topology_sweep");
+}
+
+/* bus of the simulated testbed with sensors on the root bus, see
+ * sim_testbed.c */
+#define ROOT_SENSORS_BUS 4
+
+TEST (SHT_Fleet_Tests, SHTFleetTestDiscoverRootSensors) {
+    static sht_topology_t topology;
+    const uint8_t muxes[] = {0x71};
+    sht_fleet_result_t results[SHT_TOPOLOGY_MAX_SENSORS];
+
+    if (sensirion_i2c_select_bus(ROOT_SENSORS_BUS) != NO_ERROR) {
+        printf("Root sensor discovery: no bus %u, skipped\n",
+               ROOT_SENSORS_BUS);
+        return;
+    }
+
+    /* the root sensors also answer behind every mux channel, they must be
+     * found once and keep their serials */
+    sht_topology_init(&topology, ROOT_SENSORS_BUS, muxes, 1);
+    int16_t ret = sht_topology_discover(&topology);
+    CHECK_EQUAL_TEXT(3, ret, "sht_topology_discover with root sensors");
+    CHECK_EQUAL_TEXT(SHT_MUX_NONE, topology.sensors[0].mux_addr,
+                     "root sensor multiplexer");
+    CHECK_EQUAL_TEXT(SHT_MUX_NONE, topology.sensors[1].mux_addr,
+                     "root sensor multiplexer");
+    CHECK_EQUAL_TEXT(SHT_FAMILY_SHT4X, topology.sensors[2].family,
+                     "channel sensor family");
+    CHECK_EQUAL_TEXT(2, topology.sensors[2].mux_channel,
+                     "channel sensor channel");
+    for (uint16_t i = 0; i < 3; ++i) {
+        CHECK_TRUE_TEXT(topology.serials[i] != 0,
+                        "sht_topology_discover serial");
+        for (uint16_t j = 0; j < i; ++j)
+            CHECK_TRUE_TEXT(topology.serials[i] != topology.serials[j],
+                            "sht_topology_discover unique serials");
+    }
+    CHECK_ZERO_TEXT(sht_topology_verify(&topology), "sht_topology_verify");
+    ret = sht_topology_sweep(&topology, results);
+    CHECK_ZERO_TEXT(ret, "sht_topology_sweep");
+    sensirion_i2c_select_bus(0);
+}
+
+TEST (SHT_Fleet_Tests, SHTFleetTestTopologyGrouping) {
+    static sht_topology_t topology;
+    const uint8_t muxes[] = {0x71, 0x72};
+
+    sht_topology_init(&topology, SHT_BUS_DEFAULT, muxes, 2);
+    for (uint16_t i = 0; i < NUM_SENSORS; ++i) {
+        const sht_fleet_sensor_t* s = &sensors[NUM_SENSORS - 1 - i];
+        int16_t ret = sht_topology_add(&topology, s->family,
+                                       sht_fleet_sensor_address(s),
+                                       s->mux_addr, s->mux_channel, 0);
+        CHECK_TRUE_TEXT(ret >= 0, "sht_topology_add");
+    }
+    for (uint16_t i = 1; i < NUM_SENSORS; ++i) {
+        const sht_fleet_sensor_t* prev = &topology.sensors[i - 1];
+        const sht_fleet_sensor_t* s = &topology.sensors[i];
+        CHECK_TRUE_TEXT(prev->mux_addr < s->mux_addr ||
+                            (prev->mux_addr == s->mux_addr &&
+                             prev->mux_channel <= s->mux_channel),
+                        "sht_topology_add grouping");
+    }
+}
+
+TEST (SHT_Fleet_Tests, SHTFleetTestModes) {
+    const uint8_t sht3x_modes[] = {SHT3X_MEAS_MODE_LPM, SHT3X_MEAS_MODE_MPM,
+                                   SHT3X_MEAS_MODE_ART, SHT3X_MEAS_MODE_HPM};
+    const uint8_t sht4x_modes[] = {SHT4X_MEAS_MODE_LPM, SHT4X_MEAS_MODE_MPM,
+                                   SHT4X_MEAS_MODE_HPM};
+
+    /* the configured mode is reported, not inferred from the duration */
+    for (uint16_t i = 0; i < sizeof(sht3x_modes); ++i) {
+        sht_fleet_sensor_set_mode(&sensors[4], sht3x_modes[i]);
+        CHECK_EQUAL_TEXT(sht3x_modes[i],
+                         sht_fleet_sensor_get_mode(&sensors[4]),
+                         "sht_fleet_sensor_get_mode SHT3x");
+    }
+    for (uint16_t i = 0; i < sizeof(sht4x_modes); ++i) {
+        sht_fleet_sensor_set_mode(&sensors[2], sht4x_modes[i]);
+        CHECK_EQUAL_TEXT(sht4x_modes[i],
+                         sht_fleet_sensor_get_mode(&sensors[2]),
+                         "sht_fleet_sensor_get_mode SHT4x");
+    }
+    for (uint8_t low_power = 0; low_power < 2; ++low_power) {
+        sht_fleet_sensor_set_mode(&sensors[0], low_power);
+        CHECK_EQUAL_TEXT(low_power, sht_fleet_sensor_get_mode(&sensors[0]),
+                         "sht_fleet_sensor_get_mode SHTC1");
+    }
+}
+
+TEST (SHT_Fleet_Tests, SHTFleetTestInventory) {
+    static sht_topology_t topology;
+    const char* path = "sht-fleet-test-inventory.txt";
+    const uint8_t muxes[] = {0x71, 0x72};
+    uint8_t cached;
+
+    remove(path);
+    sht_topology_init(&topology, SHT_BUS_DEFAULT, muxes, 2);
+    uint32_t start = sht_time_now_usec();
+    int16_t ret = sht_inventory_restore(&topology, path, &cached);
+    uint32_t discover_usec = sht_time_now_usec() - start;
+    CHECK_EQUAL_TEXT(NUM_SENSORS, ret, "sht_inventory_restore without file");
+    CHECK_FALSE_TEXT(cached, "sht_inventory_restore discovered");
+    uint32_t serial = topology.serials[2];
+
+    /* restart with the inventory, keeping a non-default mode and a running
+     * periodic acquisition */
+    sht_fleet_sensor_set_mode(&topology.sensors[2], SHT4X_MEAS_MODE_LPM);
+    CHECK_EQUAL_TEXT(SHT_FAMILY_SHT3X, topology.sensors[4].family,
+                     "inventory SHT3x");
+    sht3x_dev_t* sht3x = &topology.sensors[4].dev.sht3x;
+    ret = sht_mux_route(&topology.mux, 0x72, 1);
+    CHECK_ZERO_TEXT(ret, "sht_mux_route");
+    ret = sht3x_dev_start_periodic(sht3x, SHT3X_PERIODIC_MPS_2,
+                                   SHT3X_MEAS_MODE_MPM);
+    CHECK_ZERO_TEXT(ret, "sht3x_dev_start_periodic");
+    uint16_t cmd_periodic = sht3x->cmd_periodic;
+    ret = sht_inventory_save(&topology, path);
+    CHECK_ZERO_TEXT(ret, "sht_inventory_save");
+    sht_topology_init(&topology, SHT_BUS_DEFAULT, muxes, 2);
+    start = sht_time_now_usec();
+    ret = sht_inventory_restore(&topology, path, &cached);
+    uint32_t restore_usec = sht_time_now_usec() - start;
+    printf("Inventory discovery: %u us, restore: %u us\n", discover_usec,
+           restore_usec);
+    CHECK_EQUAL_TEXT(NUM_SENSORS, ret, "sht_inventory_restore");
+    CHECK_TRUE_TEXT(cached, "sht_inventory_restore from file");
+    CHECK_TRUE_TEXT(restore_usec < discover_usec, "inventory restore time");
+    CHECK_EQUAL_TEXT(serial, topology.serials[2], "inventory serial");
+    CHECK_EQUAL_TEXT(SHT4X_MEAS_MODE_LPM,
+                     sht_fleet_sensor_get_mode(&topology.sensors[2]),
+                     "inventory mode");
+    CHECK_TRUE_TEXT(SHT3X_IS_PERIODIC_ACTIVE(sht3x->acq_state),
+                    "inventory acquisition state");
+    CHECK_EQUAL_TEXT(cmd_periodic, sht3x->cmd_periodic,
+                     "inventory periodic command");
+    ret = sht_mux_route(&topology.mux, 0x72, 1);
+    CHECK_ZERO_TEXT(ret, "sht_mux_route");
+    ret = sht3x_dev_stop_periodic(sht3x);
+    CHECK_ZERO_TEXT(ret, "sht3x_dev_stop_periodic");
+
+    /* a replaced sensor triggers a new discovery */
+    topology.serials[2] = ~serial;
+    ret = sht_inventory_save(&topology, path);
+    CHECK_ZERO_TEXT(ret, "sht_inventory_save");
+    sht_topology_init(&topology, SHT_BUS_DEFAULT, muxes, 2);
+    ret = sht_inventory_restore(&topology, path, &cached);
+    CHECK_EQUAL_TEXT(NUM_SENSORS, ret, "sht_inventory_restore mismatch");
+    CHECK_FALSE_TEXT(cached, "sht_inventory_restore rediscovered");
+    CHECK_EQUAL_TEXT(serial, topology.serials[2], "rediscovered serial");
+    remove(path);
+}
+
+TEST (SHT_Fleet_Tests, SHTFleetTestInventorySensorReset) {
+    static sht_topology_t topology;
+    const char* path = "sht-fleet-test-inventory-reset.txt";
+    const uint8_t muxes[] = {0x71, 0x72};
+    sht_fleet_result_t results[NUM_SENSORS];
+    uint8_t cached;
+
+    remove(path);
+    sht_topology_init(&topology, SHT_BUS_DEFAULT, muxes, 2);
+    int16_t ret = sht_inventory_restore(&topology, path, &cached);
+    CHECK_EQUAL_TEXT(NUM_SENSORS, ret, "sht_inventory_restore without file");
+    CHECK_EQUAL_TEXT(SHT_FAMILY_SHT3X, topology.sensors[4].family,
+                     "inventory SHT3x");
+    sht3x_dev_t* sht3x = &topology.sensors[4].dev.sht3x;
+    ret = sht_mux_route(&topology.mux, 0x72, 1);
+    CHECK_ZERO_TEXT(ret, "sht_mux_route");
+    ret = sht3x_dev_start_periodic(sht3x, SHT3X_PERIODIC_MPS_2,
+                                   SHT3X_MEAS_MODE_MPM);
+    CHECK_ZERO_TEXT(ret, "sht3x_dev_start_periodic");
+    ret = sht_inventory_save(&topology, path);
+    CHECK_ZERO_TEXT(ret, "sht_inventory_save");
+
+    /* the SHT3x is power cycled while the application restarts */
+    ret = sensirion_i2c_general_call_reset();
+    CHECK_ZERO_TEXT(ret, "sensirion_i2c_general_call_reset");
+    sensirion_sleep_usec(1000);
+
+    sht_topology_init(&topology, SHT_BUS_DEFAULT, muxes, 2);
+    ret = sht_inventory_restore(&topology, path, &cached);
+    CHECK_EQUAL_TEXT(NUM_SENSORS, ret, "sht_inventory_restore");
+    CHECK_TRUE_TEXT(cached, "sht_inventory_restore from file");
+    CHECK_EQUAL_TEXT(1, sht3x->resets, "re-provisioned SHT3x");
+    CHECK_TRUE_TEXT(SHT3X_IS_PERIODIC_ACTIVE(sht3x->acq_state),
+                    "inventory acquisition state");
+    ret = sht_topology_sweep(&topology, results);
+    CHECK_ZERO_TEXT(ret, "sht_topology_sweep after sensor reset");
+
+    ret = sht_mux_route(&topology.mux, 0x72, 1);
+    CHECK_ZERO_TEXT(ret, "sht_mux_route");
+    ret = sht3x_dev_stop_periodic(sht3x);
+    CHECK_ZERO_TEXT(ret, "sht3x_dev_stop_periodic");
+    remove(path);
+}
+
+static int16_t read_serial_command(sht_fleet_sensor_t* sensor, void* arg) {
+    return sht_fleet_sensor_read_serial(sensor, (uint32_t*)arg);
+}
+
+static void count_callback(void* user_data, const sht_fleet_result_t* result) {
+    if (result->status == STATUS_OK)
+        ++*(uint16_t*)user_data;
+}
+
+TEST (SHT_Fleet_Tests, SHTFleetTestExecutorCoalescing) {
+    static sht_executor_t exec;
+    const uint8_t muxes[] = {0x71, 0x72};
+    sht_exec_completion_t completions[2 * NUM_SENSORS + 1];
+    sht_exec_request_t request;
+    uint16_t callbacks = 0;
+    uint32_t serial = 0;
+
+    int16_t ret = sht_exec_init(&exec, SHT_BUS_DEFAULT, muxes, 2);
+    CHECK_ZERO_TEXT(ret, "sht_exec_init");
+
+    /* queued before the worker runs, so that they end up in one batch */
+    for (uint16_t i = 0; i < 2 * NUM_SENSORS + 1; ++i) {
+        request.sensor = &sensors[i % NUM_SENSORS];
+        request.command = i < 2 * NUM_SENSORS ? NULL : read_serial_command;
+        request.arg = &serial;
+        request.completion = &completions[i];
+        request.callback = count_callback;
+        request.user_data = &callbacks;
+        sht_exec_completion_init(&completions[i]);
+        ret = sht_exec_submit(&exec, &request);
+        CHECK_ZERO_TEXT(ret, "sht_exec_submit");
+    }
+    ret = sht_exec_start(&exec);
+    CHECK_ZERO_TEXT(ret, "sht_exec_start");
+
+    for (uint16_t i = 0; i < 2 * NUM_SENSORS + 1; ++i) {
+        ret = sht_exec_completion_wait(&completions[i]);
+        CHECK_ZERO_TEXT(ret, "sht_exec_completion_wait");
+    }
+    for (uint16_t i = 0; i < NUM_SENSORS; ++i) {
+        const sht_fleet_result_t* first = &completions[i].result;
+        const sht_fleet_result_t* second =
+            &completions[i + NUM_SENSORS].result;
+        CHECK_TRUE_TEXT(first->temperature >= 5000 &&
+                            first->temperature <= 45000,
+                        "executor temperature");
+        CHECK_EQUAL_TEXT(first->temperature, second->temperature,
+                         "coalesced temperature");
+        CHECK_EQUAL_TEXT(first->humidity, second->humidity,
+                         "coalesced humidity");
+    }
+    CHECK_TRUE_TEXT(serial != 0, "executor command");
+    sht_exec_stop(&exec);
+
+    CHECK_EQUAL_TEXT(2 * NUM_SENSORS + 1, exec.requests, "executor requests");
+    CHECK_EQUAL_TEXT(2 * NUM_SENSORS + 1, callbacks, "executor callbacks");
+    CHECK_EQUAL_TEXT(NUM_SENSORS, exec.measurements, "executor measurements");
+    CHECK_EQUAL_TEXT(NUM_SENSORS, exec.coalesced, "executor coalesced");
+}
+
+#define EXEC_CLIENTS 4
+#define EXEC_CLIENT_REQUESTS 10
+
+struct exec_client {
+    sht_executor_t* exec;
+    uint16_t index;
+    uint16_t failures;
+};
+
+static void* exec_client_thread(void* arg) {
+    struct exec_client* client = (struct exec_client*)arg;
+    sht_fleet_result_t result;
+
+    for (uint16_t i = 0; i < EXEC_CLIENT_REQUESTS; ++i) {
+        sht_fleet_sensor_t* sensor =
+            &sensors[(client->index + i) % NUM_SENSORS];
+        if (sht_exec_measure(client->exec, sensor, &result) != STATUS_OK ||
+            result.temperature < 5000 || result.temperature > 45000)
+            client->failures++;
+    }
+    return NULL;
+}
+
+TEST (SHT_Fleet_Tests, SHTFleetTestExecutorThreads) {
+    static sht_executor_t exec;
+    const uint8_t muxes[] = {0x71, 0x72};
+    struct exec_client clients[EXEC_CLIENTS];
+    pthread_t threads[EXEC_CLIENTS];
+
+    int16_t ret = sht_exec_init(&exec, SHT_BUS_DEFAULT, muxes, 2);
+    CHECK_ZERO_TEXT(ret, "sht_exec_init");
+    ret = sht_exec_start(&exec);
+    CHECK_ZERO_TEXT(ret, "sht_exec_start");
+
+    for (uint16_t i = 0; i < EXEC_CLIENTS; ++i) {
+        clients[i].exec = &exec;
+        clients[i].index = i;
+        clients[i].failures = 0;
+        CHECK_ZERO_TEXT(pthread_create(&threads[i], NULL, exec_client_thread,
+                                       &clients[i]),
+                        "pthread_create");
+    }
+    for (uint16_t i = 0; i < EXEC_CLIENTS; ++i) {
+        pthread_join(threads[i], NULL);
+        CHECK_ZERO_TEXT(clients[i].failures, "executor client failures");
+    }
+    sht_exec_stop(&exec);
+
+    printf("Executor: %u requests, %u measurements\n", exec.requests,
+           exec.measurements);
+    CHECK_EQUAL_TEXT(EXEC_CLIENTS * EXEC_CLIENT_REQUESTS, exec.requests,
+                     "executor requests");
+    CHECK_EQUAL_TEXT(exec.requests, exec.measurements + exec.coalesced,
+                     "executor measurements");
+}
+
+TEST (SHT_Fleet_Tests, SHTFleetTestExecutorMuxRecovery) {
+    static sht_executor_t exec;
+    const uint8_t muxes[] = {0x71, 0x72};
+    sht_fleet_sensor_t missing;
+    sht_fleet_result_t result;
+
+    /* behind a multiplexer that isn't on the bus */
+    sht_fleet_sensor_init(&missing, SHT_FAMILY_SHTC1, 0x70, SHT_BUS_DEFAULT,
+                          0x73, 0);
+    int16_t ret = sht_exec_init(&exec, SHT_BUS_DEFAULT, muxes, 2);
+    CHECK_ZERO_TEXT(ret, "sht_exec_init");
+    ret = sht_exec_start(&exec);
+    CHECK_ZERO_TEXT(ret, "sht_exec_start");
+
+    ret = sht_exec_measure(&exec, &sensors[0], &result);
+    CHECK_ZERO_TEXT(ret, "sht_exec_measure");
+    ret = sht_exec_measure(&exec, &missing, &result);
+    CHECK_TRUE_TEXT(ret != STATUS_OK, "sht_exec_measure missing mux");
+    CHECK_ZERO_TEXT(result.temperature, "failed measurement temperature");
+    CHECK_ZERO_TEXT(result.humidity, "failed measurement humidity");
+    for (uint16_t i = 0; i < NUM_SENSORS; ++i) {
+        ret = sht_exec_measure(&exec, &sensors[i], &result);
+        CHECK_ZERO_TEXT(ret, "sht_exec_measure after failed route");
+        CHECK_TRUE_TEXT(result.temperature >= 5000 &&
+                            result.temperature <= 45000,
+                        "executor temperature after failed route");
+    }
+    sht_exec_stop(&exec);
+    CHECK_TRUE_TEXT(exec.mux.valid, "multiplexers reset after failed route");
+}
+
+struct sched_totals {
+    uint32_t count;
+    int64_t temperature;
+};
+
+static void sum_post(void* user_data, sht_fleet_sensor_t* sensor,
+                     sht_fleet_result_t* result) {
+    struct sched_totals* totals = (struct sched_totals*)user_data;
+
+    (void)sensor;
+    __atomic_add_fetch(&totals->count, 1, __ATOMIC_RELAXED);
+    __atomic_add_fetch(&totals->temperature, result->temperature,
+                       __ATOMIC_RELAXED);
+}
+
+TEST (SHT_Fleet_Tests, SHTFleetTestSchedulerBuses) {
+    static sht_fleet_sensor_t bus_sensors[SHT_SCHED_MAX_BUSES][NUM_SENSORS];
+    static sht_fleet_result_t bus_results[SHT_SCHED_MAX_BUSES][NUM_SENSORS];
+    static sht_scheduler_t single;
+    static sht_scheduler_t sched;
+    struct sched_totals totals = {0, 0};
+    uint8_t num_buses = 0;
+
+    /* the testbed is replicated on every bus the I2C layer can select */
+    while (num_buses < SHT_SCHED_MAX_BUSES &&
+           sensirion_i2c_select_bus(num_buses) == NO_ERROR)
+        ++num_buses;
+    sensirion_i2c_select_bus(0);
+    if (!num_buses) {
+        printf("Scheduler: bus selection not supported, skipped\n");
+        return;
+    }
+
+    /* the same sweep on bus 0 alone as reference */
+    init_sensors(bus_sensors[0], 0);
+    int16_t ret = sht_sched_init(&single, NULL, NULL);
+    CHECK_ZERO_TEXT(ret, "sht_sched_init single bus");
+    ret = sht_sched_add_bus(&single, 0, bus_sensors[0], NUM_SENSORS,
+                            bus_results[0]);
+    CHECK_ZERO_TEXT(ret, "sht_sched_add_bus single bus");
+    ret = sht_sched_sweep(&single);
+    CHECK_ZERO_TEXT(ret, "sht_sched_sweep single bus");
+    check_results(bus_results[0]);
+    sht_sched_release(&single);
+
+    ret = sht_sched_init(&sched, sum_post, &totals);
+    CHECK_ZERO_TEXT(ret, "sht_sched_init");
+    ret = sht_sched_add_bus(&sched, SHT_BUS_DEFAULT, sensors, NUM_SENSORS,
+                            bus_results[0]);
+    CHECK_EQUAL_TEXT(STATUS_ERR_INVALID_PARAMS, ret,
+                     "sht_sched_add_bus with default bus");
+    for (uint8_t bus = 0; bus < num_buses; ++bus) {
+        init_sensors(bus_sensors[bus], bus);
+        ret = sht_sched_add_bus(&sched, bus, bus_sensors[bus], NUM_SENSORS,
+                                bus_results[bus]);
+        CHECK_ZERO_TEXT(ret, "sht_sched_add_bus");
+    }
+    ret = sht_sched_sweep(&sched);
+    CHECK_ZERO_TEXT(ret, "sht_sched_sweep");
+
+    uint32_t post_jobs = 0;
+    for (uint8_t bus = 0; bus < num_buses; ++bus) {
+        check_results(bus_results[bus]);
+        post_jobs += sched.buses[bus].post_jobs;
+        printf("Scheduler bus %u: %u us, %u results post-processed, %u of "
+               "other buses\n",
+               bus, sched.buses[bus].sweep_usec, sched.buses[bus].post_jobs,
+               sched.buses[bus].stolen);
+    }
+    printf("Scheduler sweep of %u buses: %u us, single bus: %u us\n",
+           num_buses, sched.sweep_usec, single.sweep_usec);
+    CHECK_EQUAL_TEXT(num_buses * NUM_SENSORS, totals.count,
+                     "post-processed results");
+    CHECK_EQUAL_TEXT(totals.count, post_jobs, "scheduler post jobs");
+    CHECK_TRUE_TEXT(totals.temperature >= 5000 * (int64_t)totals.count,
+                    "aggregated temperature");
+    /* the buses run in parallel */
+    CHECK_TRUE_TEXT(sched.sweep_usec < single.sweep_usec * 3 / 2,
+                    "sht_sched_sweep duration");
+    sht_sched_release(&sched);
+}
@@ -1,6 +1,11 @@
 #include "sensirion_common.h"
 #include "sensirion_test_setup.h"
 #include "sht3x.h"
+#include "sht3x.hpp"
+
+#ifdef SENSIRION_TEST_SIM_I2C
+#include "sensirion_sim_i2c.h"
+#endif /* SENSIRION_TEST_SIM_I2C */
 
 static void sht3x_run_test() {
     int16_t ret;
@@ -19,7 +24,7 @@ static void sht3x_run_test() {
     ret = sht3x_measure(SHT3X_I2C_ADDR_DFLT);
     CHECK_ZERO_TEXT(ret, "sht3x_measure");
 
-    sensirion_sleep_usec(SHT3X_MEASUREMENT_DURATION_USEC);
+    sensirion_sleep_usec(sht3x_get_measurement_duration_usec());
 
     ret = sht3x_read(SHT3X_I2C_ADDR_DFLT, &temperature, &humidity);
     CHECK_ZERO_TEXT(ret, "sht3x_read");
@@ -42,9 +47,399 @@ static void sht3x_test_all_power_modes() {
     printf("Running tests in normal mode...\n");
     sht3x_run_test();
 
+    printf("Running tests in medium power mode...\n");
+    sht3x_set_power_mode(SHT3X_MEAS_MODE_MPM);
+    sht3x_run_test();
+
     printf("Running tests in low power mode...\n");
     sht3x_enable_low_power_mode(1);
     sht3x_run_test();
+
+    sht3x_enable_low_power_mode(0);
+}
+
+static void sht3x_test_periodic() {
+    int32_t temperature, humidity;
+    int16_t ret = sht3x_start_periodic(SHT3X_I2C_ADDR_DFLT,
+                                       SHT3X_PERIODIC_MPS_10,
+                                       SHT3X_MEAS_MODE_HPM);
+    CHECK_ZERO_TEXT(ret, "sht3x_start_periodic");
+
+    ret = sht3x_measure(SHT3X_I2C_ADDR_DFLT);
+    CHECK_EQUAL_TEXT(STATUS_ERR_PERIODIC_MODE, ret, "sht3x_measure");
+
+    sensirion_sleep_usec(200000);
+    ret = sht3x_fetch_periodic(SHT3X_I2C_ADDR_DFLT, &temperature, &humidity);
+    CHECK_ZERO_TEXT(ret, "sht3x_fetch_periodic");
+    CHECK_TRUE_TEXT(temperature >= -45000 && temperature <= 130000,
+                    "sht3x_fetch_periodic temperature");
+    CHECK_TRUE_TEXT(humidity >= 0 && humidity <= 100000,
+                    "sht3x_fetch_periodic humidity");
+
+    /* each measurement is only returned once */
+    ret = sht3x_fetch_periodic(SHT3X_I2C_ADDR_DFLT, &temperature, &humidity);
+    CHECK_TRUE_TEXT(ret != 0, "sht3x_fetch_periodic without new data");
+
+    ret = sht3x_stop_periodic(SHT3X_I2C_ADDR_DFLT);
+    CHECK_ZERO_TEXT(ret, "sht3x_stop_periodic");
+    ret = sht3x_fetch_periodic(SHT3X_I2C_ADDR_DFLT, &temperature, &humidity);
+    CHECK_EQUAL_TEXT(STATUS_ERR_PERIODIC_MODE, ret, "sht3x_fetch_periodic");
+
+    ret = sht3x_measure_blocking_read(SHT3X_I2C_ADDR_DFLT, &temperature,
+                                      &humidity);
+    CHECK_ZERO_TEXT(ret, "sht3x_measure_blocking_read");
+}
+
+static void sht3x_test_art() {
+    int32_t temperature, humidity;
+    int16_t ret;
+    uint8_t i;
+
+    sht3x_set_power_mode(SHT3X_MEAS_MODE_ART);
+    for (i = 0; i < 3; ++i) {
+        ret = sht3x_measure_blocking_read(SHT3X_I2C_ADDR_DFLT, &temperature,
+                                          &humidity);
+        CHECK_ZERO_TEXT(ret, "sht3x_measure_blocking_read in ART mode");
+        CHECK_TRUE_TEXT(temperature >= -45000 && temperature <= 130000,
+                        "sht3x_measure_blocking_read temperature");
+    }
+    uint8_t state = sht3x_get_acquisition_state(SHT3X_I2C_ADDR_DFLT);
+    CHECK_TRUE_TEXT(SHT3X_IS_ART_ACTIVE(state), "SHT3X_IS_ART_ACTIVE");
+    CHECK_TRUE_TEXT(SHT3X_IS_PERIODIC_ACTIVE(state),
+                    "SHT3X_IS_PERIODIC_ACTIVE");
+
+    ret = sht3x_stop_periodic(SHT3X_I2C_ADDR_DFLT);
+    CHECK_ZERO_TEXT(ret, "sht3x_stop_periodic");
+    state = sht3x_get_acquisition_state(SHT3X_I2C_ADDR_DFLT);
+    CHECK_FALSE_TEXT(SHT3X_IS_PERIODIC_ACTIVE(state),
+                     "SHT3X_IS_PERIODIC_ACTIVE after stop");
+    sht3x_set_power_mode(SHT3X_MEAS_MODE_HPM);
+
+    /* waiting for the next sample is not counted as an error */
+    sht3x_dev_t art;
+    sht3x_dev_init(&art, SHT3X_I2C_ADDR_DFLT, SHT_BUS_DEFAULT);
+    sht3x_dev_set_power_mode(&art, SHT3X_MEAS_MODE_ART);
+    for (i = 0; i < 2; ++i) {
+        ret = sht3x_dev_measure_blocking_read(&art, &temperature, &humidity);
+        CHECK_ZERO_TEXT(ret, "sht3x_dev_measure_blocking_read in ART mode");
+    }
+    CHECK_EQUAL_TEXT(2, art.stats.measurements, "art.stats.measurements");
+    CHECK_EQUAL_TEXT(0, art.stats.errors, "art.stats.errors");
+    ret = sht3x_dev_stop_periodic(&art);
+    CHECK_ZERO_TEXT(ret, "sht3x_dev_stop_periodic");
+}
+
+static void sht3x_test_nack_polling() {
+    int32_t temperature, humidity;
+    uint32_t max_duration = sht3x_get_measurement_duration_usec();
+
+    sht3x_set_nack_polling(SHT3X_I2C_ADDR_DFLT, 500, max_duration);
+    int16_t ret = sht3x_measure_blocking_read(SHT3X_I2C_ADDR_DFLT,
+                                              &temperature, &humidity);
+    CHECK_ZERO_TEXT(ret, "sht3x_measure_blocking_read with NACK polling");
+    uint32_t duration = sht3x_get_polled_duration_usec(SHT3X_I2C_ADDR_DFLT);
+    printf("SHT3X polled measurement duration: %u us\n", duration);
+    CHECK_TRUE_TEXT(duration <= max_duration, "sht3x polled duration");
+    sht3x_set_nack_polling(SHT3X_I2C_ADDR_DFLT, 0, 0);
+}
+
+static void sht3x_test_dev_contexts() {
+    sht3x_dev_t hpm, lpm;
+    int32_t temperature, humidity;
+
+    sht3x_dev_init(&hpm, SHT3X_I2C_ADDR_DFLT, SHT_BUS_DEFAULT);
+    sht3x_dev_init(&lpm, SHT3X_I2C_ADDR_DFLT, SHT_BUS_DEFAULT);
+    sht3x_dev_set_power_mode(&lpm, SHT3X_MEAS_MODE_LPM);
+    CHECK_TRUE_TEXT(sht3x_dev_get_measurement_duration_usec(&lpm) <
+                        sht3x_dev_get_measurement_duration_usec(&hpm),
+                    "sht3x_dev_get_measurement_duration_usec");
+
+    int16_t ret =
+        sht3x_dev_measure_blocking_read(&hpm, &temperature, &humidity);
+    CHECK_ZERO_TEXT(ret, "sht3x_dev_measure_blocking_read high repeatability");
+    ret = sht3x_dev_measure_blocking_read(&lpm, &temperature, &humidity);
+    CHECK_ZERO_TEXT(ret, "sht3x_dev_measure_blocking_read low repeatability");
+    CHECK_EQUAL_TEXT(1, hpm.stats.measurements, "hpm.stats.measurements");
+    CHECK_EQUAL_TEXT(1, lpm.stats.measurements, "lpm.stats.measurements");
+
+    /* reading again without a measurement in progress fails */
+    ret = sht3x_dev_read(&lpm, &temperature, &humidity);
+    CHECK_TRUE_TEXT(ret != 0, "sht3x_dev_read without measurement");
+    CHECK_EQUAL_TEXT(1, lpm.stats.errors, "lpm.stats.errors");
+}
+
+static void sht3x_test_raw() {
+    uint16_t t_ticks, rh_ticks;
+    int32_t temperature, humidity, raw_temperature, raw_humidity;
+
+    int16_t ret = sht3x_measure_blocking_read_raw(SHT3X_I2C_ADDR_DFLT,
+                                                  &t_ticks, &rh_ticks);
+    CHECK_ZERO_TEXT(ret, "sht3x_measure_blocking_read_raw");
+    tick_to_temperature(t_ticks, &raw_temperature);
+    tick_to_humidity(rh_ticks, &raw_humidity);
+
+    ret = sht3x_measure_blocking_read(SHT3X_I2C_ADDR_DFLT, &temperature,
+                                      &humidity);
+    CHECK_ZERO_TEXT(ret, "sht3x_measure_blocking_read");
+    CHECK_EQUAL_TEXT(temperature, raw_temperature, "raw temperature");
+    CHECK_EQUAL_TEXT(humidity, raw_humidity, "raw humidity");
+
+    ret = sht3x_measure(SHT3X_I2C_ADDR_DFLT);
+    CHECK_ZERO_TEXT(ret, "sht3x_measure");
+    sensirion_sleep_usec(sht3x_get_measurement_duration_usec());
+    ret = sht3x_read_raw(SHT3X_I2C_ADDR_DFLT, &t_ticks, &rh_ticks);
+    CHECK_ZERO_TEXT(ret, "sht3x_read_raw");
+    tick_to_temperature(t_ticks, &raw_temperature);
+    CHECK_EQUAL_TEXT(temperature, raw_temperature, "sht3x_read_raw");
+}
+
+typedef sht::Sht3x<SHT3X_I2C_ADDR_DFLT, SHT3X_MEAS_MODE_LPM> Sht3xLpm;
+typedef sht::Sht3x<SHT3X_I2C_ADDR_DFLT, SHT3X_MEAS_MODE_HPM, true> Sht3xCs;
+
+static_assert(Sht3xLpm::cmd_measure == 0x2416, "Sht3x LPM command");
+static_assert(Sht3xCs::cmd_measure == 0x2C06, "Sht3x clock stretching");
+static_assert(Sht3xLpm::measurement_duration_usec ==
+                  SHT3X_MEASUREMENT_DURATION_LPM_USEC,
+              "Sht3x LPM duration");
+static_assert(Sht3xLpm::tick_to_temperature(0) == -45000, "Sht3x T(0)");
+static_assert(Sht3xLpm::tick_to_humidity(0xFFFF) == 99998, "Sht3x RH(max)");
+
+static void sht3x_test_template() {
+    int32_t temperature = 0, humidity = 0, c_temperature, c_humidity;
+    uint32_t serial = 0, c_serial;
+    uint32_t tick;
+
+    for (tick = 0; tick <= 0xFFFF; ++tick) {
+        tick_to_temperature((uint16_t)tick, &c_temperature);
+        tick_to_humidity((uint16_t)tick, &c_humidity);
+        CHECK_EQUAL(c_temperature, Sht3xLpm::tick_to_temperature(tick));
+        CHECK_EQUAL(c_humidity, Sht3xLpm::tick_to_humidity(tick));
+    }
+
+    int16_t ret = sht3x_measure_blocking_read(SHT3X_I2C_ADDR_DFLT,
+                                              &c_temperature, &c_humidity);
+    CHECK_ZERO_TEXT(ret, "sht3x_measure_blocking_read");
+    ret = Sht3xLpm::measure_blocking_read(&temperature, &humidity);
+    CHECK_ZERO_TEXT(ret, "Sht3xLpm::measure_blocking_read");
+    CHECK_EQUAL_TEXT(c_temperature, temperature, "Sht3xLpm temperature");
+    CHECK_EQUAL_TEXT(c_humidity, humidity, "Sht3xLpm humidity");
+    ret = Sht3xCs::measure_blocking_read(&temperature, &humidity);
+    CHECK_ZERO_TEXT(ret, "Sht3xCs::measure_blocking_read");
+    CHECK_EQUAL_TEXT(c_temperature, temperature, "Sht3xCs temperature");
+
+    ret = sht3x_read_serial(SHT3X_I2C_ADDR_DFLT, &c_serial);
+    CHECK_ZERO_TEXT(ret, "sht3x_read_serial");
+    ret = Sht3xLpm::read_serial(&serial);
+    CHECK_ZERO_TEXT(ret, "Sht3xLpm::read_serial");
+    CHECK_EQUAL_TEXT(c_serial, serial, "Sht3xLpm::read_serial");
+}
+
+static void sht3x_set_event_limits(sht3x_alert_limit_t* limits,
+                                   int32_t high_temperature,
+                                   int32_t low_temperature) {
+    /* the humidity limits can never be crossed */
+    limits[SHT3X_HIALRT_SET].humidity = 100000;
+    limits[SHT3X_HIALRT_SET].temperature = high_temperature;
+    limits[SHT3X_HIALRT_CLR].humidity = 99000;
+    limits[SHT3X_HIALRT_CLR].temperature = high_temperature - 1000;
+    limits[SHT3X_LOALRT_CLR].humidity = 1000;
+    limits[SHT3X_LOALRT_CLR].temperature = low_temperature + 1000;
+    limits[SHT3X_LOALRT_SET].humidity = 0;
+    limits[SHT3X_LOALRT_SET].temperature = low_temperature;
+}
+
+static void sht3x_test_event_mode(sht3x_event_source_t source) {
+    sht3x_alert_limit_t limits[4];
+    int32_t temperature, humidity;
+    uint16_t status;
+    int16_t ret;
+
+    ret = sht3x_poll_event(SHT3X_I2C_ADDR_DFLT, &status, &temperature,
+                           &humidity);
+    CHECK_EQUAL_TEXT(STATUS_ERR_NOT_STARTED, ret, "sht3x_poll_event");
+
+    ret = sht3x_measure_blocking_read(SHT3X_I2C_ADDR_DFLT, &temperature,
+                                      &humidity);
+    CHECK_ZERO_TEXT(ret, "sht3x_measure_blocking_read");
+
+    /* no alert while the temperature stays between the limits */
+    sht3x_set_event_limits(limits, temperature + 10000, temperature - 10000);
+    ret = sht3x_start_event_mode(SHT3X_I2C_ADDR_DFLT, limits,
+                                 SHT3X_PERIODIC_MPS_10, SHT3X_MEAS_MODE_HPM,
+                                 source);
+    CHECK_ZERO_TEXT(ret, "sht3x_start_event_mode");
+    sensirion_sleep_usec(300000);
+    sht3x_signal_alert(SHT3X_I2C_ADDR_DFLT);
+    ret = sht3x_poll_event(SHT3X_I2C_ADDR_DFLT, &status, &temperature,
+                           &humidity);
+    CHECK_EQUAL_TEXT(STATUS_NOT_READY, ret, "sht3x_poll_event steady state");
+
+    /* the high limit below the temperature raises an alert */
+    sht3x_set_event_limits(limits, temperature - 10000, temperature - 20000);
+    ret = sht3x_start_event_mode(SHT3X_I2C_ADDR_DFLT, limits,
+                                 SHT3X_PERIODIC_MPS_10, SHT3X_MEAS_MODE_HPM,
+                                 source);
+    CHECK_ZERO_TEXT(ret, "sht3x_start_event_mode");
+    sensirion_sleep_usec(300000);
+    if (source == SHT3X_EVENT_ALERT_PIN) {
+        ret = sht3x_poll_event(SHT3X_I2C_ADDR_DFLT, &status, &temperature,
+                               &humidity);
+        CHECK_EQUAL_TEXT(STATUS_NOT_READY, ret, "sht3x_poll_event no edge");
+        sht3x_signal_alert(SHT3X_I2C_ADDR_DFLT);
+    }
+    ret = sht3x_poll_event(SHT3X_I2C_ADDR_DFLT, &status, &temperature,
+                           &humidity);
+    CHECK_ZERO_TEXT(ret, "sht3x_poll_event alert");
+    CHECK_TRUE_TEXT(SHT3X_IS_ALRT_PENDING(status), "SHT3X_IS_ALRT_PENDING");
+    CHECK_TRUE_TEXT(SHT3X_IS_ALRT_T_TRACK(status), "SHT3X_IS_ALRT_T_TRACK");
+    CHECK_FALSE_TEXT(SHT3X_IS_ALRT_RH_TRACK(status), "SHT3X_IS_ALRT_RH_TRACK");
+    CHECK_TRUE_TEXT(temperature >= -45000 && temperature <= 130000,
+                    "sht3x_poll_event temperature");
+    CHECK_TRUE_TEXT(humidity >= 0 && humidity <= 100000,
+                    "sht3x_poll_event humidity");
+
+    /* the alert was cleared with the status */
+    sensirion_sleep_usec(300000);
+    sht3x_signal_alert(SHT3X_I2C_ADDR_DFLT);
+    ret = sht3x_poll_event(SHT3X_I2C_ADDR_DFLT, &status, &temperature,
+                           &humidity);
+    CHECK_EQUAL_TEXT(STATUS_NOT_READY, ret, "sht3x_poll_event after clear");
+    CHECK_TRUE_TEXT(SHT3X_IS_ALRT_T_TRACK(status), "SHT3X_IS_ALRT_T_TRACK");
+
+    ret = sht3x_stop_event_mode(SHT3X_I2C_ADDR_DFLT);
+    CHECK_ZERO_TEXT(ret, "sht3x_stop_event_mode");
+    ret = sht3x_poll_event(SHT3X_I2C_ADDR_DFLT, &status, &temperature,
+                           &humidity);
+    CHECK_EQUAL_TEXT(STATUS_ERR_NOT_STARTED, ret, "sht3x_poll_event");
+}
+
+static void sht3x_test_reset_recovery() {
+    int32_t temperature, humidity;
+    uint16_t status;
+    int16_t ret;
+
+    ret = sht3x_set_alert_thd(SHT3X_I2C_ADDR_DFLT, SHT3X_HIALRT_SET, 70000,
+                              45000);
+    CHECK_ZERO_TEXT(ret, "sht3x_set_alert_thd");
+    ret = sht3x_start_periodic(SHT3X_I2C_ADDR_DFLT, SHT3X_PERIODIC_MPS_10,
+                               SHT3X_MEAS_MODE_HPM);
+    CHECK_ZERO_TEXT(ret, "sht3x_start_periodic");
+
+    /* the sensor loses its configuration, e.g. on a brown-out */
+    ret = sensirion_i2c_general_call_reset();
+    CHECK_ZERO_TEXT(ret, "sensirion_i2c_general_call_reset");
+    sensirion_sleep_usec(1000);
+
+    ret = sht3x_check_reset(SHT3X_I2C_ADDR_DFLT, &status);
+    CHECK_ZERO_TEXT(ret, "sht3x_check_reset");
+    CHECK_TRUE_TEXT(SHT3X_IS_SYSTEM_RST_DETECT(status),
+                    "SHT3X_IS_SYSTEM_RST_DETECT");
+
+    ret = sht3x_get_alert_thd(SHT3X_I2C_ADDR_DFLT, SHT3X_HIALRT_SET, &humidity,
+                              &temperature);
+    CHECK_ZERO_TEXT(ret, "sht3x_get_alert_thd");
+    CHECK_TRUE_TEXT(temperature > 44000 && temperature < 46000,
+                    "restored temperature limit");
+    CHECK_TRUE_TEXT(humidity > 69000 && humidity < 71000,
+                    "restored humidity limit");
+
+    sensirion_sleep_usec(200000);
+    ret = sht3x_fetch_periodic(SHT3X_I2C_ADDR_DFLT, &temperature, &humidity);
+    CHECK_ZERO_TEXT(ret, "sht3x_fetch_periodic after reset");
+
+    ret = sht3x_check_reset(SHT3X_I2C_ADDR_DFLT, &status);
+    CHECK_ZERO_TEXT(ret, "sht3x_check_reset");
+    CHECK_FALSE_TEXT(SHT3X_IS_SYSTEM_RST_DETECT(status),
+                     "SHT3X_IS_SYSTEM_RST_DETECT after re-provisioning");
+
+    ret = sht3x_stop_periodic(SHT3X_I2C_ADDR_DFLT);
+    CHECK_ZERO_TEXT(ret, "sht3x_stop_periodic");
+}
+
+static void sht3x_test_reset_recovery_art() {
+    int32_t temperature, humidity;
+    uint16_t status;
+    sht3x_dev_t art;
+    int16_t ret;
+
+    /* ART mode started by the first measurement */
+    sht3x_dev_init(&art, SHT3X_I2C_ADDR_DFLT, SHT_BUS_DEFAULT);
+    sht3x_dev_set_power_mode(&art, SHT3X_MEAS_MODE_ART);
+    ret = sht3x_dev_measure_blocking_read(&art, &temperature, &humidity);
+    CHECK_ZERO_TEXT(ret, "sht3x_dev_measure_blocking_read in ART mode");
+
+    ret = sensirion_i2c_general_call_reset();
+    CHECK_ZERO_TEXT(ret, "sensirion_i2c_general_call_reset");
+    sensirion_sleep_usec(1000);
+
+    ret = sht3x_dev_check_reset(&art, &status);
+    CHECK_ZERO_TEXT(ret, "sht3x_dev_check_reset");
+    CHECK_TRUE_TEXT(SHT3X_IS_SYSTEM_RST_DETECT(status),
+                    "SHT3X_IS_SYSTEM_RST_DETECT");
+
+    sensirion_sleep_usec(SHT3X_ART_PERIOD_USEC);
+    ret = sht3x_dev_fetch_periodic(&art, &temperature, &humidity);
+    CHECK_ZERO_TEXT(ret, "sht3x_dev_fetch_periodic after reset");
+    ret = sht3x_dev_stop_periodic(&art);
+    CHECK_ZERO_TEXT(ret, "sht3x_dev_stop_periodic");
+}
+
+/* constant limit table in the order of sht3x_alert_thd_t */
+static const uint16_t test_alert_words[] = {
+    SHT3X_ALERT_LIMIT_WORD(90000, 70000),
+    SHT3X_ALERT_LIMIT_WORD(88000, 68000),
+    SHT3X_ALERT_LIMIT_WORD(12000, -18000),
+    SHT3X_ALERT_LIMIT_WORD(10000, -20000),
+};
+
+static void sht3x_test_alert_words() {
+    int32_t temperature, humidity;
+    int16_t ret;
+
+    CHECK_EQUAL_TEXT(test_alert_words[SHT3X_HIALRT_SET],
+                     sht3x_alert_limit_word(90000, 70000),
+                     "sht3x_alert_limit_word");
+    CHECK_EQUAL_TEXT(test_alert_words[SHT3X_LOALRT_SET],
+                     sht3x_alert_limit_word(10000, -20000),
+                     "sht3x_alert_limit_word");
+
+    ret = sht3x_set_alert_words(SHT3X_I2C_ADDR_DFLT, test_alert_words,
+                                SHT3X_VERIFY_READ_BACK);
+    CHECK_ZERO_TEXT(ret, "sht3x_set_alert_words read back");
+    ret = sht3x_set_alert_words(SHT3X_I2C_ADDR_DFLT, test_alert_words,
+                                SHT3X_VERIFY_STATUS);
+    CHECK_ZERO_TEXT(ret, "sht3x_set_alert_words status");
+
+    ret = sht3x_get_alert_thd(SHT3X_I2C_ADDR_DFLT, SHT3X_LOALRT_SET, &humidity,
+                              &temperature);
+    CHECK_ZERO_TEXT(ret, "sht3x_get_alert_thd");
+    CHECK_TRUE_TEXT(temperature > -21000 && temperature < -19000,
+                    "written temperature limit");
+    CHECK_TRUE_TEXT(humidity > 9000 && humidity < 11000,
+                    "written humidity limit");
+
+#ifdef SENSIRION_TEST_SIM_I2C
+    /* the sensor drops the first write, later writes clear the CRC flag */
+    uint16_t words[SHT3X_LOALRT_SET + 1];
+    for (uint8_t i = 0; i <= SHT3X_LOALRT_SET; ++i)
+        words[i] = test_alert_words[i];
+    words[SHT3X_HIALRT_SET] = SHT3X_ALERT_LIMIT_WORD(92000, 72000);
+    sensirion_sim_corrupt_write(1);
+    ret = sht3x_set_alert_words(SHT3X_I2C_ADDR_DFLT, words,
+                                SHT3X_VERIFY_STATUS);
+    CHECK_EQUAL_TEXT(STATUS_ERR_BAD_DATA, ret,
+                     "sht3x_set_alert_words corrupted first write");
+#endif /* SENSIRION_TEST_SIM_I2C */
+
+    ret = sht3x_start_periodic(SHT3X_I2C_ADDR_DFLT, SHT3X_PERIODIC_MPS_1,
+                               SHT3X_MEAS_MODE_HPM);
+    CHECK_ZERO_TEXT(ret, "sht3x_start_periodic");
+    ret = sht3x_set_alert_words(SHT3X_I2C_ADDR_DFLT, test_alert_words,
+                                SHT3X_VERIFY_NONE);
+    CHECK_EQUAL_TEXT(STATUS_ERR_PERIODIC_MODE, ret,
+                     "sht3x_set_alert_words in periodic mode");
+    ret = sht3x_stop_periodic(SHT3X_I2C_ADDR_DFLT);
+    CHECK_ZERO_TEXT(ret, "sht3x_stop_periodic");
 }
 
 static void test_teardown() {
@@ -66,3 +461,31 @@ TEST_GROUP (SHT31_Tests) {
 };
 
 TEST (SHT31_Tests, SHT31Test) { sht3x_test_all_power_modes(); }
+
+TEST (SHT31_Tests, SHT31TestPeriodic) { sht3x_test_periodic(); }
+
+TEST (SHT31_Tests, SHT31TestART) { sht3x_test_art(); }
+
+TEST (SHT31_Tests, SHT31TestNackPolling) { sht3x_test_nack_polling(); }
+
+TEST (SHT31_Tests, SHT31TestDevContexts) { sht3x_test_dev_contexts(); }
+
+TEST (SHT31_Tests, SHT31TestRaw) { sht3x_test_raw(); }
+
+TEST (SHT31_Tests, SHT31TestTemplate) { sht3x_test_template(); }
+
+TEST (SHT31_Tests, SHT31TestEventStatus) {
+    sht3x_test_event_mode(SHT3X_EVENT_STATUS);
+}
+
+TEST (SHT31_Tests, SHT31TestEventAlertPin) {
+    sht3x_test_event_mode(SHT3X_EVENT_ALERT_PIN);
+}
+
+TEST (SHT31_Tests, SHT31TestResetRecovery) { sht3x_test_reset_recovery(); }
+
+TEST (SHT31_Tests, SHT31TestResetRecoveryArt) {
+    sht3x_test_reset_recovery_art();
+}
+
+TEST (SHT31_Tests, SHT31TestAlertWords) { sht3x_test_alert_words(); }
@@ -1,6 +1,8 @@
 #include "sensirion_common.h"
 #include "sensirion_test_setup.h"
 #include "sht4x.h"
+#include "sht4x.hpp"
+#include "sht_threshold.h"
 
 static void sht4x_run_test() {
     int16_t ret;
@@ -18,7 +20,7 @@ static void sht4x_run_test() {
     ret = sht4x_measure();
     CHECK_ZERO_TEXT(ret, "sht4x_measure");
 
-    sensirion_sleep_usec(SHT4X_MEASUREMENT_DURATION_USEC);
+    sensirion_sleep_usec(sht4x_get_measurement_duration_usec());
 
     ret = sht4x_read(&temperature, &humidity);
     CHECK_ZERO_TEXT(ret, "sht4x_read");
@@ -44,9 +46,269 @@ static void sht4x_test_all_power_modes() {
     printf("Running tests in normal mode...\n");
     sht4x_run_test();
 
+    printf("Running tests in medium power mode...\n");
+    sht4x_set_power_mode(SHT4X_MEAS_MODE_MPM);
+    sht4x_run_test();
+
     printf("Running tests in low power mode...\n");
     sht4x_enable_low_power_mode(1);
     sht4x_run_test();
+
+    sht4x_enable_low_power_mode(0);
+}
+
+static void sht4x_test_nack_polling() {
+    int32_t temperature, humidity;
+    uint32_t max_duration = sht4x_get_measurement_duration_usec();
+
+    sht4x_set_nack_polling(500, max_duration);
+    int16_t ret = sht4x_measure_blocking_read(&temperature, &humidity);
+    CHECK_ZERO_TEXT(ret, "sht4x_measure_blocking_read with NACK polling");
+    uint32_t duration = sht4x_get_polled_duration_usec();
+    printf("SHT4X polled measurement duration: %u us\n", duration);
+    CHECK_TRUE_TEXT(duration <= max_duration, "sht4x polled duration");
+    sht4x_set_nack_polling(0, 0);
+}
+
+static void sht4x_test_non_blocking() {
+    int32_t temperature, humidity;
+    uint32_t duration = sht4x_get_measurement_duration_usec();
+    uint32_t now = 0xFFFFF000U; /* the caller's clock may wrap around */
+
+    int16_t ret = sht4x_start_measurement(now);
+    CHECK_ZERO_TEXT(ret, "sht4x_start_measurement");
+    ret = sht4x_poll_measurement(now, &temperature, &humidity);
+    CHECK_EQUAL_TEXT(STATUS_NOT_READY, ret, "sht4x_poll_measurement early");
+
+    sensirion_sleep_usec(duration);
+    now += duration;
+    ret = sht4x_poll_measurement(now, &temperature, &humidity);
+    CHECK_ZERO_TEXT(ret, "sht4x_poll_measurement");
+    CHECK_TRUE_TEXT(temperature >= 5000 && temperature <= 45000,
+                    "sht4x_poll_measurement temperature");
+    ret = sht4x_poll_measurement(now, &temperature, &humidity);
+    CHECK_EQUAL_TEXT(STATUS_ERR_NOT_STARTED, ret,
+                     "sht4x_poll_measurement without start");
+}
+
+static void sht4x_test_raw() {
+    uint16_t t_ticks, rh_ticks;
+    int32_t temperature, humidity, raw_temperature, raw_humidity;
+
+    int16_t ret = sht4x_measure_blocking_read_raw(&t_ticks, &rh_ticks);
+    CHECK_ZERO_TEXT(ret, "sht4x_measure_blocking_read_raw");
+    sht4x_tick_to_temperature(t_ticks, &raw_temperature);
+    sht4x_tick_to_humidity(rh_ticks, &raw_humidity);
+
+    ret = sht4x_measure_blocking_read(&temperature, &humidity);
+    CHECK_ZERO_TEXT(ret, "sht4x_measure_blocking_read");
+    CHECK_EQUAL_TEXT(temperature, raw_temperature, "raw temperature");
+    CHECK_EQUAL_TEXT(humidity, raw_humidity, "raw humidity");
+
+    ret = sht4x_measure();
+    CHECK_ZERO_TEXT(ret, "sht4x_measure");
+    sensirion_sleep_usec(sht4x_get_measurement_duration_usec());
+    ret = sht4x_read_raw(&t_ticks, &rh_ticks);
+    CHECK_ZERO_TEXT(ret, "sht4x_read_raw");
+    sht4x_tick_to_temperature(t_ticks, &raw_temperature);
+    CHECK_EQUAL_TEXT(temperature, raw_temperature, "sht4x_read_raw");
+}
+
+static void sht4x_test_to_tick() {
+    uint32_t tick;
+    uint16_t t_tick = 0, rh_tick = 0;
+    int32_t temperature, humidity;
+
+    for (tick = 0; tick <= 0xFFFF; ++tick) {
+        sht4x_tick_to_temperature((uint16_t)tick, &temperature);
+        sht4x_tick_to_humidity((uint16_t)tick, &humidity);
+        sht4x_temperature_to_tick(temperature, &t_tick);
+        sht4x_humidity_to_tick(humidity, &rh_tick);
+        CHECK_EQUAL(tick, t_tick);
+        CHECK_EQUAL(tick, rh_tick);
+        /* a value between two ticks maps to the upper one */
+        sht4x_temperature_to_tick(temperature + 1, &t_tick);
+        CHECK_EQUAL(tick == 0xFFFF ? 0xFFFF : tick + 1, t_tick);
+    }
+    sht4x_temperature_to_tick(-100000, &t_tick);
+    CHECK_EQUAL(0, t_tick);
+    sht4x_humidity_to_tick(200000, &rh_tick);
+    CHECK_EQUAL(0xFFFF, rh_tick);
+}
+
+/* reference classification of one channel in milli units */
+static uint8_t threshold_reference(const sht_threshold_limits_t* limits,
+                                   uint8_t state, int32_t value, uint8_t low,
+                                   uint8_t high) {
+    if ((state & low) && value > limits->low + limits->hysteresis)
+        state &= (uint8_t)~low;
+    else if (!(state & low) && value < limits->low)
+        state |= low;
+    if ((state & high) && value < limits->high - limits->hysteresis)
+        state &= (uint8_t)~high;
+    else if (!(state & high) && value > limits->high)
+        state |= high;
+    return state;
+}
+
+static void sht4x_test_threshold() {
+    const sht_threshold_limits_t t_limits = {-10000, 60000, 2000};
+    const sht_threshold_limits_t rh_limits = {SHT_THRESHOLD_OFF_LOW, 80000,
+                                              500};
+    sht_threshold_t thd;
+    uint8_t expected = 0, state;
+    int32_t temperature, humidity;
+    uint32_t step;
+
+    sht_threshold_compile(&thd, SHT_THRESHOLD_SHT4X, &t_limits, &rh_limits);
+
+    /* sweep both channels up and down through all limits */
+    for (step = 0; step < 4 * 0x10000; step += 3) {
+        uint32_t up = step % 0x20000;
+        uint16_t t_tick = (uint16_t)(up < 0x10000 ? up : 0x1FFFF - up);
+        uint16_t rh_tick = (uint16_t)(0xFFFF - t_tick);
+
+        sht4x_tick_to_temperature(t_tick, &temperature);
+        sht4x_tick_to_humidity(rh_tick, &humidity);
+        expected = threshold_reference(&t_limits, expected, temperature,
+                                       SHT_THRESHOLD_T_LOW,
+                                       SHT_THRESHOLD_T_HIGH);
+        expected = threshold_reference(&rh_limits, expected, humidity,
+                                       SHT_THRESHOLD_RH_LOW,
+                                       SHT_THRESHOLD_RH_HIGH);
+        state = sht_threshold_classify(&thd, t_tick, rh_tick);
+        CHECK_EQUAL(expected, state);
+    }
+
+    /* a measured sample in the simulated 25 degC, 50 %RH is in range */
+    uint16_t ticks[4] = {0, 0, 0, 0};
+    uint8_t states[2] = {0xFF, 0xFF};
+    int16_t ret = sht4x_measure_blocking_read_raw(&ticks[0], &ticks[1]);
+    CHECK_ZERO_TEXT(ret, "sht4x_measure_blocking_read_raw");
+    ticks[2] = 0xFFFF; /* 130 degC */
+    ticks[3] = ticks[1];
+    sht_threshold_compile(&thd, SHT_THRESHOLD_SHT4X, &t_limits, &rh_limits);
+    CHECK_EQUAL(1U, sht_threshold_classify_batch(&thd, ticks, states, 2));
+    CHECK_EQUAL(0, states[0]);
+    CHECK_EQUAL(SHT_THRESHOLD_T_HIGH, states[1]);
+}
+
+static uint32_t alert_calls;
+static uint8_t alert_changed;
+
+static void alert_callback(void* user_data, uint8_t state, uint8_t changed) {
+    (void)state;
+    *(uint32_t*)user_data += 1;
+    alert_changed = changed;
+}
+
+static void sht4x_test_alert() {
+    sht_alert_t alert;
+    int32_t temperature = 0, humidity = 0;
+    int16_t ret;
+
+    sht_alert_init(&alert, SHT_THRESHOLD_SHT4X);
+    ret = sht_alert_get_thd(&alert, SHT_ALERT_HIALRT_SET, &humidity,
+                            &temperature);
+    CHECK_ZERO_TEXT(ret, "sht_alert_get_thd");
+    CHECK_EQUAL_TEXT(60000, temperature, "default HIALRT_SET temperature");
+    CHECK_EQUAL_TEXT(80000, humidity, "default HIALRT_SET humidity");
+    ret = sht_alert_set_thd(&alert, (sht_alert_thd_t)4, 0, 0);
+    CHECK_EQUAL_TEXT(STATUS_ERR_INVALID_PARAMS, ret, "invalid alert limit");
+
+    alert_calls = 0;
+    sht_alert_set_callback(&alert, alert_callback, &alert_calls);
+    sht4x_set_alert(&alert);
+
+    /* in range: no transition */
+    ret = sht4x_measure_blocking_read(&temperature, &humidity);
+    CHECK_ZERO_TEXT(ret, "sht4x_measure_blocking_read");
+    CHECK_EQUAL_TEXT(0, sht_alert_get_state(&alert), "alert state in range");
+    CHECK_EQUAL_TEXT(0U, alert_calls, "alert callback in range");
+
+    /* the high limit below the room temperature raises the alert once */
+    ret = sht_alert_set_thd(&alert, SHT_ALERT_HIALRT_CLR, 100000,
+                            temperature - 6000);
+    CHECK_ZERO_TEXT(ret, "sht_alert_set_thd HIALRT_CLR");
+    ret = sht_alert_set_thd(&alert, SHT_ALERT_HIALRT_SET, 100000,
+                            temperature - 5000);
+    CHECK_ZERO_TEXT(ret, "sht_alert_set_thd HIALRT_SET");
+    ret = sht4x_measure_blocking_read(&temperature, &humidity);
+    CHECK_ZERO_TEXT(ret, "sht4x_measure_blocking_read");
+    CHECK_EQUAL_TEXT(SHT_THRESHOLD_T_HIGH, sht_alert_get_state(&alert),
+                     "alert state above HIALRT_SET");
+    CHECK_EQUAL_TEXT(1U, alert_calls, "alert callback on the rising edge");
+    CHECK_EQUAL_TEXT(SHT_THRESHOLD_T_HIGH, alert_changed, "changed flags");
+    ret = sht4x_measure_blocking_read(&temperature, &humidity);
+    CHECK_ZERO_TEXT(ret, "sht4x_measure_blocking_read");
+    CHECK_EQUAL_TEXT(1U, alert_calls, "no alert callback without a change");
+
+    /* between the set and clear limits the alert stays raised */
+    ret = sht_alert_set_thd(&alert, SHT_ALERT_HIALRT_SET, 100000,
+                            temperature + 5000);
+    CHECK_ZERO_TEXT(ret, "sht_alert_set_thd HIALRT_SET");
+    ret = sht4x_measure_blocking_read(&temperature, &humidity);
+    CHECK_ZERO_TEXT(ret, "sht4x_measure_blocking_read");
+    CHECK_EQUAL_TEXT(SHT_THRESHOLD_T_HIGH, sht_alert_get_state(&alert),
+                     "alert state above HIALRT_CLR");
+
+    /* below the clear limit it drops */
+    ret = sht_alert_set_thd(&alert, SHT_ALERT_HIALRT_CLR, 100000,
+                            temperature + 4000);
+    CHECK_ZERO_TEXT(ret, "sht_alert_set_thd HIALRT_CLR");
+    ret = sht4x_measure_blocking_read(&temperature, &humidity);
+    CHECK_ZERO_TEXT(ret, "sht4x_measure_blocking_read");
+    CHECK_EQUAL_TEXT(0, sht_alert_get_state(&alert), "alert cleared");
+    CHECK_EQUAL_TEXT(2U, alert_calls, "alert callback on the falling edge");
+    CHECK_EQUAL_TEXT(SHT_THRESHOLD_T_HIGH, sht_alert_take_events(&alert),
+                     "sht_alert_take_events");
+    CHECK_EQUAL_TEXT(0, sht_alert_take_events(&alert),
+                     "sht_alert_take_events after taking them");
+
+    sht4x_set_alert(NULL);
+}
+
+typedef sht::Sht4x<SHT4X_MEAS_MODE_MPM> Sht4xMpm;
+
+static_assert(sht::Sht4x<>::cmd_measure == 0xFD, "Sht4x HPM command");
+static_assert(Sht4xMpm::cmd_measure == 0xF6, "Sht4x MPM command");
+static_assert(Sht4xMpm::measurement_duration_usec ==
+                  SHT4X_MEASUREMENT_DURATION_MPM_USEC,
+              "Sht4x MPM duration");
+static_assert(Sht4xMpm::tick_to_humidity(0) == -6000, "Sht4x RH(0)");
+static_assert(Sht4xMpm::humidity_to_tick(-6000) == 0, "Sht4x tick(RH(0))");
+static_assert(Sht4xMpm::temperature_to_tick(INT32_MAX) == 0xFFFF,
+              "Sht4x tick saturation");
+
+static void sht4x_test_template() {
+    int32_t temperature = 0, humidity = 0, c_temperature, c_humidity;
+    uint32_t serial = 0, c_serial;
+    uint32_t tick;
+    uint16_t c_tick;
+
+    for (tick = 0; tick <= 0xFFFF; ++tick) {
+        sht4x_tick_to_temperature((uint16_t)tick, &c_temperature);
+        sht4x_tick_to_humidity((uint16_t)tick, &c_humidity);
+        CHECK_EQUAL(c_temperature, Sht4xMpm::tick_to_temperature(tick));
+        CHECK_EQUAL(c_humidity, Sht4xMpm::tick_to_humidity(tick));
+        sht4x_temperature_to_tick(c_temperature + 1, &c_tick);
+        CHECK_EQUAL(c_tick, Sht4xMpm::temperature_to_tick(c_temperature + 1));
+        sht4x_humidity_to_tick(c_humidity + 1, &c_tick);
+        CHECK_EQUAL(c_tick, Sht4xMpm::humidity_to_tick(c_humidity + 1));
+    }
+
+    int16_t ret = sht4x_measure_blocking_read(&c_temperature, &c_humidity);
+    CHECK_ZERO_TEXT(ret, "sht4x_measure_blocking_read");
+    ret = Sht4xMpm::measure_blocking_read(&temperature, &humidity);
+    CHECK_ZERO_TEXT(ret, "Sht4xMpm::measure_blocking_read");
+    CHECK_EQUAL_TEXT(c_temperature, temperature, "Sht4xMpm temperature");
+    CHECK_EQUAL_TEXT(c_humidity, humidity, "Sht4xMpm humidity");
+
+    ret = sht4x_read_serial(&c_serial);
+    CHECK_ZERO_TEXT(ret, "sht4x_read_serial");
+    ret = Sht4xMpm::read_serial(&serial);
+    CHECK_ZERO_TEXT(ret, "Sht4xMpm::read_serial");
+    CHECK_EQUAL_TEXT(c_serial, serial, "Sht4xMpm::read_serial");
 }
 
 static void test_teardown() {
@@ -68,3 +330,17 @@ TEST_GROUP (SHT4X_Tests) {
 };
 
 TEST (SHT4X_Tests, SHT4XTest) { sht4x_test_all_power_modes(); }
+
+TEST (SHT4X_Tests, SHT4XTestNackPolling) { sht4x_test_nack_polling(); }
+
+TEST (SHT4X_Tests, SHT4XTestNonBlocking) { sht4x_test_non_blocking(); }
+
+TEST (SHT4X_Tests, SHT4XTestRaw) { sht4x_test_raw(); }
+
+TEST (SHT4X_Tests, SHT4XTestTemplate) { sht4x_test_template(); }
+
+TEST (SHT4X_Tests, SHT4XTestToTick) { sht4x_test_to_tick(); }
+
+TEST (SHT4X_Tests, SHT4XTestThreshold) { sht4x_test_threshold(); }
+
+TEST (SHT4X_Tests, SHT4XTestAlert) { sht4x_test_alert(); }
@@ -1,6 +1,7 @@
 #include "sensirion_common.h"
 #include "sensirion_test_setup.h"
 #include "shtc1.h"
+#include "shtc1.hpp"
 
 static void shtc1_run_test() {
     int16_t ret;
@@ -18,7 +19,7 @@ static void shtc1_run_test() {
     ret = shtc1_measure();
     CHECK_ZERO_TEXT(ret, "shtc1_measure");
 
-    sensirion_sleep_usec(SHTC1_MEASUREMENT_DURATION_USEC);
+    sensirion_sleep_usec(shtc1_get_measurement_duration_usec());
 
     ret = shtc1_read(&temperature, &humidity);
     CHECK_ZERO_TEXT(ret, "shtc1_read");
@@ -73,6 +74,159 @@ static void shtc1_sleep_fail() {
     CHECK_TRUE_TEXT(ret, "shtc1_wake_up should fail, but didn't");
 }
 
+static void shtc1_test_nack_polling() {
+    int32_t temperature, humidity;
+    uint32_t max_duration = shtc1_get_measurement_duration_usec();
+
+    shtc1_set_nack_polling(500, max_duration);
+    int16_t ret = shtc1_measure_blocking_read(&temperature, &humidity);
+    CHECK_ZERO_TEXT(ret, "shtc1_measure_blocking_read with NACK polling");
+    uint32_t duration = shtc1_get_polled_duration_usec();
+    printf("SHTC1 polled measurement duration: %u us\n", duration);
+    CHECK_TRUE_TEXT(duration <= max_duration, "shtc1 polled duration");
+    shtc1_set_nack_polling(0, 0);
+}
+
+static void shtc1_test_non_blocking() {
+    int32_t temperature, humidity;
+    uint32_t duration = shtc1_get_measurement_duration_usec();
+    uint32_t now = 0xFFFFF000U; /* the caller's clock may wrap around */
+
+    int16_t ret = shtc1_start_measurement(now);
+    CHECK_ZERO_TEXT(ret, "shtc1_start_measurement");
+    ret = shtc1_poll_measurement(now, &temperature, &humidity);
+    CHECK_EQUAL_TEXT(STATUS_NOT_READY, ret, "shtc1_poll_measurement early");
+
+    sensirion_sleep_usec(duration);
+    now += duration;
+    ret = shtc1_poll_measurement(now, &temperature, &humidity);
+    CHECK_ZERO_TEXT(ret, "shtc1_poll_measurement");
+    CHECK_TRUE_TEXT(temperature >= 5000 && temperature <= 45000,
+                    "shtc1_poll_measurement temperature");
+    ret = shtc1_poll_measurement(now, &temperature, &humidity);
+    CHECK_EQUAL_TEXT(STATUS_ERR_NOT_STARTED, ret,
+                     "shtc1_poll_measurement without start");
+}
+
+static void shtc1_test_raw() {
+    uint16_t t_ticks, rh_ticks;
+    int32_t temperature, humidity, raw_temperature, raw_humidity;
+
+    int16_t ret = shtc1_measure_blocking_read_raw(&t_ticks, &rh_ticks);
+    CHECK_ZERO_TEXT(ret, "shtc1_measure_blocking_read_raw");
+    shtc1_tick_to_temperature(t_ticks, &raw_temperature);
+    shtc1_tick_to_humidity(rh_ticks, &raw_humidity);
+
+    ret = shtc1_measure_blocking_read(&temperature, &humidity);
+    CHECK_ZERO_TEXT(ret, "shtc1_measure_blocking_read");
+    CHECK_EQUAL_TEXT(temperature, raw_temperature, "raw temperature");
+    CHECK_EQUAL_TEXT(humidity, raw_humidity, "raw humidity");
+
+    ret = shtc1_measure();
+    CHECK_ZERO_TEXT(ret, "shtc1_measure");
+    sensirion_sleep_usec(shtc1_get_measurement_duration_usec());
+    ret = shtc1_read_raw(&t_ticks, &rh_ticks);
+    CHECK_ZERO_TEXT(ret, "shtc1_read_raw");
+    shtc1_tick_to_temperature(t_ticks, &raw_temperature);
+    CHECK_EQUAL_TEXT(temperature, raw_temperature, "shtc1_read_raw");
+}
+
+static void shtc1_test_to_tick() {
+    uint32_t tick;
+    uint16_t t_tick = 0, rh_tick = 0;
+    int32_t temperature, humidity;
+
+    for (tick = 0; tick <= 0xFFFF; ++tick) {
+        shtc1_tick_to_temperature((uint16_t)tick, &temperature);
+        shtc1_tick_to_humidity((uint16_t)tick, &humidity);
+        shtc1_temperature_to_tick(temperature, &t_tick);
+        shtc1_humidity_to_tick(humidity, &rh_tick);
+        CHECK_EQUAL(tick, t_tick);
+        CHECK_EQUAL(tick, rh_tick);
+        shtc1_humidity_to_tick(humidity + 1, &rh_tick);
+        CHECK_EQUAL(tick == 0xFFFF ? 0xFFFF : tick + 1, rh_tick);
+    }
+    shtc1_humidity_to_tick(-1000, &rh_tick);
+    CHECK_EQUAL(0, rh_tick);
+}
+
+static void shtc1_test_alert() {
+    sht_alert_t alert;
+    int32_t temperature = 0, humidity = 0;
+    uint32_t now = 0;
+
+    sht_alert_init(&alert, SHT_THRESHOLD_SHTC1);
+    shtc1_set_alert(&alert);
+    int16_t ret = shtc1_measure_blocking_read(&temperature, &humidity);
+    CHECK_ZERO_TEXT(ret, "shtc1_measure_blocking_read");
+    CHECK_EQUAL_TEXT(0, sht_alert_take_events(&alert), "alert in range");
+
+    /* the low humidity limit above the room humidity, non-blocking read */
+    ret = sht_alert_set_thd(&alert, SHT_ALERT_LOALRT_SET, humidity + 5000,
+                            -10000);
+    CHECK_ZERO_TEXT(ret, "sht_alert_set_thd LOALRT_SET");
+    ret = sht_alert_set_thd(&alert, SHT_ALERT_LOALRT_CLR, humidity + 6000,
+                            -9000);
+    CHECK_ZERO_TEXT(ret, "sht_alert_set_thd LOALRT_CLR");
+    ret = shtc1_start_measurement(now);
+    CHECK_ZERO_TEXT(ret, "shtc1_start_measurement");
+    sensirion_sleep_usec(shtc1_get_measurement_duration_usec());
+    now += shtc1_get_measurement_duration_usec();
+    ret = shtc1_poll_measurement(now, &temperature, &humidity);
+    CHECK_ZERO_TEXT(ret, "shtc1_poll_measurement");
+    CHECK_EQUAL_TEXT(SHT_THRESHOLD_RH_LOW, sht_alert_get_state(&alert),
+                     "alert state below LOALRT_SET");
+    CHECK_EQUAL_TEXT(SHT_THRESHOLD_RH_LOW, sht_alert_take_events(&alert),
+                     "alert event below LOALRT_SET");
+    shtc1_set_alert(NULL);
+}
+
+typedef sht::Shtc1<> Shtc1Hpm;
+typedef sht::Shtc1<false, true> Shtc1Cs;
+
+static_assert(Shtc1Hpm::cmd_measure == 0x7866, "Shtc1 command");
+static_assert(Shtc1Cs::cmd_measure == 0x7CA2, "Shtc1 clock stretching");
+static_assert(sht::Shtc1<true>::measurement_duration_usec ==
+                  SHTC1_MEASUREMENT_DURATION_LPM_USEC,
+              "Shtc1 LPM duration");
+static_assert(Shtc1Hpm::humidity_to_tick(-1000) == 0, "Shtc1 tick(RH < 0)");
+static_assert(Shtc1Hpm::temperature_to_tick(INT32_MAX) == 0xFFFF,
+              "Shtc1 tick saturation");
+
+static void shtc1_test_template() {
+    int32_t temperature = 0, humidity = 0, c_temperature, c_humidity;
+    uint32_t serial = 0, c_serial;
+    uint32_t tick;
+    uint16_t c_tick;
+
+    for (tick = 0; tick <= 0xFFFF; ++tick) {
+        shtc1_tick_to_temperature((uint16_t)tick, &c_temperature);
+        shtc1_tick_to_humidity((uint16_t)tick, &c_humidity);
+        CHECK_EQUAL(c_temperature, Shtc1Hpm::tick_to_temperature(tick));
+        CHECK_EQUAL(c_humidity, Shtc1Hpm::tick_to_humidity(tick));
+        shtc1_temperature_to_tick(c_temperature + 1, &c_tick);
+        CHECK_EQUAL(c_tick, Shtc1Hpm::temperature_to_tick(c_temperature + 1));
+        shtc1_humidity_to_tick(c_humidity + 1, &c_tick);
+        CHECK_EQUAL(c_tick, Shtc1Hpm::humidity_to_tick(c_humidity + 1));
+    }
+
+    int16_t ret = shtc1_measure_blocking_read(&c_temperature, &c_humidity);
+    CHECK_ZERO_TEXT(ret, "shtc1_measure_blocking_read");
+    ret = Shtc1Hpm::measure_blocking_read(&temperature, &humidity);
+    CHECK_ZERO_TEXT(ret, "Shtc1Hpm::measure_blocking_read");
+    CHECK_EQUAL_TEXT(c_temperature, temperature, "Shtc1Hpm temperature");
+    CHECK_EQUAL_TEXT(c_humidity, humidity, "Shtc1Hpm humidity");
+    ret = Shtc1Cs::measure_blocking_read(&temperature, &humidity);
+    CHECK_ZERO_TEXT(ret, "Shtc1Cs::measure_blocking_read");
+    CHECK_EQUAL_TEXT(c_temperature, temperature, "Shtc1Cs temperature");
+
+    ret = shtc1_read_serial(&c_serial);
+    CHECK_ZERO_TEXT(ret, "shtc1_read_serial");
+    ret = Shtc1Hpm::read_serial(&serial);
+    CHECK_ZERO_TEXT(ret, "Shtc1Hpm::read_serial");
+    CHECK_EQUAL_TEXT(c_serial, serial, "Shtc1Hpm::read_serial");
+}
+
 static void test_teardown() {
     int16_t ret = sensirion_i2c_general_call_reset();
     CHECK_ZERO_TEXT(ret, "sensirion_i2c_general_call_reset");
@@ -117,6 +271,18 @@ TEST_GROUP (SHTW2_Tests) {
 
 TEST (SHTC1_Tests, SHTC1Test) { shtc1_test_all_power_modes(); }
 
+TEST (SHTC1_Tests, SHTC1TestNackPolling) { shtc1_test_nack_polling(); }
+
+TEST (SHTC1_Tests, SHTC1TestNonBlocking) { shtc1_test_non_blocking(); }
+
+TEST (SHTC1_Tests, SHTC1TestRaw) { shtc1_test_raw(); }
+
+TEST (SHTC1_Tests, SHTC1TestTemplate) { shtc1_test_template(); }
+
+TEST (SHTC1_Tests, SHTC1TestToTick) { shtc1_test_to_tick(); }
+
+TEST (SHTC1_Tests, SHTC1TestAlert) { shtc1_test_alert(); }
+
 TEST (SHTC1_Tests, SHTC1Test_sleep) {
     shtc1_sleep_fail();
     shtc1_test_all_power_modes();
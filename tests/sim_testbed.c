@@ -0,0 +1,28 @@
+#include "sensirion_sim_i2c.h"
+
+/* Simulated copy of the mux testbed the hardware tests run on. The tests use
+ * bus 0, the copies on buses 1 to 3 stand in for a multi-bus gateway. Bus 4
+ * has sensors on the root bus next to a multiplexer. */
+#define SIM_TESTBED_MUX_BUSES 4
+#define SIM_TESTBED_ROOT_BUS 4
+
+void sensirion_sim_board_init(void) {
+    uint8_t bus;
+
+    for (bus = 0; bus < SIM_TESTBED_MUX_BUSES; ++bus) {
+        sensirion_i2c_select_bus(bus);
+        sensirion_sim_add_mux(0x71);
+        sensirion_sim_add_mux(0x72);
+        sensirion_sim_add_sht3x(0x72, 1, 0x44);
+        sensirion_sim_add_sht4x(0x71, 7, 0x44);
+        sensirion_sim_add_shtc1(0x71, 6, SENSIRION_SIM_SHTC1);
+        sensirion_sim_add_shtc1(0x72, 0, SENSIRION_SIM_SHTC3);
+        sensirion_sim_add_shtc1(0x71, 0, SENSIRION_SIM_SHTW2);
+    }
+
+    sensirion_i2c_select_bus(SIM_TESTBED_ROOT_BUS);
+    sensirion_sim_add_mux(0x71);
+    sensirion_sim_add_sht3x(SENSIRION_SIM_ROOT, 0, 0x44);
+    sensirion_sim_add_shtc1(SENSIRION_SIM_ROOT, 0, SENSIRION_SIM_SHTC3);
+    sensirion_sim_add_sht4x(0x71, 2, 0x46);
+}
@@ -0,0 +1,190 @@
+#include <math.h>
+
+#include "sensirion_humidity_conversion.h"
+#include "sensirion_test_setup.h"
+#include "sensirion_tick_conversion.h"
+
+/* every tick value as temperature and humidity tick, plus an odd sample so the
+ * scalar tail of the SIMD paths is covered */
+#define NUM_TICK_SAMPLES 65537
+
+static uint16_t ticks[2 * NUM_TICK_SAMPLES];
+static int32_t milli[2 * NUM_TICK_SAMPLES];
+static int16_t centi[2 * NUM_TICK_SAMPLES];
+
+static int32_t floor_div10(int32_t value) {
+    return value >= 0 ? value / 10 : -((-value + 9) / 10);
+}
+
+static void check_ticks(int32_t rh_scale, int32_t rh_offset) {
+    for (uint32_t i = 0; i < NUM_TICK_SAMPLES; ++i) {
+        /* the fixed point conversions of the drivers */
+        int32_t t = ((21875 * (int32_t)ticks[2 * i]) >> 13) - 45000;
+        int32_t rh = ((rh_scale * (int32_t)ticks[2 * i + 1]) >> 13) + rh_offset;
+        CHECK_EQUAL_TEXT(t, milli[2 * i], "milli temperature");
+        CHECK_EQUAL_TEXT(rh, milli[2 * i + 1], "milli humidity");
+        CHECK_EQUAL_TEXT(floor_div10(t), centi[2 * i], "centi temperature");
+        CHECK_EQUAL_TEXT(floor_div10(rh), centi[2 * i + 1], "centi humidity");
+    }
+}
+
+/* the absolute humidity conversion with the table that ah_lut.py generated
+ * for the default range of -20..70 degC in 10 degC steps */
+static uint32_t legacy_absolute_humidity(int32_t temperature,
+                                         int32_t humidity) {
+    static const uint32_t lut[] = {1078,  2364,  4849,  9383,   17243,
+                                   30264, 50983, 82785, 130048, 198277};
+    uint32_t t, i, rem, ret;
+
+    if (humidity <= 0)
+        return 0;
+    t = temperature < -20000 ? 0 : (uint32_t)(temperature + 20000);
+    i = t / 10000;
+    rem = t % 10000;
+    if (i >= 9)
+        ret = lut[9];
+    else
+        ret = lut[i] + (lut[i + 1] - lut[i]) * rem / 10000;
+    return ((ret >> 3) * (uint32_t)humidity) / 12500;
+}
+
+TEST_GROUP (Utils_Tests) {
+    void setup() {
+        for (uint32_t i = 0; i < NUM_TICK_SAMPLES; ++i) {
+            ticks[2 * i] = (uint16_t)i;
+            ticks[2 * i + 1] = (uint16_t)(0xFFFF - i);
+        }
+    }
+
+    void teardown() {
+    }
+};
+
+TEST (Utils_Tests, TickConversionSHT3x) {
+    sensirion_sht3x_ticks_to_milli(ticks, milli, NUM_TICK_SAMPLES);
+    sensirion_sht3x_ticks_to_centi(ticks, centi, NUM_TICK_SAMPLES);
+    check_ticks(12500, 0);
+}
+
+TEST (Utils_Tests, TickConversionSHT4x) {
+    sensirion_sht4x_ticks_to_milli(ticks, milli, NUM_TICK_SAMPLES);
+    sensirion_sht4x_ticks_to_centi(ticks, centi, NUM_TICK_SAMPLES);
+    check_ticks(15625, -6000);
+}
+
+TEST (Utils_Tests, TickConversionSHTC1) {
+    sensirion_shtc1_ticks_to_milli(ticks, milli, NUM_TICK_SAMPLES);
+    sensirion_shtc1_ticks_to_centi(ticks, centi, NUM_TICK_SAMPLES);
+    check_ticks(12500, 0);
+}
+
+TEST (Utils_Tests, AbsoluteHumidityDefaultLut) {
+    CHECK_EQUAL(10, SENSIRION_AH_LUT_SIZE);
+    for (int32_t t = -30000; t <= 80000; t += 37) {
+        for (int32_t rh = -1000; rh <= 119000; rh += 2500) {
+            CHECK_EQUAL_TEXT(legacy_absolute_humidity(t, rh),
+                             sensirion_calc_absolute_humidity(t, rh),
+                             "sensirion_calc_absolute_humidity");
+        }
+    }
+}
+
+/* absolute humidity in mg/m^3 */
+static double magnus_ah(double t, double rh) {
+    return 216.7 * (rh / 100.0 * 6.112 * exp(17.62 * t / (243.12 + t))) /
+           (273.15 + t) * 1000.0;
+}
+
+TEST (Utils_Tests, AbsoluteHumidityFast) {
+    for (int32_t t = -40000; t <= 125000; t += 23) {
+        double bound = 0.002 * magnus_ah(t / 1000.0, 100.0) + 2.0;
+        for (int32_t rh = 0; rh <= 100000; rh += 1000) {
+            double err = fabs(sensirion_calc_absolute_humidity_fast(t, rh) -
+                              magnus_ah(t / 1000.0, rh / 1000.0));
+            CHECK_TRUE_TEXT(err <= bound, "absolute humidity error bound");
+        }
+    }
+}
+
+TEST (Utils_Tests, AbsoluteHumidityBatch) {
+    /* odd count for the scalar tail, samples outside of the table range */
+    const uint32_t count = 1001;
+    static int32_t values[2 * count];
+    static uint32_t ah[count];
+
+    for (uint32_t i = 0; i < count; ++i) {
+        values[2 * i] = -50000 + (int32_t)i * 187;
+        values[2 * i + 1] = -2000 + (int32_t)(i * 7919 % 123000);
+    }
+    sensirion_calc_absolute_humidity_batch(values, ah, count);
+    for (uint32_t i = 0; i < count; ++i) {
+        CHECK_EQUAL_TEXT(sensirion_calc_absolute_humidity_fast(
+                             values[2 * i], values[2 * i + 1]),
+                         ah[i], "sensirion_calc_absolute_humidity_batch");
+    }
+}
+
+/* saturation vapour pressure in Pa and its inverse in degree Celsius */
+static double magnus_es(double t, double b, double c) {
+    return 611.2 * exp(b * t / (c + t));
+}
+
+static double magnus_inverse(double es, double b, double c) {
+    double g = log(es / 611.2);
+    return c * g / (b - g);
+}
+
+TEST (Utils_Tests, DewPointFrostPointVpd) {
+    for (int32_t t = -40000; t <= 125000; t += 97) {
+        double es = magnus_es(t / 1000.0, 17.62, 243.12);
+        for (int32_t rh = 500; rh <= 100000; rh += 500) {
+            double e = es * rh / 100000.0;
+            double dp = magnus_inverse(e, 17.62, 243.12);
+            double fp = e >= 611.2 ? dp : magnus_inverse(e, 22.46, 272.62);
+            double vpd = es - e;
+
+            if (dp >= -40.0)
+                CHECK_TRUE_TEXT(
+                    fabs(sensirion_calc_dew_point(t, rh) / 1000.0 - dp) <=
+                        0.03,
+                    "sensirion_calc_dew_point");
+            if (fp >= -40.0)
+                CHECK_TRUE_TEXT(
+                    fabs(sensirion_calc_frost_point(t, rh) / 1000.0 - fp) <=
+                        0.03,
+                    "sensirion_calc_frost_point");
+            CHECK_TRUE_TEXT(
+                fabs(sensirion_calc_vapour_pressure_deficit(t, rh) - vpd) <=
+                    0.0005 * es + 1.0,
+                "sensirion_calc_vapour_pressure_deficit");
+        }
+    }
+
+    /* clamped below the table and no deficit above saturation */
+    CHECK_EQUAL(-40000, sensirion_calc_dew_point(25000, 0));
+    CHECK_EQUAL(-40000, sensirion_calc_frost_point(-40000, 1000));
+    CHECK_EQUAL(0U, sensirion_calc_vapour_pressure_deficit(25000, 100000));
+    CHECK_EQUAL(0U, sensirion_calc_vapour_pressure_deficit(25000, 110000));
+}
+
+TEST (Utils_Tests, DewPointBatch) {
+    const uint32_t count = 333;
+    static int32_t values[2 * count];
+    static int32_t dew_points[count], frost_points[count];
+    static uint32_t deficits[count];
+
+    for (uint32_t i = 0; i < count; ++i) {
+        values[2 * i] = -45000 + (int32_t)i * 523;
+        values[2 * i + 1] = (int32_t)(i * 7919 % 110000);
+    }
+    sensirion_calc_dew_point_batch(values, dew_points, count);
+    sensirion_calc_frost_point_batch(values, frost_points, count);
+    sensirion_calc_vapour_pressure_deficit_batch(values, deficits, count);
+    for (uint32_t i = 0; i < count; ++i) {
+        int32_t t = values[2 * i], rh = values[2 * i + 1];
+        CHECK_EQUAL(sensirion_calc_dew_point(t, rh), dew_points[i]);
+        CHECK_EQUAL(sensirion_calc_frost_point(t, rh), frost_points[i]);
+        CHECK_EQUAL(sensirion_calc_vapour_pressure_deficit(t, rh), deficits[i]);
+        CHECK_TRUE_TEXT(frost_points[i] >= dew_points[i], "frost point");
+    }
+}
@@ -34,11 +34,13 @@ POSSIBILITY OF SUCH DAMAGE.
 import math
 
 
-# Generate a look-up table for the interpolation of the relative humidity to
+# Model of the look-up table for the interpolation of the relative humidity to
 # absolute humidity conversion within a specifig temperature region (e.g. -20°C
 # to 70°C in steps of 10°C)
-# As part of the output, the mean error over each discrete (t, rh) point within
-# a region of interest is printed (See `quantify_ah_lut_error`)
+# The mean error over each discrete (t, rh) point within a region of interest
+# is printed (See `quantify_ah_lut_error`). The C table is generated at compile
+# time from the printed SENSIRION_AH_LUT_* settings, see
+# `make ah_lut_report` for the accuracy and speed of the C implementation.
 
 def calc_ah(t, rh):
     """ Mathematically correct AH computation """
@@ -124,11 +126,11 @@ if __name__ == '__main__':
     #                                         c_ah_lookup(lut, T_LO, T_HI, t, rh)))
 
     print("")
-    print("C Source:")
+    print("C settings (table entries: {}):".format(
+          ', '.join(['{:.0f}'.format(ah * 1000) for ah in lut])))
     print("""
-#define T_LO ({t_low})
-#define T_HI ({t_high})
-static const uint32_t AH_LUT_100RH[] = {{{ah_lut_100rh}}};"""
-          .format(t_low=T_LO, t_high=T_HI,
-                  ah_lut_100rh=', '.join(['{:.0f}'.format(ah * 1000)
-                                          for ah in lut])))
+#define SENSIRION_AH_LUT_T_LO ({t_low})
+#define SENSIRION_AH_LUT_T_HI ({t_high})
+#define SENSIRION_AH_LUT_T_STEP ({t_step})"""
+          .format(t_low=T_LO * 1000, t_high=T_HI * 1000,
+                  t_step=T_STEP * 1000))
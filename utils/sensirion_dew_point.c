@@ -0,0 +1,268 @@
+/*
+ * Copyright (c) 2026, Sensirion AG
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * * Redistributions of source code must retain the above copyright notice, this
+ *   list of conditions and the following disclaimer.
+ *
+ * * Redistributions in binary form must reproduce the above copyright notice,
+ *   this list of conditions and the following disclaimer in the documentation
+ *   and/or other materials provided with the distribution.
+ *
+ * * Neither the name of Sensirion AG nor the names of its
+ *   contributors may be used to endorse or promote products derived from
+ *   this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/*
+ * Integer dew point, frost point and vapour pressure deficit. The saturation
+ * vapour pressure over water and over ice is tabulated in centi Pascal at
+ * power of two spacing of milli degree Celsius. The vapour pressure follows
+ * from the relative humidity with a reciprocal multiplication, dew and frost
+ * point invert the tables with a binary search and one division.
+ */
+
+#include "sensirion_humidity_conversion.h"
+#include "sensirion_humidity_lut.h"
+
+#if SENSIRION_DEW_POINT_LUT_SHIFT < 8 || SENSIRION_DEW_POINT_LUT_SHIFT > 11
+#error "SENSIRION_DEW_POINT_LUT_SHIFT has to be in 8..11"
+#endif
+
+#define DP_T_LO (-40000)
+#define DP_T_HI 125000
+#define DP_STEP (1 << SENSIRION_DEW_POINT_LUT_SHIFT)
+/* the water table covers -40..125 degC, the ice table -40..0 degC */
+#define DP_WATER_LUT_SIZE ((DP_T_HI - DP_T_LO + DP_STEP - 1) / DP_STEP + 1)
+#define DP_ICE_LUT_SIZE ((0 - DP_T_LO + DP_STEP - 1) / DP_STEP + 1)
+#define DP_T_MAX ((DP_WATER_LUT_SIZE - 1) * DP_STEP)
+
+/* saturation vapour pressure at 0 degC over water and ice, in centi Pascal */
+#define DP_ES_0 61120U
+
+/* humidity * 2^31 / 100000, exact to 8e-6 and without overflow up to 199998
+ * milli percent (UINT32_MAX / DP_RH_SCALE) */
+#define DP_RH_SCALE 21475U
+/* humidity * 2^38 / (100000 * 100) to get Pascal from centi Pascal */
+#define DP_RH_SCALE_PA 27488U
+
+#define DP_WATER_LUT_ENTRY(i)                                                  \
+    SENSIRION_ES_WATER_LUT_VALUE(DP_T_LO + (i)*DP_STEP),
+#define DP_ICE_LUT_ENTRY(i) SENSIRION_ES_ICE_LUT_VALUE(DP_T_LO + (i)*DP_STEP),
+
+/* clang-format off */
+static const uint32_t DP_WATER_LUT[] = {
+#if DP_WATER_LUT_SIZE & 0x400
+    SENSIRION_AH_LUT_512(DP_WATER_LUT_ENTRY, 0)
+    SENSIRION_AH_LUT_512(DP_WATER_LUT_ENTRY, 512)
+#endif
+#if DP_WATER_LUT_SIZE & 0x200
+    SENSIRION_AH_LUT_512(DP_WATER_LUT_ENTRY, DP_WATER_LUT_SIZE & 0x400)
+#endif
+#if DP_WATER_LUT_SIZE & 0x100
+    SENSIRION_AH_LUT_256(DP_WATER_LUT_ENTRY, DP_WATER_LUT_SIZE & 0x600)
+#endif
+#if DP_WATER_LUT_SIZE & 0x080
+    SENSIRION_AH_LUT_128(DP_WATER_LUT_ENTRY, DP_WATER_LUT_SIZE & 0x700)
+#endif
+#if DP_WATER_LUT_SIZE & 0x040
+    SENSIRION_AH_LUT_64(DP_WATER_LUT_ENTRY, DP_WATER_LUT_SIZE & 0x780)
+#endif
+#if DP_WATER_LUT_SIZE & 0x020
+    SENSIRION_AH_LUT_32(DP_WATER_LUT_ENTRY, DP_WATER_LUT_SIZE & 0x7C0)
+#endif
+#if DP_WATER_LUT_SIZE & 0x010
+    SENSIRION_AH_LUT_16(DP_WATER_LUT_ENTRY, DP_WATER_LUT_SIZE & 0x7E0)
+#endif
+#if DP_WATER_LUT_SIZE & 0x008
+    SENSIRION_AH_LUT_8(DP_WATER_LUT_ENTRY, DP_WATER_LUT_SIZE & 0x7F0)
+#endif
+#if DP_WATER_LUT_SIZE & 0x004
+    SENSIRION_AH_LUT_4(DP_WATER_LUT_ENTRY, DP_WATER_LUT_SIZE & 0x7F8)
+#endif
+#if DP_WATER_LUT_SIZE & 0x002
+    SENSIRION_AH_LUT_2(DP_WATER_LUT_ENTRY, DP_WATER_LUT_SIZE & 0x7FC)
+#endif
+#if DP_WATER_LUT_SIZE & 0x001
+    SENSIRION_AH_LUT_1(DP_WATER_LUT_ENTRY, DP_WATER_LUT_SIZE & 0x7FE)
+#endif
+};
+
+static const uint32_t DP_ICE_LUT[] = {
+#if DP_ICE_LUT_SIZE & 0x100
+    SENSIRION_AH_LUT_256(DP_ICE_LUT_ENTRY, 0)
+#endif
+#if DP_ICE_LUT_SIZE & 0x080
+    SENSIRION_AH_LUT_128(DP_ICE_LUT_ENTRY, DP_ICE_LUT_SIZE & 0x100)
+#endif
+#if DP_ICE_LUT_SIZE & 0x040
+    SENSIRION_AH_LUT_64(DP_ICE_LUT_ENTRY, DP_ICE_LUT_SIZE & 0x180)
+#endif
+#if DP_ICE_LUT_SIZE & 0x020
+    SENSIRION_AH_LUT_32(DP_ICE_LUT_ENTRY, DP_ICE_LUT_SIZE & 0x1C0)
+#endif
+#if DP_ICE_LUT_SIZE & 0x010
+    SENSIRION_AH_LUT_16(DP_ICE_LUT_ENTRY, DP_ICE_LUT_SIZE & 0x1E0)
+#endif
+#if DP_ICE_LUT_SIZE & 0x008
+    SENSIRION_AH_LUT_8(DP_ICE_LUT_ENTRY, DP_ICE_LUT_SIZE & 0x1F0)
+#endif
+#if DP_ICE_LUT_SIZE & 0x004
+    SENSIRION_AH_LUT_4(DP_ICE_LUT_ENTRY, DP_ICE_LUT_SIZE & 0x1F8)
+#endif
+#if DP_ICE_LUT_SIZE & 0x002
+    SENSIRION_AH_LUT_2(DP_ICE_LUT_ENTRY, DP_ICE_LUT_SIZE & 0x1FC)
+#endif
+#if DP_ICE_LUT_SIZE & 0x001
+    SENSIRION_AH_LUT_1(DP_ICE_LUT_ENTRY, DP_ICE_LUT_SIZE & 0x1FE)
+#endif
+};
+/* clang-format on */
+
+/* saturation vapour pressure over water in centi Pascal */
+static uint32_t saturation_vapour_pressure(int32_t temperature_milli_celsius) {
+    uint32_t t, i;
+
+    if (temperature_milli_celsius <= DP_T_LO)
+        t = 0;
+    else if (temperature_milli_celsius >= DP_T_LO + DP_T_MAX)
+        t = DP_T_MAX;
+    else
+        t = (uint32_t)(temperature_milli_celsius - DP_T_LO);
+
+    i = t >> SENSIRION_DEW_POINT_LUT_SHIFT;
+    if (i > DP_WATER_LUT_SIZE - 2)
+        i = DP_WATER_LUT_SIZE - 2;
+    t -= i << SENSIRION_DEW_POINT_LUT_SHIFT;
+    /* the difference of two entries stays below 2^21 */
+    return DP_WATER_LUT[i] + (((DP_WATER_LUT[i + 1] - DP_WATER_LUT[i]) * t) >>
+                              SENSIRION_DEW_POINT_LUT_SHIFT);
+}
+
+/* vapour pressure in centi Pascal */
+static uint32_t vapour_pressure(int32_t temperature_milli_celsius,
+                                int32_t humidity_milli_percent) {
+    uint32_t es = saturation_vapour_pressure(temperature_milli_celsius);
+
+    if (humidity_milli_percent <= 0)
+        return 0;
+    return (uint32_t)(((uint64_t)es * ((uint32_t)humidity_milli_percent *
+                                       DP_RH_SCALE)) >>
+                      31);
+}
+
+/* temperature in milli degree Celsius at which the table reaches es */
+static int32_t invert(const uint32_t* lut, uint32_t size, uint32_t es) {
+    uint32_t lo = 0, hi = size - 1, mid;
+
+    if (es <= lut[0])
+        return DP_T_LO;
+    if (es >= lut[hi])
+        return DP_T_LO + (int32_t)(hi << SENSIRION_DEW_POINT_LUT_SHIFT);
+
+    /* lut[lo] < es < lut[hi] */
+    while (hi - lo > 1) {
+        mid = (lo + hi) / 2;
+        if (lut[mid] <= es)
+            lo = mid;
+        else
+            hi = mid;
+    }
+    return DP_T_LO + (int32_t)((lo << SENSIRION_DEW_POINT_LUT_SHIFT) +
+                               ((es - lut[lo])
+                                << SENSIRION_DEW_POINT_LUT_SHIFT) /
+                                   (lut[hi] - lut[lo]));
+}
+
+static int32_t dew_point(int32_t temperature_milli_celsius,
+                         int32_t humidity_milli_percent) {
+    int32_t ret = invert(
+        DP_WATER_LUT, DP_WATER_LUT_SIZE,
+        vapour_pressure(temperature_milli_celsius, humidity_milli_percent));
+
+    return ret > DP_T_HI ? DP_T_HI : ret;
+}
+
+static int32_t frost_point(int32_t temperature_milli_celsius,
+                           int32_t humidity_milli_percent) {
+    uint32_t e =
+        vapour_pressure(temperature_milli_celsius, humidity_milli_percent);
+
+    /* above the triple point dew and frost point are the same */
+    if (e >= DP_ES_0) {
+        int32_t ret = invert(DP_WATER_LUT, DP_WATER_LUT_SIZE, e);
+        return ret > DP_T_HI ? DP_T_HI : ret;
+    }
+    return invert(DP_ICE_LUT, DP_ICE_LUT_SIZE, e);
+}
+
+static uint32_t vapour_pressure_deficit(int32_t temperature_milli_celsius,
+                                        int32_t humidity_milli_percent) {
+    uint32_t es = saturation_vapour_pressure(temperature_milli_celsius);
+    uint32_t deficit;
+
+    if (humidity_milli_percent >= 100000)
+        return 0;
+    if (humidity_milli_percent <= 0)
+        deficit = 100000;
+    else
+        deficit = (uint32_t)(100000 - humidity_milli_percent);
+    return (uint32_t)(((uint64_t)es * (deficit * DP_RH_SCALE_PA)) >> 38);
+}
+
+int32_t sensirion_calc_dew_point(int32_t temperature_milli_celsius,
+                                 int32_t humidity_milli_percent) {
+    return dew_point(temperature_milli_celsius, humidity_milli_percent);
+}
+
+int32_t sensirion_calc_frost_point(int32_t temperature_milli_celsius,
+                                   int32_t humidity_milli_percent) {
+    return frost_point(temperature_milli_celsius, humidity_milli_percent);
+}
+
+uint32_t
+sensirion_calc_vapour_pressure_deficit(int32_t temperature_milli_celsius,
+                                       int32_t humidity_milli_percent) {
+    return vapour_pressure_deficit(temperature_milli_celsius,
+                                   humidity_milli_percent);
+}
+
+void sensirion_calc_dew_point_batch(const int32_t* values, int32_t* dew_points,
+                                    uint32_t count) {
+    uint32_t i;
+
+    for (i = 0; i < count; ++i)
+        dew_points[i] = dew_point(values[2 * i], values[2 * i + 1]);
+}
+
+void sensirion_calc_frost_point_batch(const int32_t* values,
+                                      int32_t* frost_points, uint32_t count) {
+    uint32_t i;
+
+    for (i = 0; i < count; ++i)
+        frost_points[i] = frost_point(values[2 * i], values[2 * i + 1]);
+}
+
+void sensirion_calc_vapour_pressure_deficit_batch(const int32_t* values,
+                                                  uint32_t* deficits,
+                                                  uint32_t count) {
+    uint32_t i;
+
+    for (i = 0; i < count; ++i)
+        deficits[i] = vapour_pressure_deficit(values[2 * i], values[2 * i + 1]);
+}
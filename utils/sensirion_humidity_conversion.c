@@ -30,40 +30,78 @@
  */
 
 #include "sensirion_humidity_conversion.h"
+#include "sensirion_humidity_lut.h"
 
 #ifndef ARRAY_SIZE
 #define ARRAY_SIZE(x) (sizeof(x) / sizeof(*(x)))
 #endif /* ARRAY_SIZE */
 
-/* T_LO and T_HI parametrize the first and last temperature step of the absolute
- * humidity lookup table (at 100%RH). The lookup table entries have to be
- * linearly spaced. We provide a python script to generate look up tables based
- * on customizable T_LO/T_HI and number of steps. */
+/* The lookup table of the absolute humidity at 100%RH is generated at compile
+ * time from SENSIRION_AH_LUT_T_LO, SENSIRION_AH_LUT_T_HI and
+ * SENSIRION_AH_LUT_T_STEP (see sensirion_humidity_conversion.h). The entries
+ * are linearly spaced, the absolute humidity scales linearly with the relative
+ * humidity. */
 
-/**
- * T_LO - Towest temperature sampling point in the lookup table.
- * Temperature value in milli-degrees Centigrade
- */
-#define T_LO (-20000)
+#if SENSIRION_AH_LUT_T_LO < -40000 || SENSIRION_AH_LUT_T_HI > 125000
+#error "the absolute humidity lookup table is limited to -40..125 degC"
+#endif
+#if SENSIRION_AH_LUT_T_STEP <= 0 || \
+    (SENSIRION_AH_LUT_T_HI - SENSIRION_AH_LUT_T_LO) % SENSIRION_AH_LUT_T_STEP
+#error "SENSIRION_AH_LUT_T_STEP has to divide the lookup table range"
+#endif
+#if SENSIRION_AH_LUT_SIZE < 2 || SENSIRION_AH_LUT_SIZE > 1023
+#error "the absolute humidity lookup table needs 2 to 1023 entries"
+#endif
 
-/**
- * T_HI - Towest temperature sampling point in the lookup table.
- * Temperature value in milli-degrees Celsius (Centigrade)
- */
-#define T_HI (70000)
+/* Above 75 degC or with steps over 20 degC the interpolation and the scaling
+ * with the relative humidity overflow 32 bit intermediates */
+#if SENSIRION_AH_LUT_T_HI > 75000 || SENSIRION_AH_LUT_T_STEP > 20000
+#define SENSIRION_AH_LUT_WIDE
+#endif
+
+#define SENSIRION_AH_LUT_ENTRY(i)                                              \
+    SENSIRION_AH_LUT_VALUE(SENSIRION_AH_LUT_T_LO + (i)*SENSIRION_AH_LUT_T_STEP),
 
 /**
- * Lookup table for linearly spaced temperature points between T_LO and T_HI
- * Absolute Humidity value in mg/m^3.
- */
-static const uint32_t AH_LUT_100RH[] = {1078,  2364,  4849,  9383,   17243,
-                                        30264, 50983, 82785, 130048, 198277};
-/**
- * T_STEP is the temperature step between the sampling points in the lookup
- * table. It is determined by T_HI, T_LO and the number of entries in
- * AH_LUT_100RH and does not have to be adapted when changing the paramters.
+ * Lookup table for linearly spaced temperature points between
+ * SENSIRION_AH_LUT_T_LO and SENSIRION_AH_LUT_T_HI, absolute humidity value in
+ * mg/m^3. The blocks for the set bits of SENSIRION_AH_LUT_SIZE add up to the
+ * table, the offset of each block is the sum of the higher bits.
  */
-static const uint32_t T_STEP = (T_HI - T_LO) / (ARRAY_SIZE(AH_LUT_100RH) - 1);
+/* clang-format off */
+static const uint32_t AH_LUT_100RH[] = {
+#if SENSIRION_AH_LUT_SIZE & 0x200
+    SENSIRION_AH_LUT_512(SENSIRION_AH_LUT_ENTRY, 0)
+#endif
+#if SENSIRION_AH_LUT_SIZE & 0x100
+    SENSIRION_AH_LUT_256(SENSIRION_AH_LUT_ENTRY, SENSIRION_AH_LUT_SIZE & 0x200)
+#endif
+#if SENSIRION_AH_LUT_SIZE & 0x080
+    SENSIRION_AH_LUT_128(SENSIRION_AH_LUT_ENTRY, SENSIRION_AH_LUT_SIZE & 0x300)
+#endif
+#if SENSIRION_AH_LUT_SIZE & 0x040
+    SENSIRION_AH_LUT_64(SENSIRION_AH_LUT_ENTRY, SENSIRION_AH_LUT_SIZE & 0x380)
+#endif
+#if SENSIRION_AH_LUT_SIZE & 0x020
+    SENSIRION_AH_LUT_32(SENSIRION_AH_LUT_ENTRY, SENSIRION_AH_LUT_SIZE & 0x3C0)
+#endif
+#if SENSIRION_AH_LUT_SIZE & 0x010
+    SENSIRION_AH_LUT_16(SENSIRION_AH_LUT_ENTRY, SENSIRION_AH_LUT_SIZE & 0x3E0)
+#endif
+#if SENSIRION_AH_LUT_SIZE & 0x008
+    SENSIRION_AH_LUT_8(SENSIRION_AH_LUT_ENTRY, SENSIRION_AH_LUT_SIZE & 0x3F0)
+#endif
+#if SENSIRION_AH_LUT_SIZE & 0x004
+    SENSIRION_AH_LUT_4(SENSIRION_AH_LUT_ENTRY, SENSIRION_AH_LUT_SIZE & 0x3F8)
+#endif
+#if SENSIRION_AH_LUT_SIZE & 0x002
+    SENSIRION_AH_LUT_2(SENSIRION_AH_LUT_ENTRY, SENSIRION_AH_LUT_SIZE & 0x3FC)
+#endif
+#if SENSIRION_AH_LUT_SIZE & 0x001
+    SENSIRION_AH_LUT_1(SENSIRION_AH_LUT_ENTRY, SENSIRION_AH_LUT_SIZE & 0x3FE)
+#endif
+};
+/* clang-format on */
 
 uint32_t sensirion_calc_absolute_humidity(int32_t temperature_milli_celsius,
                                           int32_t humidity_milli_percent) {
@@ -72,13 +110,13 @@ uint32_t sensirion_calc_absolute_humidity(int32_t temperature_milli_celsius,
     if (humidity_milli_percent <= 0)
         return 0;
 
-    if (temperature_milli_celsius < T_LO)
+    if (temperature_milli_celsius < SENSIRION_AH_LUT_T_LO)
         t = 0;
     else
-        t = (uint32_t)(temperature_milli_celsius - T_LO);
+        t = (uint32_t)(temperature_milli_celsius - SENSIRION_AH_LUT_T_LO);
 
-    i = t / T_STEP;
-    rem = t % T_STEP;
+    i = t / SENSIRION_AH_LUT_T_STEP;
+    rem = t % SENSIRION_AH_LUT_T_STEP;
 
     if (i >= ARRAY_SIZE(AH_LUT_100RH) - 1) {
         ret = AH_LUT_100RH[ARRAY_SIZE(AH_LUT_100RH) - 1];
@@ -87,13 +125,23 @@ uint32_t sensirion_calc_absolute_humidity(int32_t temperature_milli_celsius,
         ret = AH_LUT_100RH[i];
 
     } else {
-        ret = (AH_LUT_100RH[i] +
-               ((AH_LUT_100RH[i + 1] - AH_LUT_100RH[i]) * rem / T_STEP));
+#ifdef SENSIRION_AH_LUT_WIDE
+        ret = AH_LUT_100RH[i] +
+              (uint32_t)((uint64_t)(AH_LUT_100RH[i + 1] - AH_LUT_100RH[i]) *
+                         rem / SENSIRION_AH_LUT_T_STEP);
+#else
+        ret = (AH_LUT_100RH[i] + ((AH_LUT_100RH[i + 1] - AH_LUT_100RH[i]) *
+                                  rem / SENSIRION_AH_LUT_T_STEP));
+#endif
     }
 
+#ifdef SENSIRION_AH_LUT_WIDE
+    return (uint32_t)(((uint64_t)ret * (uint32_t)humidity_milli_percent) /
+                      100000);
+#else
     // Code is mathematically (but not numerically) equivalent to
     //    return (ret * (humidity_milli_percent)) / 100000;
-    // Maximum ret = 198277 (Or last entry from AH_LUT_100RH)
+    // Maximum ret = 242312 (last entry at 75 degC, wider tables use 64 bit)
     // Maximum humidity_milli_percent = 119000 (theoretical maximum)
     // Multiplication might overflow with a maximum of 3 digits
     // Trick: ((ret >> 3) * (uint32_t)humidity_milli_percent) never overflows
@@ -101,4 +149,5 @@ uint32_t sensirion_calc_absolute_humidity(int32_t temperature_milli_celsius,
     // divides by 8
 
     return ((ret >> 3) * (uint32_t)(humidity_milli_percent)) / 12500;
+#endif
 }
@@ -33,6 +33,51 @@
 #define HUMIDITY_CONVERSION_H
 #include "sensirion_arch_config.h"
 
+/**
+ * Range and resolution of the absolute humidity lookup table, in milli degree
+ * Celsius. The table is generated at compile time and holds
+ * SENSIRION_AH_LUT_SIZE entries of 4 bytes, e.g. -40000..125000 in steps of
+ * 1000 needs 166 entries. The range is limited to -40..125 degC and the step
+ * has to divide it. Temperatures outside of the range use the closest entry.
+ * Run `make -C utils ah_lut_report` to compare the accuracy and speed of
+ * different settings.
+ */
+#ifndef SENSIRION_AH_LUT_T_LO
+#define SENSIRION_AH_LUT_T_LO (-20000)
+#endif
+#ifndef SENSIRION_AH_LUT_T_HI
+#define SENSIRION_AH_LUT_T_HI 70000
+#endif
+#ifndef SENSIRION_AH_LUT_T_STEP
+#define SENSIRION_AH_LUT_T_STEP 10000
+#endif
+
+/**
+ * Spacing of the lookup table of sensirion_calc_absolute_humidity_fast() as a
+ * power of two of milli degree Celsius, covering -40..125 degC. The default
+ * of 10 (1.024 degC) needs 163 entries (652 bytes), every step up halves the
+ * table and quadruples the interpolation error. Valid range: 8..12.
+ */
+#ifndef SENSIRION_AH_FAST_LUT_SHIFT
+#define SENSIRION_AH_FAST_LUT_SHIFT 10
+#endif
+
+/**
+ * Spacing of the saturation vapour pressure tables of the dew point, frost
+ * point and vapour pressure deficit conversions as a power of two of milli
+ * degree Celsius. The default of 10 (1.024 degC) needs 163 entries over water
+ * (-40..125 degC) and 41 over ice (-40..0 degC), 816 bytes in total. Valid
+ * range: 8..11.
+ */
+#ifndef SENSIRION_DEW_POINT_LUT_SHIFT
+#define SENSIRION_DEW_POINT_LUT_SHIFT 10
+#endif
+
+#define SENSIRION_AH_LUT_SIZE                                                  \
+    ((SENSIRION_AH_LUT_T_HI - SENSIRION_AH_LUT_T_LO) /                         \
+         SENSIRION_AH_LUT_T_STEP +                                             \
+     1)
+
 #ifdef __cplusplus
 extern "C" {
 #endif
@@ -53,6 +98,146 @@ extern "C" {
 uint32_t sensirion_calc_absolute_humidity(int32_t temperature_milli_celsius,
                                           int32_t humidity_milli_percent);
 
+/**
+ * sensirion_calc_absolute_humidity_fast() - Calculate absolute humidity
+ *                                           without divisions
+ *
+ * Same as sensirion_calc_absolute_humidity() but with a lookup table spaced
+ * in powers of two (SENSIRION_AH_FAST_LUT_SHIFT) over -40..125 degC, so the
+ * conversion only needs shifts and 32 bit multiplications. With the default
+ * spacing the result deviates from the Magnus formula by at most 0.2 % of the
+ * absolute humidity at 100 %RH plus 2 mg/m^3 (rounding to integers), see
+ * `make benchmark`.
+ *
+ * @param temperature_milli_celsius The temperature measurement in milli Degree
+ *                                  Celsius, clamped to -40000..125000
+ * @param humidity_milli_percent    The relative humidity measurement in
+ *                                  milli Percent (0-119000)
+ *
+ * @return                          The absolute humidity in mg/m^3
+ */
+uint32_t
+sensirion_calc_absolute_humidity_fast(int32_t temperature_milli_celsius,
+                                      int32_t humidity_milli_percent);
+
+/**
+ * sensirion_calc_absolute_humidity_batch() - Calculate the absolute humidity
+ *                                            of a series of samples
+ *
+ * Converts interleaved temperature and relative humidity pairs, e.g. from
+ * sensirion_sht3x_ticks_to_milli(), with the result of
+ * sensirion_calc_absolute_humidity_fast(). Uses AVX2 when the compiler targets
+ * it, define SENSIRION_HUMIDITY_CONVERSION_NO_SIMD to disable it.
+ *
+ * @param values            count pairs of temperature in milli degree Celsius
+ *                          and relative humidity in milli percent
+ * @param absolute_humidity count absolute humidity values in mg/m^3
+ * @param count             number of samples
+ */
+void sensirion_calc_absolute_humidity_batch(const int32_t* values,
+                                            uint32_t* absolute_humidity,
+                                            uint32_t count);
+
+/**
+ * sensirion_calc_dew_point() - Calculate the dew point from temperature and
+ *                              relative humidity
+ *
+ * Integer only, the saturation vapour pressure is interpolated in a lookup
+ * table (SENSIRION_DEW_POINT_LUT_SHIFT) and inverted with a binary search and
+ * one division. With the default spacing the result deviates from the Magnus
+ * formula by at most 0.03 degC.
+ *
+ * @param temperature_milli_celsius The temperature measurement in milli Degree
+ *                                  Celsius, clamped to -40000..125000
+ * @param humidity_milli_percent    The relative humidity measurement in
+ *                                  milli Percent (0-119000)
+ *
+ * @return                          The dew point in milli degree Celsius,
+ *                                  clamped to -40000..125000
+ */
+int32_t sensirion_calc_dew_point(int32_t temperature_milli_celsius,
+                                 int32_t humidity_milli_percent);
+
+/**
+ * sensirion_calc_frost_point() - Calculate the frost point from temperature
+ *                                and relative humidity
+ *
+ * The temperature at which the water vapour saturates over ice. Equal to the
+ * dew point when that is above 0 degC. With the default spacing the result
+ * deviates from the Magnus formula over ice by at most 0.03 degC.
+ *
+ * @param temperature_milli_celsius The temperature measurement in milli Degree
+ *                                  Celsius, clamped to -40000..125000
+ * @param humidity_milli_percent    The relative humidity measurement in
+ *                                  milli Percent (0-119000)
+ *
+ * @return                          The frost point in milli degree Celsius,
+ *                                  clamped to -40000..125000
+ */
+int32_t sensirion_calc_frost_point(int32_t temperature_milli_celsius,
+                                   int32_t humidity_milli_percent);
+
+/**
+ * sensirion_calc_vapour_pressure_deficit() - Calculate the vapour pressure
+ *                                            deficit
+ *
+ * Difference between the saturation vapour pressure and the vapour pressure,
+ * zero at or above 100 %RH. With the default spacing the result deviates from
+ * the Magnus formula by at most 0.05 % of the saturation vapour pressure plus
+ * 1 Pa.
+ *
+ * @param temperature_milli_celsius The temperature measurement in milli Degree
+ *                                  Celsius, clamped to -40000..125000
+ * @param humidity_milli_percent    The relative humidity measurement in
+ *                                  milli Percent (0-119000)
+ *
+ * @return                          The vapour pressure deficit in Pascal
+ */
+uint32_t
+sensirion_calc_vapour_pressure_deficit(int32_t temperature_milli_celsius,
+                                       int32_t humidity_milli_percent);
+
+/**
+ * sensirion_calc_dew_point_batch() - Calculate the dew point of a series of
+ *                                    samples
+ *
+ * @param values     count pairs of temperature in milli degree Celsius and
+ *                   relative humidity in milli percent
+ * @param dew_points count dew points in milli degree Celsius, see
+ *                   sensirion_calc_dew_point()
+ * @param count      number of samples
+ */
+void sensirion_calc_dew_point_batch(const int32_t* values, int32_t* dew_points,
+                                    uint32_t count);
+
+/**
+ * sensirion_calc_frost_point_batch() - Calculate the frost point of a series
+ *                                      of samples
+ *
+ * @param values       count pairs of temperature in milli degree Celsius and
+ *                     relative humidity in milli percent
+ * @param frost_points count frost points in milli degree Celsius, see
+ *                     sensirion_calc_frost_point()
+ * @param count        number of samples
+ */
+void sensirion_calc_frost_point_batch(const int32_t* values,
+                                      int32_t* frost_points, uint32_t count);
+
+/**
+ * sensirion_calc_vapour_pressure_deficit_batch() - Calculate the vapour
+ *                                                  pressure deficit of a
+ *                                                  series of samples
+ *
+ * @param values   count pairs of temperature in milli degree Celsius and
+ *                 relative humidity in milli percent
+ * @param deficits count vapour pressure deficits in Pascal, see
+ *                 sensirion_calc_vapour_pressure_deficit()
+ * @param count    number of samples
+ */
+void sensirion_calc_vapour_pressure_deficit_batch(const int32_t* values,
+                                                  uint32_t* deficits,
+                                                  uint32_t count);
+
 #ifdef __cplusplus
 }
 #endif
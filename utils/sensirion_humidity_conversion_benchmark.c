@@ -0,0 +1,167 @@
+/*
+ * Copyright (c) 2026, Sensirion AG
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * * Redistributions of source code must retain the above copyright notice, this
+ *   list of conditions and the following disclaimer.
+ *
+ * * Redistributions in binary form must reproduce the above copyright notice,
+ *   this list of conditions and the following disclaimer in the documentation
+ *   and/or other materials provided with the distribution.
+ *
+ * * Neither the name of Sensirion AG nor the names of its
+ *   contributors may be used to endorse or promote products derived from
+ *   this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/*
+ * Accuracy and throughput of sensirion_calc_absolute_humidity_fast() and
+ * sensirion_calc_absolute_humidity_batch() against
+ * sensirion_calc_absolute_humidity(), throughput of the dew point and vapour
+ * pressure deficit conversions. Build with `make benchmark`, add e.g.
+ * BENCHMARK_CFLAGS="-O2 -mavx2" to select the SIMD path.
+ */
+
+#define _POSIX_C_SOURCE 200809L
+
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+
+#include "sensirion_humidity_conversion.h"
+
+#define NUM_SAMPLES 4096
+#define NUM_ROUNDS 5000
+
+typedef uint32_t (*ah_function_t)(int32_t, int32_t);
+
+static int32_t values[2 * NUM_SAMPLES];
+static uint32_t results[NUM_SAMPLES];
+
+static double now_sec(void) {
+    struct timespec ts;
+
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (double)ts.tv_sec + (double)ts.tv_nsec * 1e-9;
+}
+
+/* absolute humidity in mg/m^3 */
+static double magnus_ah(double t, double rh) {
+    return 216.7 * (rh / 100.0 * 6.112 * exp(17.62 * t / (243.12 + t))) /
+           (273.15 + t) * 1000.0;
+}
+
+/* worst deviation from the Magnus formula, absolute in mg/m^3 and relative to
+ * the absolute humidity at 100 %RH */
+static void report_error(const char* name, ah_function_t ah, int32_t t_lo,
+                         int32_t t_hi) {
+    double err_max = 0.0, rel_max = 0.0;
+    int32_t t, rh;
+
+    for (t = t_lo; t <= t_hi; t += 10) {
+        double full = magnus_ah(t / 1000.0, 100.0);
+        for (rh = 0; rh <= 100000; rh += 500) {
+            double err = fabs(ah(t, rh) - magnus_ah(t / 1000.0, rh / 1000.0));
+            if (err > err_max)
+                err_max = err;
+            if (err / full > rel_max)
+                rel_max = err / full;
+        }
+    }
+    printf("%-10s %6.1f..%5.1f degC: max error %8.1f mg/m^3, %6.3f %% of "
+           "AH(100%%RH)\n",
+           name, t_lo / 1000.0, t_hi / 1000.0, err_max, rel_max * 100.0);
+}
+
+static int check_batch(void) {
+    uint32_t i;
+
+    sensirion_calc_absolute_humidity_batch(values, results, NUM_SAMPLES);
+    for (i = 0; i < NUM_SAMPLES; ++i) {
+        if (results[i] != sensirion_calc_absolute_humidity_fast(
+                              values[2 * i], values[2 * i + 1])) {
+            printf("batch mismatch at sample %u\n", i);
+            return 1;
+        }
+    }
+    return 0;
+}
+
+static void report(const char* name, double seconds) {
+    printf("%-28s %8.1f Msamples/s\n", name,
+           (double)NUM_SAMPLES * NUM_ROUNDS / seconds * 1e-6);
+}
+
+static uint32_t dew_point(int32_t temperature, int32_t humidity) {
+    return (uint32_t)sensirion_calc_dew_point(temperature, humidity);
+}
+
+static double time_single(ah_function_t ah, uint32_t* checksum) {
+    double start = now_sec();
+    uint32_t round, i;
+
+    for (round = 0; round < NUM_ROUNDS; ++round) {
+        for (i = 0; i < NUM_SAMPLES; ++i)
+            results[i] = ah(values[2 * i], values[2 * i + 1]);
+        *checksum += results[round % NUM_SAMPLES];
+    }
+    return now_sec() - start;
+}
+
+int main(void) {
+    int32_t t_lo = SENSIRION_AH_LUT_T_LO, t_hi = SENSIRION_AH_LUT_T_HI;
+    uint32_t checksum = 0, round, i;
+    double start;
+
+#if defined(SENSIRION_HUMIDITY_CONVERSION_NO_SIMD) || !defined(__AVX2__)
+    printf("batch path: scalar\n");
+#else
+    printf("batch path: AVX2\n");
+#endif
+
+    report_error("lut", sensirion_calc_absolute_humidity, t_lo, t_hi);
+    report_error("fast", sensirion_calc_absolute_humidity_fast, t_lo, t_hi);
+    report_error("fast", sensirion_calc_absolute_humidity_fast, -40000, 125000);
+
+    srand(1);
+    for (i = 0; i < NUM_SAMPLES; ++i) {
+        values[2 * i] = t_lo + rand() % (t_hi - t_lo + 1);
+        values[2 * i + 1] = rand() % 100001;
+    }
+    if (check_batch())
+        return 1;
+
+    report("per sample (lut)",
+           time_single(sensirion_calc_absolute_humidity, &checksum));
+    report("per sample (fast)",
+           time_single(sensirion_calc_absolute_humidity_fast, &checksum));
+    report("per sample (dew point)", time_single(dew_point, &checksum));
+    report("per sample (vpd)",
+           time_single(sensirion_calc_vapour_pressure_deficit, &checksum));
+
+    start = now_sec();
+    for (round = 0; round < NUM_ROUNDS; ++round) {
+        sensirion_calc_absolute_humidity_batch(values, results, NUM_SAMPLES);
+        checksum += results[round % NUM_SAMPLES];
+    }
+    report("batch", now_sec() - start);
+
+    printf("(checksum %u)\n", checksum);
+    return 0;
+}
@@ -0,0 +1,186 @@
+/*
+ * Copyright (c) 2026, Sensirion AG
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * * Redistributions of source code must retain the above copyright notice, this
+ *   list of conditions and the following disclaimer.
+ *
+ * * Redistributions in binary form must reproduce the above copyright notice,
+ *   this list of conditions and the following disclaimer in the documentation
+ *   and/or other materials provided with the distribution.
+ *
+ * * Neither the name of Sensirion AG nor the names of its
+ *   contributors may be used to endorse or promote products derived from
+ *   this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/*
+ * Division free absolute humidity conversion. The lookup table is spaced in
+ * powers of two of milli degree Celsius, the index and the interpolation are
+ * shifts, the scaling with the relative humidity is a split reciprocal
+ * multiplication. All intermediates fit 32 bit, which keeps the conversion
+ * free of library calls on Cortex-M0.
+ */
+
+#include "sensirion_humidity_conversion.h"
+#include "sensirion_humidity_lut.h"
+
+#if !defined(SENSIRION_HUMIDITY_CONVERSION_NO_SIMD) && defined(__AVX2__)
+#include <immintrin.h>
+#define SENSIRION_HUMIDITY_CONVERSION_AVX2
+#endif
+
+#if SENSIRION_AH_FAST_LUT_SHIFT < 8 || SENSIRION_AH_FAST_LUT_SHIFT > 12
+#error "SENSIRION_AH_FAST_LUT_SHIFT has to be in 8..12"
+#endif
+
+#define AH_FAST_T_LO (-40000)
+#define AH_FAST_T_RANGE 165000 /* -40..125 degC */
+#define AH_FAST_STEP (1 << SENSIRION_AH_FAST_LUT_SHIFT)
+#define AH_FAST_LUT_SIZE                                                       \
+    ((AH_FAST_T_RANGE + AH_FAST_STEP - 1) / AH_FAST_STEP + 1)
+#define AH_FAST_T_MAX ((AH_FAST_LUT_SIZE - 1) * AH_FAST_STEP)
+
+/* humidity * 2^16 / 100000 as (humidity * RH_SCALE) >> 15, exact to 8e-6 and
+ * without overflow up to 199998 milli percent (UINT32_MAX / RH_SCALE) */
+#define AH_FAST_RH_SCALE 21475U
+
+#define AH_FAST_LUT_ENTRY(i)                                                   \
+    SENSIRION_AH_LUT_VALUE(AH_FAST_T_LO + (i)*AH_FAST_STEP),
+
+/* clang-format off */
+static const uint32_t AH_FAST_LUT_100RH[] = {
+#if AH_FAST_LUT_SIZE & 0x200
+    SENSIRION_AH_LUT_512(AH_FAST_LUT_ENTRY, 0)
+#endif
+#if AH_FAST_LUT_SIZE & 0x100
+    SENSIRION_AH_LUT_256(AH_FAST_LUT_ENTRY, AH_FAST_LUT_SIZE & 0x200)
+#endif
+#if AH_FAST_LUT_SIZE & 0x080
+    SENSIRION_AH_LUT_128(AH_FAST_LUT_ENTRY, AH_FAST_LUT_SIZE & 0x300)
+#endif
+#if AH_FAST_LUT_SIZE & 0x040
+    SENSIRION_AH_LUT_64(AH_FAST_LUT_ENTRY, AH_FAST_LUT_SIZE & 0x380)
+#endif
+#if AH_FAST_LUT_SIZE & 0x020
+    SENSIRION_AH_LUT_32(AH_FAST_LUT_ENTRY, AH_FAST_LUT_SIZE & 0x3C0)
+#endif
+#if AH_FAST_LUT_SIZE & 0x010
+    SENSIRION_AH_LUT_16(AH_FAST_LUT_ENTRY, AH_FAST_LUT_SIZE & 0x3E0)
+#endif
+#if AH_FAST_LUT_SIZE & 0x008
+    SENSIRION_AH_LUT_8(AH_FAST_LUT_ENTRY, AH_FAST_LUT_SIZE & 0x3F0)
+#endif
+#if AH_FAST_LUT_SIZE & 0x004
+    SENSIRION_AH_LUT_4(AH_FAST_LUT_ENTRY, AH_FAST_LUT_SIZE & 0x3F8)
+#endif
+#if AH_FAST_LUT_SIZE & 0x002
+    SENSIRION_AH_LUT_2(AH_FAST_LUT_ENTRY, AH_FAST_LUT_SIZE & 0x3FC)
+#endif
+#if AH_FAST_LUT_SIZE & 0x001
+    SENSIRION_AH_LUT_1(AH_FAST_LUT_ENTRY, AH_FAST_LUT_SIZE & 0x3FE)
+#endif
+};
+/* clang-format on */
+
+static uint32_t ah_fast(int32_t temperature_milli_celsius,
+                        int32_t humidity_milli_percent) {
+    uint32_t t, i, ret, q;
+
+    /* clamp to the table, the last step interpolates to the last entry with
+     * rem == AH_FAST_STEP so i + 1 stays within the table */
+    if (temperature_milli_celsius <= AH_FAST_T_LO)
+        t = 0;
+    else if (temperature_milli_celsius >= AH_FAST_T_LO + AH_FAST_T_MAX)
+        t = AH_FAST_T_MAX;
+    else
+        t = (uint32_t)(temperature_milli_celsius - AH_FAST_T_LO);
+    if (humidity_milli_percent <= 0)
+        return 0;
+
+    i = t >> SENSIRION_AH_FAST_LUT_SHIFT;
+    if (i > AH_FAST_LUT_SIZE - 2)
+        i = AH_FAST_LUT_SIZE - 2;
+    t -= i << SENSIRION_AH_FAST_LUT_SHIFT;
+    ret = AH_FAST_LUT_100RH[i] +
+          (((AH_FAST_LUT_100RH[i + 1] - AH_FAST_LUT_100RH[i]) * t) >>
+           SENSIRION_AH_FAST_LUT_SHIFT);
+
+    /* ret * q / 2^16 with ret split at bit 15 */
+    q = ((uint32_t)humidity_milli_percent * AH_FAST_RH_SCALE) >> 15;
+    return (((ret >> 15) * q) >> 1) + (((ret & 0x7FFF) * q) >> 16);
+}
+
+uint32_t
+sensirion_calc_absolute_humidity_fast(int32_t temperature_milli_celsius,
+                                      int32_t humidity_milli_percent) {
+    return ah_fast(temperature_milli_celsius, humidity_milli_percent);
+}
+
+void sensirion_calc_absolute_humidity_batch(const int32_t* values,
+                                            uint32_t* absolute_humidity,
+                                            uint32_t count) {
+    uint32_t i = 0;
+
+#if defined(SENSIRION_HUMIDITY_CONVERSION_AVX2)
+    const __m256i deinterleave = _mm256_setr_epi32(0, 2, 4, 6, 1, 3, 5, 7);
+    const __m256i t_lo = _mm256_set1_epi32(AH_FAST_T_LO);
+    const __m256i t_max = _mm256_set1_epi32(AH_FAST_T_MAX);
+    const __m256i i_max = _mm256_set1_epi32(AH_FAST_LUT_SIZE - 2);
+    const __m256i rh_scale = _mm256_set1_epi32(AH_FAST_RH_SCALE);
+    const __m256i lo_mask = _mm256_set1_epi32(0x7FFF);
+    const __m256i zero = _mm256_setzero_si256();
+    const int* lut = (const int*)AH_FAST_LUT_100RH;
+
+    for (; i + 8 <= count; i += 8) {
+        __m256i a = _mm256_permutevar8x32_epi32(
+            _mm256_loadu_si256((const __m256i*)&values[2 * i]), deinterleave);
+        __m256i b = _mm256_permutevar8x32_epi32(
+            _mm256_loadu_si256((const __m256i*)&values[2 * i + 8]),
+            deinterleave);
+        __m256i t = _mm256_permute2x128_si256(a, b, 0x20);
+        __m256i rh = _mm256_max_epi32(_mm256_permute2x128_si256(a, b, 0x31),
+                                      zero);
+        __m256i idx, lo, hi, ret, q;
+
+        t = _mm256_min_epi32(_mm256_max_epi32(_mm256_sub_epi32(t, t_lo), zero),
+                             t_max);
+        idx = _mm256_min_epi32(
+            _mm256_srli_epi32(t, SENSIRION_AH_FAST_LUT_SHIFT), i_max);
+        t = _mm256_sub_epi32(
+            t, _mm256_slli_epi32(idx, SENSIRION_AH_FAST_LUT_SHIFT));
+        lo = _mm256_i32gather_epi32(lut, idx, 4);
+        hi = _mm256_i32gather_epi32(lut + 1, idx, 4);
+        ret = _mm256_add_epi32(
+            lo, _mm256_srli_epi32(
+                    _mm256_mullo_epi32(_mm256_sub_epi32(hi, lo), t),
+                    SENSIRION_AH_FAST_LUT_SHIFT));
+
+        q = _mm256_srli_epi32(_mm256_mullo_epi32(rh, rh_scale), 15);
+        ret = _mm256_add_epi32(
+            _mm256_srli_epi32(
+                _mm256_mullo_epi32(_mm256_srli_epi32(ret, 15), q), 1),
+            _mm256_srli_epi32(
+                _mm256_mullo_epi32(_mm256_and_si256(ret, lo_mask), q), 16));
+        _mm256_storeu_si256((__m256i*)&absolute_humidity[i], ret);
+    }
+#endif
+
+    for (; i < count; ++i)
+        absolute_humidity[i] = ah_fast(values[2 * i], values[2 * i + 1]);
+}
@@ -0,0 +1,117 @@
+/*
+ * Copyright (c) 2026, Sensirion AG
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * * Redistributions of source code must retain the above copyright notice, this
+ *   list of conditions and the following disclaimer.
+ *
+ * * Redistributions in binary form must reproduce the above copyright notice,
+ *   this list of conditions and the following disclaimer in the documentation
+ *   and/or other materials provided with the distribution.
+ *
+ * * Neither the name of Sensirion AG nor the names of its
+ *   contributors may be used to endorse or promote products derived from
+ *   this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/*
+ * Accuracy and speed of sensirion_calc_absolute_humidity() for one lookup
+ * table configuration. `make ah_lut_report` builds and runs it for each
+ * setting in AH_LUT_CONFIGS, e.g.
+ *   make ah_lut_report AH_LUT_CONFIGS="-40000:125000:1000 -20000:70000:10000"
+ * The error is measured against the Magnus formula over the table range in
+ * 0.05 degC and 1 %RH steps. The relative error only counts values from
+ * 1 g/m^3, below that the integer mg/m^3 result dominates it.
+ */
+
+#define _POSIX_C_SOURCE 200809L
+
+#include <math.h>
+#include <stdio.h>
+#include <string.h>
+#include <time.h>
+
+#include "sensirion_humidity_conversion.h"
+
+#define NUM_SAMPLES 4096
+#define NUM_ROUNDS 2000
+
+static int32_t temperatures[NUM_SAMPLES];
+static int32_t humidities[NUM_SAMPLES];
+
+static double now_sec(void) {
+    struct timespec ts;
+
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (double)ts.tv_sec + (double)ts.tv_nsec * 1e-9;
+}
+
+/* absolute humidity in mg/m^3 */
+static double magnus_ah(double t, double rh) {
+    return 216.7 * (rh / 100.0 * 6.112 * exp(17.62 * t / (243.12 + t))) /
+           (273.15 + t) * 1000.0;
+}
+
+int main(int argc, char* argv[]) {
+    double err_sum = 0.0, err_max = 0.0, rel_max = 0.0;
+    uint32_t count = 0, round, i;
+    uint32_t checksum = 0;
+    int32_t t, rh;
+    double start, ns;
+
+    if (argc > 1 && strcmp(argv[1], "--header") == 0)
+        printf("%-18s %7s %7s %6s %10s %10s %9s %8s\n", "range [degC]",
+               "step", "entries", "bytes", "mean [mg]", "max [mg]", "max [%]",
+               "ns/call");
+
+    for (t = SENSIRION_AH_LUT_T_LO; t <= SENSIRION_AH_LUT_T_HI; t += 50) {
+        for (rh = 1000; rh <= 100000; rh += 1000) {
+            double ref = magnus_ah(t / 1000.0, rh / 1000.0);
+            double err = fabs(sensirion_calc_absolute_humidity(t, rh) - ref);
+
+            err_sum += err;
+            if (err > err_max)
+                err_max = err;
+            if (ref >= 1000.0 && err / ref > rel_max)
+                rel_max = err / ref;
+            ++count;
+        }
+    }
+
+    for (i = 0; i < NUM_SAMPLES; ++i) {
+        uint32_t range = SENSIRION_AH_LUT_T_HI - SENSIRION_AH_LUT_T_LO;
+
+        temperatures[i] =
+            SENSIRION_AH_LUT_T_LO + (int32_t)(range * i / NUM_SAMPLES);
+        humidities[i] = (int32_t)(i * 7919U % 100001U);
+    }
+    start = now_sec();
+    for (round = 0; round < NUM_ROUNDS; ++round) {
+        for (i = 0; i < NUM_SAMPLES; ++i)
+            checksum += sensirion_calc_absolute_humidity(temperatures[i],
+                                                         humidities[i]);
+    }
+    ns = (now_sec() - start) * 1e9 / ((double)NUM_SAMPLES * NUM_ROUNDS);
+
+    printf("%7.1f .. %7.1f %7.2f %7d %6u %10.1f %10.1f %9.3f %8.2f\n",
+           SENSIRION_AH_LUT_T_LO / 1000.0, SENSIRION_AH_LUT_T_HI / 1000.0,
+           SENSIRION_AH_LUT_T_STEP / 1000.0, SENSIRION_AH_LUT_SIZE,
+           (unsigned)(SENSIRION_AH_LUT_SIZE * sizeof(uint32_t)),
+           err_sum / count, err_max, rel_max * 100.0, ns);
+    return checksum == 0; /* keep the timed calls */
+}
@@ -0,0 +1,106 @@
+/*
+ * Copyright (c) 2026, Sensirion AG
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * * Redistributions of source code must retain the above copyright notice, this
+ *   list of conditions and the following disclaimer.
+ *
+ * * Redistributions in binary form must reproduce the above copyright notice,
+ *   this list of conditions and the following disclaimer in the documentation
+ *   and/or other materials provided with the distribution.
+ *
+ * * Neither the name of Sensirion AG nor the names of its
+ *   contributors may be used to endorse or promote products derived from
+ *   this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * \file
+ *
+ * \brief Compile time generation of humidity lookup tables
+ *
+ * Private to the humidity conversions. A table is a list of
+ * SENSIRION_AH_LUT_<n>(entry, i) blocks whose sizes add up to the number of
+ * entries, entry(i) expands to the initializer of entry i.
+ */
+
+#ifndef SENSIRION_HUMIDITY_LUT_H
+#define SENSIRION_HUMIDITY_LUT_H
+
+/* Static initializers cannot call exp(). SENSIRION_AH_EXP() is the Taylor
+ * series of order 30 around 1.25 in Horner form, the relative error is below
+ * 1e-11 for the exponents of -40..125 degC (-3.9..6). */
+/* clang-format off */
+#define SENSIRION_AH_EXP_TAYLOR(d) \
+    (1.0 + (d) / 1 * (1.0 + (d) / 2 * (1.0 + (d) / 3 * (1.0 + (d) / 4 * \
+    (1.0 + (d) / 5 * (1.0 + (d) / 6 * (1.0 + (d) / 7 * (1.0 + (d) / 8 * \
+    (1.0 + (d) / 9 * (1.0 + (d) / 10 * (1.0 + (d) / 11 * (1.0 + (d) / 12 * \
+    (1.0 + (d) / 13 * (1.0 + (d) / 14 * (1.0 + (d) / 15 * (1.0 + (d) / 16 * \
+    (1.0 + (d) / 17 * (1.0 + (d) / 18 * (1.0 + (d) / 19 * (1.0 + (d) / 20 * \
+    (1.0 + (d) / 21 * (1.0 + (d) / 22 * (1.0 + (d) / 23 * (1.0 + (d) / 24 * \
+    (1.0 + (d) / 25 * (1.0 + (d) / 26 * (1.0 + (d) / 27 * (1.0 + (d) / 28 * \
+    (1.0 + (d) / 29 * (1.0 + (d) / 30))))))))))))))))))))))))))))))
+/* clang-format on */
+#define SENSIRION_AH_EXP(x)                                                    \
+    (3.4903429574618414 /* exp(1.25) */ * SENSIRION_AH_EXP_TAYLOR((x)-1.25))
+
+/* absolute humidity at 100%RH in g/m^3, t in degree Celsius (see ah_lut.py) */
+#define SENSIRION_AH_100RH(t)                                                  \
+    (216.7 * 6.112 * SENSIRION_AH_EXP(17.62 * (t) / (243.12 + (t))) /          \
+     (273.15 + (t)))
+
+/* absolute humidity at 100%RH in mg/m^3, t in milli degree Celsius */
+#define SENSIRION_AH_LUT_VALUE(t)                                              \
+    (uint32_t)(SENSIRION_AH_100RH((t) / 1000.0) * 1000.0 + 0.5)
+
+/* saturation vapour pressure over water and over ice in Pa (Magnus formula
+ * with the constants of ah_lut.py and of Sonntag 1990 for ice), t in degree
+ * Celsius */
+#define SENSIRION_ES_WATER(t)                                                  \
+    (611.2 * SENSIRION_AH_EXP(17.62 * (t) / (243.12 + (t))))
+#define SENSIRION_ES_ICE(t)                                                    \
+    (611.2 * SENSIRION_AH_EXP(22.46 * (t) / (272.62 + (t))))
+
+/* saturation vapour pressure in centi Pascal, t in milli degree Celsius */
+#define SENSIRION_ES_WATER_LUT_VALUE(t)                                        \
+    (uint32_t)(SENSIRION_ES_WATER((t) / 1000.0) * 100.0 + 0.5)
+#define SENSIRION_ES_ICE_LUT_VALUE(t)                                          \
+    (uint32_t)(SENSIRION_ES_ICE((t) / 1000.0) * 100.0 + 0.5)
+
+/* SENSIRION_AH_LUT_<n>(entry, i) expands to the entries i..i+n-1 */
+#define SENSIRION_AH_LUT_1(entry, i) entry(i)
+#define SENSIRION_AH_LUT_2(entry, i)                                           \
+    SENSIRION_AH_LUT_1(entry, i) SENSIRION_AH_LUT_1(entry, (i) + 1)
+#define SENSIRION_AH_LUT_4(entry, i)                                           \
+    SENSIRION_AH_LUT_2(entry, i) SENSIRION_AH_LUT_2(entry, (i) + 2)
+#define SENSIRION_AH_LUT_8(entry, i)                                           \
+    SENSIRION_AH_LUT_4(entry, i) SENSIRION_AH_LUT_4(entry, (i) + 4)
+#define SENSIRION_AH_LUT_16(entry, i)                                          \
+    SENSIRION_AH_LUT_8(entry, i) SENSIRION_AH_LUT_8(entry, (i) + 8)
+#define SENSIRION_AH_LUT_32(entry, i)                                          \
+    SENSIRION_AH_LUT_16(entry, i) SENSIRION_AH_LUT_16(entry, (i) + 16)
+#define SENSIRION_AH_LUT_64(entry, i)                                          \
+    SENSIRION_AH_LUT_32(entry, i) SENSIRION_AH_LUT_32(entry, (i) + 32)
+#define SENSIRION_AH_LUT_128(entry, i)                                         \
+    SENSIRION_AH_LUT_64(entry, i) SENSIRION_AH_LUT_64(entry, (i) + 64)
+#define SENSIRION_AH_LUT_256(entry, i)                                         \
+    SENSIRION_AH_LUT_128(entry, i) SENSIRION_AH_LUT_128(entry, (i) + 128)
+#define SENSIRION_AH_LUT_512(entry, i)                                         \
+    SENSIRION_AH_LUT_256(entry, i) SENSIRION_AH_LUT_256(entry, (i) + 256)
+
+#endif /* SENSIRION_HUMIDITY_LUT_H */
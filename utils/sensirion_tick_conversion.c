@@ -0,0 +1,190 @@
+/*
+ * Copyright (c) 2026, Sensirion AG
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * * Redistributions of source code must retain the above copyright notice, this
+ *   list of conditions and the following disclaimer.
+ *
+ * * Redistributions in binary form must reproduce the above copyright notice,
+ *   this list of conditions and the following disclaimer in the documentation
+ *   and/or other materials provided with the distribution.
+ *
+ * * Neither the name of Sensirion AG nor the names of its
+ *   contributors may be used to endorse or promote products derived from
+ *   this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "sensirion_tick_conversion.h"
+
+#if !defined(SENSIRION_TICK_CONVERSION_NO_SIMD) && defined(__AVX2__)
+#include <immintrin.h>
+#define SENSIRION_TICK_CONVERSION_AVX2
+#elif !defined(SENSIRION_TICK_CONVERSION_NO_SIMD) && \
+    (defined(__ARM_NEON) || defined(__ARM_NEON__))
+#include <arm_neon.h>
+#define SENSIRION_TICK_CONVERSION_NEON
+#endif
+
+/* Fixed point conversion: value = ((scale * tick) >> shift) + offset
+ * milli units, shift 13: scale = full range * 2^13 / 2^16
+ * centi units, shift 14: scale = full range / 10 * 2^14 / 2^16, which keeps
+ * the result equal to the milli value floored to a multiple of 10 */
+#define MILLI_SHIFT 13
+#define CENTI_SHIFT 14
+
+typedef struct {
+    int32_t t_scale;
+    int32_t t_offset;
+    int32_t rh_scale;
+    int32_t rh_offset;
+} tick_coefficients_t;
+
+/* T = -45 + 175 * tick / 2^16, RH = 100 * tick / 2^16 */
+static const tick_coefficients_t SHT3X_MILLI = {21875, -45000, 12500, 0};
+static const tick_coefficients_t SHT3X_CENTI = {4375, -4500, 2500, 0};
+/* T = -45 + 175 * tick / 2^16, RH = -6 + 125 * tick / 2^16 */
+static const tick_coefficients_t SHT4X_MILLI = {21875, -45000, 15625, -6000};
+static const tick_coefficients_t SHT4X_CENTI = {4375, -4500, 3125, -600};
+
+static void ticks_to_milli(const uint16_t* ticks, int32_t* values,
+                           uint32_t count, const tick_coefficients_t* c) {
+    uint32_t n = 2 * count;
+    uint32_t i = 0;
+
+#if defined(SENSIRION_TICK_CONVERSION_AVX2)
+    const __m256i scale =
+        _mm256_setr_epi32(c->t_scale, c->rh_scale, c->t_scale, c->rh_scale,
+                          c->t_scale, c->rh_scale, c->t_scale, c->rh_scale);
+    const __m256i offset = _mm256_setr_epi32(
+        c->t_offset, c->rh_offset, c->t_offset, c->rh_offset, c->t_offset,
+        c->rh_offset, c->t_offset, c->rh_offset);
+
+    for (; i + 8 <= n; i += 8) {
+        __m256i v = _mm256_cvtepu16_epi32(
+            _mm_loadu_si128((const __m128i*)&ticks[i]));
+        v = _mm256_srai_epi32(_mm256_mullo_epi32(v, scale), MILLI_SHIFT);
+        _mm256_storeu_si256((__m256i*)&values[i], _mm256_add_epi32(v, offset));
+    }
+#elif defined(SENSIRION_TICK_CONVERSION_NEON)
+    const int32_t scales[] = {c->t_scale, c->rh_scale, c->t_scale,
+                              c->rh_scale};
+    const int32_t offsets[] = {c->t_offset, c->rh_offset, c->t_offset,
+                               c->rh_offset};
+    const int32x4_t scale = vld1q_s32(scales);
+    const int32x4_t offset = vld1q_s32(offsets);
+
+    for (; i + 4 <= n; i += 4) {
+        int32x4_t v = vreinterpretq_s32_u32(vmovl_u16(vld1_u16(&ticks[i])));
+        v = vshrq_n_s32(vmulq_s32(v, scale), MILLI_SHIFT);
+        vst1q_s32(&values[i], vaddq_s32(v, offset));
+    }
+#endif
+
+    for (; i < n; i += 2) {
+        values[i] = ((c->t_scale * (int32_t)ticks[i]) >> MILLI_SHIFT) +
+                    c->t_offset;
+        values[i + 1] = ((c->rh_scale * (int32_t)ticks[i + 1]) >> MILLI_SHIFT) +
+                        c->rh_offset;
+    }
+}
+
+static void ticks_to_centi(const uint16_t* ticks, int16_t* values,
+                           uint32_t count, const tick_coefficients_t* c) {
+    uint32_t n = 2 * count;
+    uint32_t i = 0;
+
+#if defined(SENSIRION_TICK_CONVERSION_AVX2)
+    const __m256i scale =
+        _mm256_setr_epi32(c->t_scale, c->rh_scale, c->t_scale, c->rh_scale,
+                          c->t_scale, c->rh_scale, c->t_scale, c->rh_scale);
+    const __m256i offset = _mm256_setr_epi32(
+        c->t_offset, c->rh_offset, c->t_offset, c->rh_offset, c->t_offset,
+        c->rh_offset, c->t_offset, c->rh_offset);
+
+    for (; i + 16 <= n; i += 16) {
+        __m256i lo = _mm256_cvtepu16_epi32(
+            _mm_loadu_si128((const __m128i*)&ticks[i]));
+        __m256i hi = _mm256_cvtepu16_epi32(
+            _mm_loadu_si128((const __m128i*)&ticks[i + 8]));
+        lo = _mm256_srai_epi32(_mm256_mullo_epi32(lo, scale), CENTI_SHIFT);
+        hi = _mm256_srai_epi32(_mm256_mullo_epi32(hi, scale), CENTI_SHIFT);
+        lo = _mm256_add_epi32(lo, offset);
+        hi = _mm256_add_epi32(hi, offset);
+        /* packs works per 128 bit lane, restore the sample order */
+        _mm256_storeu_si256(
+            (__m256i*)&values[i],
+            _mm256_permute4x64_epi64(_mm256_packs_epi32(lo, hi), 0xD8));
+    }
+#elif defined(SENSIRION_TICK_CONVERSION_NEON)
+    const int32_t scales[] = {c->t_scale, c->rh_scale, c->t_scale,
+                              c->rh_scale};
+    const int32_t offsets[] = {c->t_offset, c->rh_offset, c->t_offset,
+                               c->rh_offset};
+    const int32x4_t scale = vld1q_s32(scales);
+    const int32x4_t offset = vld1q_s32(offsets);
+
+    for (; i + 8 <= n; i += 8) {
+        uint16x8_t v = vld1q_u16(&ticks[i]);
+        int32x4_t lo = vreinterpretq_s32_u32(vmovl_u16(vget_low_u16(v)));
+        int32x4_t hi = vreinterpretq_s32_u32(vmovl_u16(vget_high_u16(v)));
+        lo = vaddq_s32(vshrq_n_s32(vmulq_s32(lo, scale), CENTI_SHIFT), offset);
+        hi = vaddq_s32(vshrq_n_s32(vmulq_s32(hi, scale), CENTI_SHIFT), offset);
+        vst1q_s16(&values[i], vcombine_s16(vmovn_s32(lo), vmovn_s32(hi)));
+    }
+#endif
+
+    for (; i < n; i += 2) {
+        values[i] = (int16_t)(((c->t_scale * (int32_t)ticks[i]) >>
+                               CENTI_SHIFT) +
+                              c->t_offset);
+        values[i + 1] = (int16_t)(((c->rh_scale * (int32_t)ticks[i + 1]) >>
+                                   CENTI_SHIFT) +
+                                  c->rh_offset);
+    }
+}
+
+void sensirion_sht3x_ticks_to_milli(const uint16_t* ticks, int32_t* values,
+                                    uint32_t count) {
+    ticks_to_milli(ticks, values, count, &SHT3X_MILLI);
+}
+
+void sensirion_sht3x_ticks_to_centi(const uint16_t* ticks, int16_t* values,
+                                    uint32_t count) {
+    ticks_to_centi(ticks, values, count, &SHT3X_CENTI);
+}
+
+void sensirion_sht4x_ticks_to_milli(const uint16_t* ticks, int32_t* values,
+                                    uint32_t count) {
+    ticks_to_milli(ticks, values, count, &SHT4X_MILLI);
+}
+
+void sensirion_sht4x_ticks_to_centi(const uint16_t* ticks, int16_t* values,
+                                    uint32_t count) {
+    ticks_to_centi(ticks, values, count, &SHT4X_CENTI);
+}
+
+/* SHTC1 compatible sensors use the SHT3x transfer function */
+void sensirion_shtc1_ticks_to_milli(const uint16_t* ticks, int32_t* values,
+                                    uint32_t count) {
+    ticks_to_milli(ticks, values, count, &SHT3X_MILLI);
+}
+
+void sensirion_shtc1_ticks_to_centi(const uint16_t* ticks, int16_t* values,
+                                    uint32_t count) {
+    ticks_to_centi(ticks, values, count, &SHT3X_CENTI);
+}
@@ -0,0 +1,112 @@
+/*
+ * Copyright (c) 2026, Sensirion AG
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * * Redistributions of source code must retain the above copyright notice, this
+ *   list of conditions and the following disclaimer.
+ *
+ * * Redistributions in binary form must reproduce the above copyright notice,
+ *   this list of conditions and the following disclaimer in the documentation
+ *   and/or other materials provided with the distribution.
+ *
+ * * Neither the name of Sensirion AG nor the names of its
+ *   contributors may be used to endorse or promote products derived from
+ *   this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef SENSIRION_TICK_CONVERSION_H
+#define SENSIRION_TICK_CONVERSION_H
+#include "sensirion_arch_config.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*
+ * Batch conversion of raw sensor ticks to physical values
+ *
+ * The input is an array of `count` samples as read from the sensor, each a
+ * temperature tick followed by a humidity tick. The output holds the
+ * temperature and humidity of each sample in the same interleaved order.
+ *
+ * The *_to_milli() functions return milli degree Celsius and milli percent
+ * relative humidity and are bit-exact with the conversions of the drivers.
+ * The *_to_centi() functions return centi degree Celsius and centi percent
+ * relative humidity, which is the milli value divided by 10 and rounded
+ * towards negative infinity.
+ *
+ * The conversion uses AVX2 or NEON when the compiler targets them (e.g.
+ * -mavx2) unless SENSIRION_TICK_CONVERSION_NO_SIMD is defined, and a portable
+ * scalar loop otherwise.
+ */
+
+/**
+ * sensirion_sht3x_ticks_to_milli() - Convert SHT3x ticks to milli units
+ *
+ * @param ticks     count pairs of temperature and humidity ticks
+ * @param values    count pairs of temperature in milli degree Celsius and
+ *                  humidity in milli percent relative humidity
+ * @param count     the number of samples
+ */
+void sensirion_sht3x_ticks_to_milli(const uint16_t* ticks, int32_t* values,
+                                    uint32_t count);
+
+/**
+ * sensirion_sht3x_ticks_to_centi() - Convert SHT3x ticks to centi units
+ *
+ * @param ticks     count pairs of temperature and humidity ticks
+ * @param values    count pairs of temperature in centi degree Celsius and
+ *                  humidity in centi percent relative humidity
+ * @param count     the number of samples
+ */
+void sensirion_sht3x_ticks_to_centi(const uint16_t* ticks, int16_t* values,
+                                    uint32_t count);
+
+/**
+ * sensirion_sht4x_ticks_to_milli() - Convert SHT4x ticks to milli units, see
+ *                                    sensirion_sht3x_ticks_to_milli()
+ */
+void sensirion_sht4x_ticks_to_milli(const uint16_t* ticks, int32_t* values,
+                                    uint32_t count);
+
+/**
+ * sensirion_sht4x_ticks_to_centi() - Convert SHT4x ticks to centi units, see
+ *                                    sensirion_sht3x_ticks_to_centi()
+ */
+void sensirion_sht4x_ticks_to_centi(const uint16_t* ticks, int16_t* values,
+                                    uint32_t count);
+
+/**
+ * sensirion_shtc1_ticks_to_milli() - Convert SHTC1 ticks to milli units, see
+ *                                    sensirion_sht3x_ticks_to_milli()
+ */
+void sensirion_shtc1_ticks_to_milli(const uint16_t* ticks, int32_t* values,
+                                    uint32_t count);
+
+/**
+ * sensirion_shtc1_ticks_to_centi() - Convert SHTC1 ticks to centi units, see
+ *                                    sensirion_sht3x_ticks_to_centi()
+ */
+void sensirion_shtc1_ticks_to_centi(const uint16_t* ticks, int16_t* values,
+                                    uint32_t count);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* SENSIRION_TICK_CONVERSION_H */
@@ -0,0 +1,168 @@
+/*
+ * Copyright (c) 2026, Sensirion AG
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * * Redistributions of source code must retain the above copyright notice, this
+ *   list of conditions and the following disclaimer.
+ *
+ * * Redistributions in binary form must reproduce the above copyright notice,
+ *   this list of conditions and the following disclaimer in the documentation
+ *   and/or other materials provided with the distribution.
+ *
+ * * Neither the name of Sensirion AG nor the names of its
+ *   contributors may be used to endorse or promote products derived from
+ *   this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/*
+ * Throughput of the batch tick conversion against converting one sample at a
+ * time like the drivers do. Build with `make benchmark`, add e.g.
+ * BENCHMARK_CFLAGS="-O2 -mavx2" to select the SIMD path.
+ */
+
+#define _POSIX_C_SOURCE 200809L
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+
+#include "sensirion_tick_conversion.h"
+
+#define NUM_SAMPLES 4096
+#define NUM_ROUNDS 20000
+
+static uint16_t ticks[2 * NUM_SAMPLES];
+static int32_t milli[2 * NUM_SAMPLES];
+static int16_t centi[2 * NUM_SAMPLES];
+
+/* the per sample conversion of the drivers, kept out of line like a call to
+ * tick_to_temperature() and tick_to_humidity() */
+__attribute__((noinline)) static void
+tick_to_temperature(uint16_t tick, int32_t* temperature) {
+    *temperature = ((21875 * (int32_t)tick) >> 13) - 45000;
+}
+
+__attribute__((noinline)) static void tick_to_humidity(uint16_t tick,
+                                                       int32_t* humidity) {
+    *humidity = ((12500 * (int32_t)tick) >> 13);
+}
+
+static double now_sec(void) {
+    struct timespec ts;
+
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (double)ts.tv_sec + (double)ts.tv_nsec * 1e-9;
+}
+
+typedef void (*ticks_to_milli_t)(const uint16_t*, int32_t*, uint32_t);
+typedef void (*ticks_to_centi_t)(const uint16_t*, int16_t*, uint32_t);
+
+/* compare a batch conversion with the fixed point formulas of a driver for
+ * every tick, the centi units have to be the floor of the milli units */
+static int check_family(const char* name, ticks_to_milli_t to_milli,
+                        ticks_to_centi_t to_centi, int32_t rh_mul,
+                        int32_t rh_offset) {
+    static uint16_t all_ticks[2 * 65536];
+    static int32_t all_milli[2 * 65536];
+    static int16_t all_centi[2 * 65536];
+    uint32_t i;
+
+    for (i = 0; i < 65536; ++i) {
+        all_ticks[2 * i] = (uint16_t)i;
+        all_ticks[2 * i + 1] = (uint16_t)i;
+    }
+    to_milli(all_ticks, all_milli, 65536);
+    to_centi(all_ticks, all_centi, 65536);
+    for (i = 0; i < 65536; ++i) {
+        int32_t t = ((21875 * (int32_t)i) >> 13) - 45000;
+        int32_t rh = ((rh_mul * (int32_t)i) >> 13) + rh_offset;
+
+        if (all_milli[2 * i] != t || all_milli[2 * i + 1] != rh ||
+            all_centi[2 * i] * 10 > t || all_centi[2 * i] * 10 + 10 <= t ||
+            all_centi[2 * i + 1] * 10 > rh ||
+            all_centi[2 * i + 1] * 10 + 10 <= rh) {
+            printf("%s: mismatch at tick %u\n", name, i);
+            return 1;
+        }
+    }
+    return 0;
+}
+
+static int check_exact(void) {
+    return check_family("SHT3x", sensirion_sht3x_ticks_to_milli,
+                        sensirion_sht3x_ticks_to_centi, 12500, 0) ||
+           check_family("SHT4x", sensirion_sht4x_ticks_to_milli,
+                        sensirion_sht4x_ticks_to_centi, 15625, -6000) ||
+           check_family("SHTC1", sensirion_shtc1_ticks_to_milli,
+                        sensirion_shtc1_ticks_to_centi, 12500, 0);
+}
+
+static void report(const char* name, double seconds) {
+    printf("%-28s %8.1f Msamples/s\n", name,
+           (double)NUM_SAMPLES * NUM_ROUNDS / seconds * 1e-6);
+}
+
+int main(void) {
+    double start;
+    uint32_t round, i;
+    int32_t checksum = 0;
+
+#if defined(SENSIRION_TICK_CONVERSION_NO_SIMD)
+    printf("conversion path: scalar\n");
+#elif defined(__AVX2__)
+    printf("conversion path: AVX2\n");
+#elif defined(__ARM_NEON) || defined(__ARM_NEON__)
+    printf("conversion path: NEON\n");
+#else
+    printf("conversion path: scalar\n");
+#endif
+
+    if (check_exact())
+        return 1;
+
+    srand(1);
+    for (i = 0; i < 2 * NUM_SAMPLES; ++i)
+        ticks[i] = (uint16_t)rand();
+
+    start = now_sec();
+    for (round = 0; round < NUM_ROUNDS; ++round) {
+        for (i = 0; i < NUM_SAMPLES; ++i) {
+            tick_to_temperature(ticks[2 * i], &milli[2 * i]);
+            tick_to_humidity(ticks[2 * i + 1], &milli[2 * i + 1]);
+        }
+        checksum += milli[round % (2 * NUM_SAMPLES)];
+    }
+    report("per sample (drivers)", now_sec() - start);
+
+    start = now_sec();
+    for (round = 0; round < NUM_ROUNDS; ++round) {
+        sensirion_sht3x_ticks_to_milli(ticks, milli, NUM_SAMPLES);
+        checksum += milli[round % (2 * NUM_SAMPLES)];
+    }
+    report("batch, int32 milli units", now_sec() - start);
+
+    start = now_sec();
+    for (round = 0; round < NUM_ROUNDS; ++round) {
+        sensirion_sht3x_ticks_to_centi(ticks, centi, NUM_SAMPLES);
+        checksum += centi[round % (2 * NUM_SAMPLES)];
+    }
+    report("batch, int16 centi units", now_sec() - start);
+
+    printf("(checksum %d)\n", checksum);
+    return 0;
+}